@@ -1,147 +0,0 @@
-/**
- * https://lvgl.io/tools/imageconverter
- * BMP2CARRAY
- * RGB565 True Color
- * LV_COLOR_DEPTH 16
- * LV_COLOR_16_SWAP 0
- */
-
-const unsigned char wb50bcd[] = {
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbd, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xbd, 0xff, 0x9d, 0xff, 0xfa, 0xfe, 0xb5, 0xe5, 0x75, 0xcd, 0x55, 0xcd, 0x9b, 0xf6, 0x7e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xef, 0xdf, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0x9d, 0xff, 0xbe, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0x5d, 0xff, 0xfc, 0xfe, 0x5e, 0xff, 0x1d, 0xff, 0x5e, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x34, 0xdd, 0xaa, 0x9a, 0xc7, 0xa9, 0x00, 0x80, 0x00, 0x78, 0x8a, 0xaa, 0x59, 0xee, 0xdf, 0xff, 0x1b, 0xf7, 0x9a, 0xde, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x7e, 0xff, 0x5d, 0xff, 0x59, 0xf6, 0x1b, 0xf7, 0xbe, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5d, 0xff, 0xb7, 0xdd, 0x35, 0xd5, 0x14, 0xdd, 0x14, 0xd5, 0xf4, 0xe4, 0x52, 0xc4, 0x31, 0xcc, 0x52, 0xdc, 0xaf, 0xb3, 0xf1, 0xcb, 0xb4, 0xd4, 0xf0, 0xab, 0x59, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x14, 0xe5, 0xa4, 0x88, 0x02, 0x90, 0xe9, 0xd1, 0x66, 0xc1, 0xe3, 0xa0, 0x00, 0x80, 0xaa, 0xa2, 0xae, 0xbb, 0x0f, 0xbc, 0x96, 0xdd, 0x51, 0xb4, 0x7a, 0xe6, 0x7f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xde, 0xef, 0xff, 0xff, 0xbf, 0xff, 0x9b, 0xfe, 0x12, 0xdc, 0x0e, 0xcb, 0xea, 0xa9, 0x2a, 0xaa, 0xb1, 0xe3, 0x78, 0xfd, 0x3e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x7b, 0xfe, 0x00, 0x48, 0x32, 0xc4, 0x5b, 0xfe, 0x53, 0xf4, 0xf1, 0xeb, 0x02, 0x88, 0x29, 0xb2, 0x11, 0xec, 0x25, 0x81, 0xab, 0xb2, 0x8b, 0xaa, 0x87, 0x81, 0x73, 0xc4, 0x9f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xd7, 0xf5, 0xec, 0xba, 0x67, 0xa9, 0x67, 0xc9, 0x63, 0xb8, 0x20, 0xa0, 0xc2, 0xa8, 0xe7, 0xd1, 0x86, 0xb1, 0x00, 0x78, 0x4c, 0xb3, 0x79, 0xfe, 0x59, 0xfe, 0x6f, 0xcb, 0x5b, 0xf6, 0x5f, 0xff, 0x7e, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0x8f, 0xbb, 0x06, 0x89, 0x2a, 0xb2, 0x8b, 0xc2, 0x09, 0xa2, 0x87, 0xa1, 0x02, 0x90, 0x2f, 0xdb, 0xbc, 0xfe, 0xbe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xdc, 0xfe, 0xb4, 0xf4, 0x93, 0xf4, 0x11, 0xfc, 0x93, 0xfc, 0x73, 0xfc, 0xe5, 0xb8, 0xc8, 0xc1, 0xec, 0xe2, 0x86, 0xb1, 0x6a, 0xc2, 0xeb, 0xba, 0x35, 0xfd, 0x7a, 0xfe, 0x9e, 0xff, 0xbe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xdc, 0xee, 0x9e, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x7a, 0xee, 0xb3, 0xd4, 0xcc, 0xb2, 0x26, 0xa9, 0xc5, 0xc0, 0x84, 0xc0, 0xa2, 0xa0, 0x03, 0xa1, 0x25, 0xc9, 0x66, 0xc9, 0x00, 0x88, 0x00, 0x60, 0x4b, 0xa3, 0xdb, 0xfe, 0xac, 0xba, 0x91, 0xdb, 0x50, 0xe3, 0x14, 0xd5, 0xfe, 0xf7, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0x55, 0xdd, 0xc1, 0x60, 0xcf, 0xc3, 0x9a, 0xfe, 0x7c, 0xff, 0x5a, 0xff, 0xd5, 0xe5, 0x4d, 0xc3, 0x89, 0xb9, 0xad, 0xda, 0x3a, 0xfe, 0x9e, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbe, 0xff, 0xda, 0xfe, 0xd3, 0xe4, 0xef, 0xd3, 0x28, 0xba, 0x08, 0xca, 0x00, 0xa8, 0x66, 0xc9, 0x05, 0xc9, 0xc4, 0xc8, 0x04, 0xc9, 0x45, 0xc9, 0xa6, 0xc9, 0x10, 0xec, 0xf6, 0xf5, 0x5b, 0xff, 0x7c, 0xff, 0x7c, 0xff, 0xdd, 0xff, 0xbd, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x9d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7c, 0xff, 0x9c, 0xff, 0x7c, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3d, 0xf7, 0xfb, 0xf6, 0x3c, 0xff, 0xba, 0xfe, 0x3d, 0xff, 0x7e, 0xff, 0xfc, 0xe6, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xfc, 0xee, 0xb7, 0xc5, 0x9b, 0xe6, 0xdf, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9e, 0xf7, 0x9f, 0xff, 0x9f, 0xff, 0x9e, 0xf7, 0x7e, 0xf7, 0x9e, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7e, 0xf7, 0x7e, 0xff, 0x7e, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7e, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x5e, 0xf7, 0x9f, 0xff, 0xdf, 0xff, 0x9e, 0xf7, 0x9e, 0xf7, 0x9e, 0xff, 0xba, 0xee, 0x96, 0xe5, 0xcf, 0xcb, 0x09, 0xc2, 0x67, 0xc9, 0xa4, 0xb8, 0x00, 0x80, 0xc7, 0xb9, 0xc5, 0xb8, 0xc4, 0xb8, 0xa3, 0x90, 0x43, 0x69, 0xb0, 0xcc, 0xb5, 0xed, 0x00, 0x88, 0x00, 0xb0, 0x00, 0xa8, 0xcb, 0xb2, 0xfd, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xfc, 0xfe, 0x9a, 0xe6, 0x9b, 0xee, 0xbb, 0xf6, 0xbb, 0xf6, 0x18, 0xf6, 0xcf, 0xc3, 0x00, 0x70, 0x10, 0xe4, 0x39, 0xfe, 0x17, 0xfe, 0x97, 0xfe, 0xf6, 0xfd, 0x93, 0xfc, 0x2b, 0xda, 0x47, 0xb9, 0xb0, 0xdb, 0xf8, 0xfd, 0xd8, 0xf5, 0xf8, 0xf5, 0xf8, 0xf5, 0xf8, 0xf5, 0x18, 0xee, 0xf8, 0xed, 0x96, 0xed, 0xb2, 0xdc, 0x00, 0x78, 0xc7, 0xa9, 0x69, 0xca, 0x04, 0xc1, 0x04, 0xc9, 0xc7, 0xe1, 0xc3, 0xc8, 0xe3, 0xc8, 0x44, 0xd1, 0x03, 0xc1, 0xc2, 0xb0, 0x00, 0x80, 0x85, 0x91, 0x91, 0xcc, 0xf2, 0xcc, 0x70, 0xcc, 0xf3, 0xd4, 0xb2, 0xc4, 0xb2, 0xcc, 0xf3, 0xc4, 0xd7, 0xe5, 0x3c, 0xff, 0x99, 0xde, 0x58, 0xc6, 0xb9, 0xde, 0x38, 0xee, 0xb7, 0xe5, 0xb6, 0xdd, 0xd7, 0xdd, 0xf7, 0xe5, 0xd7, 0xed, 0x76, 0xf5, 0x72, 0xdc, 0xaf, 0xcb, 0xae, 0xc3, 0x30, 0xdc, 0x70, 0xdc, 0xce, 0xbb, 0xb6, 0xed, 0xd7, 0xf5, 0xd7, 0xed, 0x38, 0xee, 0x59, 0xee, 0xda, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x77, 0xd6, 0xb4, 0xc5, 0xb6, 0xf5, 0x6e, 0xcb, 0x11, 0xcc, 0x3a, 0xf6, 0x19, 0xd6, 0xfc, 0xde, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x7e, 0xf7, 0x18, 0xce, 0x19, 0xce, 0x7e, 0xff, 0x3e, 0xf7, 0x1d, 0xef, 0x9f, 0xff, 0x7e, 0xff, 0x9f, 0xff, 0x7e, 0xf7, 0x3d, 0xef, 0x1d, 0xef, 0x5e, 0xf7, 0x7e, 0xf7, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5e, 0xf7, 0x5e, 0xf7, 0x3d, 0xef, 0x5e, 0xf7, 0x3e, 0xf7, 0x1d, 0xef, 0x1d, 0xef, 0x3e, 0xf7, 0x3e, 0xf7, 0xfd, 0xee, 0xfc, 0xee, 0x1d, 0xf7, 0x1d, 0xff, 0x1d, 0xf7, 0x3d, 0xef, 0x7e, 0xf7, 0x5d, 0xef, 0x1c, 0xe7, 0x9d, 0xff, 0x79, 0xf6, 0xae, 0xbb, 0x29, 0xaa, 0x25, 0xa9, 0x46, 0xb9, 0xc8, 0xa9, 0xab, 0xca, 0x84, 0xa8, 0xe5, 0xa0, 0x08, 0xaa, 0x88, 0x8a, 0x52, 0xd5, 0x53, 0xe5, 0x00, 0x80, 0x02, 0xb0, 0x01, 0xa8, 0xa6, 0xa9, 0xf1, 0xcc, 0x13, 0xc5, 0x73, 0xb4, 0xd1, 0x9b, 0x4e, 0x9b, 0xd0, 0xab, 0x73, 0xc4, 0xd4, 0xdc, 0xf1, 0xc3, 0xe8, 0x91, 0x67, 0x91, 0x46, 0xa1, 0x26, 0xa1, 0x2a, 0xc2, 0x09, 0xda, 0x08, 0xc2, 0x4a, 0xda, 0xc9, 0xd1, 0xc4, 0xb0, 0x6b, 0xe2, 0x86, 0xa9, 0xa7, 0xa1, 0x47, 0xa1, 0xe7, 0xa0, 0xc7, 0xa0, 0x26, 0x98, 0xc7, 0x98, 0x86, 0x90, 0x67, 0xb1, 0xe5, 0xb0, 0xc4, 0xa8, 0x22, 0xa8, 0x00, 0xa8, 0x62, 0xc0, 0x86, 0xe1, 0x86, 0xe1, 0x20, 0xc0, 0xe2, 0xc8, 0x85, 0xd1, 0x43, 0xc1, 0x64, 0xc1, 0x65, 0xb9, 0x25, 0xb1, 0x66, 0xc1, 0x46, 0xc1, 0xe5, 0xc0, 0xc6, 0xc0, 0xa9, 0xd1, 0x07, 0xc1, 0xe9, 0xc9, 0x6b, 0xc2, 0x72, 0xe4, 0x4c, 0xb3, 0x8d, 0xa3, 0x4c, 0xa3, 0x09, 0xba, 0x03, 0x98, 0x00, 0x98, 0x06, 0xb9, 0x27, 0xc1, 0xa5, 0xb0, 0xc5, 0xb0, 0x02, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x43, 0xb8, 0x63, 0xb8, 0xa5, 0xb8, 0x27, 0xb9, 0xe5, 0xa8, 0x88, 0xa9, 0xa7, 0x91, 0x6a, 0x9a, 0x55, 0xdd, 0xb5, 0xe5, 0xd5, 0xdd, 0xf5, 0xdd, 0x56, 0xe6, 0xf4, 0xd5, 0x93, 0xd5, 0x33, 0xfd, 0x25, 0xa1, 0xe6, 0x98, 0x9b, 0xfe, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x9c, 0xef, 0xff, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x5d, 0xef, 0xae, 0x7b, 0xab, 0x5a, 0xac, 0x62, 0x52, 0x94, 0x32, 0x94, 0x93, 0x9c, 0x93, 0x9c, 0x8f, 0x7b, 0x72, 0x94, 0xb3, 0x9c, 0xb3, 0x9c, 0xb3, 0x9c, 0x92, 0x94, 0x72, 0x94, 0x72, 0x94, 0xb3, 0x9c, 0xb3, 0x9c, 0x72, 0x94, 0x52, 0x8c, 0x11, 0x8c, 0xd0, 0x83, 0xd0, 0x83, 0x93, 0x9c, 0x52, 0x94, 0x72, 0x9c, 0x93, 0xa4, 0x52, 0x94, 0x11, 0x8c, 0x11, 0x94, 0xd0, 0x93, 0x32, 0x9c, 0xd0, 0x8b, 0xd0, 0x83, 0xd4, 0x9c, 0x35, 0xa5, 0xb2, 0x94, 0x71, 0x94, 0x6d, 0x83, 0x27, 0x72, 0xcb, 0xa2, 0xcb, 0xc2, 0xa7, 0xa1, 0x67, 0x91, 0x4a, 0xa2, 0x22, 0x70, 0x83, 0x70, 0xc3, 0x70, 0x23, 0x71, 0x54, 0xf5, 0x54, 0xed, 0x00, 0x78, 0xc4, 0xb0, 0x05, 0xb1, 0x00, 0x78, 0xc5, 0x79, 0xac, 0x8b, 0x2f, 0x74, 0xd2, 0x8c, 0x92, 0x94, 0x6e, 0x8b, 0xed, 0x8a, 0x90, 0xbb, 0x94, 0xec, 0xd5, 0xfc, 0xd1, 0xeb, 0x83, 0x98, 0xa4, 0x98, 0x0c, 0xe3, 0x6d, 0xeb, 0x2b, 0xdb, 0x0c, 0xf3, 0x87, 0xe1, 0x00, 0xb0, 0x26, 0xd1, 0x4a, 0xe2, 0x8a, 0xc2, 0xef, 0xe3, 0x30, 0xec, 0x52, 0xf4, 0x93, 0xfc, 0x73, 0xf4, 0x73, 0xf4, 0x52, 0xf4, 0x8f, 0xeb, 0x6a, 0xd2, 0xe8, 0xc9, 0x45, 0xc1, 0x83, 0xb8, 0xc3, 0xc8, 0x62, 0xc0, 0x62, 0xc8, 0x82, 0xd0, 0xc3, 0xd0, 0xe4, 0xd0, 0x24, 0xd9, 0x45, 0xc9, 0x08, 0xd2, 0xcc, 0xea, 0x0d, 0xfb, 0xcc, 0xfa, 0x8c, 0xfa, 0x6c, 0xfa, 0xad, 0xfa, 0xcd, 0xfa, 0x8b, 0xe2, 0xaf, 0xf3, 0x6d, 0xcb, 0xcd, 0xc3, 0x2b, 0xbb, 0x08, 0xc2, 0xa3, 0xa8, 0x25, 0xb1, 0x49, 0xda, 0x69, 0xe2, 0xe8, 0xe1, 0x25, 0xc9, 0x82, 0xc8, 0x09, 0xfa, 0x45, 0xe1, 0x45, 0xd1, 0x07, 0xea, 0xa6, 0xd1, 0x86, 0xc1, 0xc3, 0xa0, 0x00, 0x78, 0x41, 0x80, 0x00, 0x78, 0x00, 0x60, 0xe4, 0x80, 0x24, 0x79, 0x04, 0x81, 0xa6, 0xa1, 0x65, 0x91, 0xc6, 0xa9, 0x85, 0xa9, 0xe8, 0xd9, 0x06, 0xd1, 0x02, 0x98, 0xf1, 0xdb, 0xb7, 0xdd, 0xff, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x9d, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x9e, 0xf7, 0x3c, 0xe7, 0x45, 0x31, 0x8b, 0x5a, 0x29, 0x4a, 0x42, 0x10, 0x05, 0x29, 0x66, 0x31, 0x63, 0x10, 0x05, 0x29, 0x66, 0x31, 0xe4, 0x20, 0x83, 0x10, 0x83, 0x10, 0x83, 0x18, 0x62, 0x10, 0xa3, 0x10, 0xc4, 0x18, 0xc4, 0x18, 0x83, 0x18, 0xa3, 0x18, 0xa3, 0x18, 0xa4, 0x18, 0xa4, 0x20, 0x00, 0x00, 0x22, 0x10, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00, 0x63, 0x18, 0x05, 0x31, 0xc8, 0x49, 0x46, 0x41, 0xe5, 0x30, 0x43, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4a, 0x48, 0x6a, 0x04, 0x59, 0x8a, 0xa2, 0x66, 0x81, 0x00, 0x38, 0xe5, 0x60, 0x66, 0x71, 0xc7, 0x81, 0xc3, 0x60, 0x00, 0x58, 0x6e, 0xd3, 0xaf, 0xe3, 0x25, 0xa9, 0xa3, 0x88, 0x24, 0x89, 0x8d, 0xc3, 0x73, 0xed, 0x77, 0xd6, 0xd5, 0x95, 0x0f, 0x64, 0x4c, 0x5b, 0x31, 0x94, 0x52, 0xac, 0xed, 0x92, 0x26, 0x71, 0xa8, 0xa1, 0xa8, 0xa9, 0xe4, 0x98, 0xc4, 0x98, 0x01, 0x90, 0x00, 0x88, 0x81, 0x98, 0x00, 0xa0, 0x83, 0xc0, 0x26, 0xe1, 0x25, 0xd1, 0x28, 0xd2, 0xc6, 0xa9, 0x20, 0x80, 0x00, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x60, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x00, 0x78, 0x01, 0x88, 0x00, 0x90, 0x42, 0xa0, 0xc4, 0xb0, 0x05, 0xc1, 0x83, 0xb0, 0x01, 0xa8, 0x62, 0xb0, 0x42, 0xb0, 0x01, 0x98, 0x22, 0x98, 0x22, 0x98, 0x42, 0x98, 0x43, 0xa0, 0x63, 0xa8, 0x84, 0xb8, 0x02, 0xb0, 0x00, 0xa8, 0x66, 0xc9, 0xec, 0xf2, 0x86, 0xb1, 0x60, 0x88, 0x85, 0xa9, 0xa6, 0xc9, 0xc2, 0xb0, 0x40, 0xa0, 0x81, 0xa8, 0xa2, 0xb8, 0x81, 0xb8, 0x21, 0xb8, 0x00, 0xb0, 0x04, 0xd9, 0x40, 0xc0, 0x24, 0xc9, 0xa6, 0xd9, 0x20, 0xa0, 0xa5, 0xb9, 0x68, 0xca, 0x44, 0xa1, 0x00, 0x78, 0x20, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 0x98, 0x87, 0xd9, 0x42, 0xb0, 0xe5, 0xd8, 0x64, 0xd0, 0x43, 0xd0, 0x84, 0xd0, 0x83, 0xa8, 0x46, 0x99, 0x2d, 0x93, 0xdb, 0xf6, 0x9d, 0xff, 0x5c, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x9a, 0xf6, 0xb6, 0xd5, 0xfb, 0xee, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xde, 0x31, 0x8c, 0x4d, 0x73, 0x4a, 0x4a, 0x09, 0x42, 0xa7, 0x39, 0xe8, 0x41, 0x09, 0x4a, 0xe8, 0x41, 0xc8, 0x39, 0xe8, 0x41, 0xc8, 0x39, 0x08, 0x42, 0x4a, 0x4a, 0x4a, 0x4a, 0x09, 0x42, 0xe8, 0x39, 0xe8, 0x39, 0xc8, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0x87, 0x39, 0x46, 0x31, 0x46, 0x31, 0xa7, 0x39, 0x87, 0x39, 0x67, 0x39, 0xe8, 0x49, 0x29, 0x52, 0xe8, 0x49, 0x87, 0x41, 0xe8, 0x49, 0x09, 0x52, 0xe9, 0x49, 0xe9, 0x41, 0xe9, 0x41, 0x09, 0x3a, 0xc7, 0x39, 0x4d, 0x73, 0x2c, 0x7b, 0xa6, 0x61, 0x0c, 0xa3, 0xe7, 0x79, 0x65, 0x51, 0xa2, 0x38, 0x86, 0x69, 0xab, 0xa2, 0xa7, 0x89, 0x01, 0x60, 0x00, 0x68, 0x00, 0x68, 0x25, 0x89, 0xa7, 0x89, 0x89, 0x8a, 0xca, 0x7a, 0x88, 0x6a, 0x45, 0x39, 0x6a, 0x52, 0xec, 0x5a, 0x0d, 0x63, 0x8f, 0x7b, 0x31, 0x94, 0x51, 0xac, 0x31, 0xbc, 0xaf, 0xbb, 0x25, 0x89, 0xc4, 0x98, 0x87, 0xc1, 0xa4, 0xb8, 0xa4, 0xc0, 0x25, 0xd9, 0xc7, 0xe9, 0x25, 0xd1, 0x85, 0xc9, 0x64, 0xb1, 0xe6, 0xb1, 0xea, 0xd2, 0xa6, 0xb9, 0x84, 0xb8, 0x44, 0xc0, 0x24, 0xb0, 0xa6, 0xa8, 0x0a, 0xba, 0x8c, 0xaa, 0x0d, 0xb3, 0xed, 0xb2, 0xac, 0xa2, 0xab, 0x9a, 0xcb, 0xa2, 0x6e, 0xbb, 0x6e, 0xc3, 0xae, 0xcb, 0x0c, 0xbb, 0xec, 0xb2, 0x6e, 0xc3, 0x4e, 0xc3, 0x0d, 0xbb, 0x0d, 0xbb, 0xcc, 0xba, 0x6a, 0xaa, 0xe8, 0xa1, 0xe8, 0xb9, 0x6b, 0xda, 0x05, 0xb9, 0x43, 0xb0, 0x83, 0xb8, 0x05, 0xd1, 0x83, 0xc0, 0xa3, 0xb8, 0x25, 0xd1, 0x24, 0xd1, 0xe3, 0xc8, 0xa2, 0xc0, 0x24, 0xd1, 0xa6, 0xe1, 0xe3, 0xd0, 0x00, 0xc0, 0x62, 0xd0, 0x00, 0xb8, 0x81, 0xd0, 0x00, 0xb8, 0xe6, 0xe1, 0xc6, 0xd9, 0x07, 0xda, 0x08, 0xd2, 0x04, 0xa9, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x80, 0x00, 0x90, 0x22, 0xa8, 0xc9, 0xe9, 0xc5, 0xd0, 0x2b, 0xfa, 0x88, 0xf9, 0xe5, 0xe8, 0x05, 0xd9, 0xc7, 0xc9, 0x6a, 0xba, 0x8a, 0x92, 0x72, 0xc4, 0xf4, 0xcc, 0x72, 0xc4, 0x31, 0xcc, 0x6e, 0xbb, 0xc4, 0x68, 0x00, 0x50, 0xba, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0x1c, 0xe7, 0xab, 0x5a, 0x66, 0x31, 0x4a, 0x52, 0xb3, 0x9c, 0xb4, 0x9c, 0x73, 0x94, 0x11, 0x84, 0x29, 0x4a, 0xc8, 0x39, 0x87, 0x31, 0x6a, 0x52, 0x6a, 0x4a, 0xc8, 0x39, 0x87, 0x29, 0xc8, 0x31, 0xe8, 0x39, 0xe8, 0x41, 0xe8, 0x41, 0xe8, 0x39, 0xe8, 0x41, 0xe8, 0x41, 0x87, 0x39, 0xa7, 0x39, 0x87, 0x31, 0x87, 0x39, 0x09, 0x4a, 0x4a, 0x52, 0xe9, 0x49, 0x66, 0x31, 0xc8, 0x41, 0x08, 0x4a, 0x87, 0x39, 0x47, 0x39, 0x09, 0x4a, 0x2a, 0x4a, 0xa8, 0x39, 0xa7, 0x39, 0xa7, 0x41, 0xc3, 0x30, 0x86, 0x59, 0x6a, 0x8a, 0x69, 0x8a, 0xaa, 0x8a, 0x65, 0x61, 0x86, 0x79, 0xc8, 0x89, 0x25, 0x79, 0x63, 0x78, 0x41, 0x60, 0x01, 0x50, 0x82, 0x48, 0x04, 0x49, 0x24, 0x41, 0x62, 0x10, 0x04, 0x21, 0xc5, 0x30, 0xa5, 0x30, 0x27, 0x39, 0x6a, 0x5a, 0x8b, 0x52, 0xe7, 0x39, 0xc6, 0x39, 0x08, 0x5a, 0x6d, 0x93, 0x69, 0x92, 0x65, 0x89, 0x66, 0xa9, 0x83, 0xa0, 0xa2, 0xa8, 0x86, 0xd9, 0x04, 0xd1, 0xa2, 0xb8, 0xa2, 0xb8, 0x60, 0xa8, 0x07, 0xc2, 0xea, 0xea, 0xc3, 0xb8, 0x02, 0xb0, 0x03, 0xb0, 0x06, 0xb1, 0xf0, 0xeb, 0x35, 0xf5, 0x36, 0xed, 0x57, 0xe5, 0xd5, 0xd4, 0xd4, 0xd4, 0x14, 0xcd, 0xf3, 0xcc, 0x54, 0xd5, 0xd3, 0xc4, 0xf3, 0xcc, 0x92, 0xbc, 0x72, 0xbc, 0xd4, 0xcc, 0xb4, 0xcc, 0x93, 0xd4, 0x93, 0xdc, 0x32, 0xcc, 0x10, 0xc4, 0xef, 0xb3, 0x6c, 0xa3, 0x68, 0x92, 0xe7, 0x99, 0x61, 0x80, 0x00, 0x88, 0x21, 0xa8, 0x42, 0xb8, 0x83, 0xc0, 0x46, 0xe1, 0x00, 0xc0, 0x81, 0xc8, 0x81, 0xc8, 0x82, 0xc0, 0xe3, 0xd0, 0xe3, 0xd8, 0x83, 0xd8, 0x00, 0xc0, 0x21, 0xc8, 0x41, 0xc8, 0x41, 0xc0, 0xa6, 0xd9, 0x85, 0xd9, 0x28, 0xe2, 0xe4, 0xc0, 0x82, 0xa8, 0x82, 0xa8, 0x00, 0x88, 0x00, 0x80, 0x61, 0x88, 0x21, 0x88, 0x62, 0x90, 0xc3, 0xa8, 0x41, 0xa0, 0x66, 0xd1, 0x83, 0xb8, 0x00, 0xa8, 0x40, 0xb0, 0xe3, 0xa8, 0x61, 0x80, 0xaa, 0xa2, 0x76, 0xf5, 0x31, 0xcc, 0xcc, 0xa2, 0xb0, 0xcb, 0xec, 0xb2, 0x6a, 0x9a, 0x14, 0xd5, 0xfb, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0x6a, 0x52, 0x25, 0x29, 0xc7, 0x39, 0x2d, 0x6b, 0x76, 0xb5, 0x76, 0xb5, 0xec, 0x5a, 0x87, 0x31, 0x87, 0x31, 0x8b, 0x52, 0x29, 0x4a, 0x87, 0x31, 0xa7, 0x31, 0x0c, 0x63, 0xec, 0x5a, 0xcb, 0x5a, 0x6e, 0x73, 0xcc, 0x5a, 0x6a, 0x52, 0x4a, 0x4a, 0xe8, 0x41, 0x67, 0x31, 0xe8, 0x41, 0x66, 0x31, 0xc8, 0x41, 0x6a, 0x52, 0xa7, 0x39, 0x67, 0x31, 0x6a, 0x52, 0x0c, 0x63, 0x29, 0x4a, 0x2d, 0x73, 0x6f, 0x7b, 0x4b, 0x5a, 0x0a, 0x4a, 0x6b, 0x52, 0x87, 0x39, 0x66, 0x39, 0x66, 0x41, 0x45, 0x51, 0x49, 0x82, 0xc7, 0x71, 0x45, 0x59, 0x41, 0x48, 0xa3, 0x70, 0x63, 0x78, 0x21, 0x70, 0xe3, 0x70, 0x81, 0x48, 0x44, 0x49, 0xe3, 0x38, 0x04, 0x39, 0xc4, 0x28, 0x46, 0x31, 0x87, 0x31, 0x47, 0x39, 0xa8, 0x49, 0x8c, 0x6a, 0x6b, 0x5a, 0xe8, 0x39, 0xa6, 0x29, 0xa5, 0x29, 0x24, 0x21, 0xe2, 0x28, 0xc6, 0x59, 0xe6, 0x71, 0x03, 0x69, 0xc2, 0x78, 0x65, 0xa9, 0x28, 0xda, 0x00, 0xa8, 0x61, 0xb8, 0x61, 0xb8, 0x41, 0xb0, 0x08, 0xea, 0x8a, 0xfa, 0x46, 0xd1, 0x84, 0xb8, 0x63, 0xa0, 0x29, 0xa2, 0x50, 0xc4, 0x8d, 0x8b, 0x8a, 0x62, 0x6a, 0x5a, 0xe8, 0x49, 0x29, 0x4a, 0x69, 0x52, 0x08, 0x42, 0xe7, 0x39, 0xc6, 0x31, 0xc6, 0x39, 0xa7, 0x39, 0x86, 0x39, 0x87, 0x39, 0x87, 0x41, 0x66, 0x41, 0x25, 0x39, 0x65, 0x31, 0xe7, 0x41, 0x68, 0x52, 0xa8, 0x52, 0x09, 0x6b, 0x84, 0x51, 0xc1, 0x58, 0x81, 0x78, 0x20, 0x88, 0x00, 0x98, 0x41, 0xb0, 0x25, 0xd9, 0xc3, 0xd0, 0x00, 0xb8, 0x41, 0xc8, 0x62, 0xd0, 0x00, 0xc0, 0x21, 0xc8, 0x62, 0xd0, 0x21, 0xd0, 0x20, 0xc8, 0x82, 0xd0, 0x00, 0xb8, 0x69, 0xe2, 0x28, 0xe2, 0x87, 0xe1, 0x84, 0xc8, 0xe4, 0xc0, 0x66, 0xc1, 0x66, 0xb1, 0xe4, 0xa0, 0x00, 0x88, 0x00, 0x68, 0x65, 0xa1, 0xa6, 0xa9, 0x81, 0x90, 0xe2, 0x98, 0x81, 0x90, 0x40, 0x90, 0x00, 0x90, 0x00, 0x90, 0xca, 0xba, 0xf3, 0xdc, 0x5d, 0xff, 0x93, 0xd4, 0x07, 0x89, 0x47, 0x99, 0xea, 0xa1, 0x00, 0x70, 0x14, 0xd5, 0x9e, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x6a, 0x4a, 0x66, 0x31, 0x86, 0x31, 0xdb, 0xde, 0x7a, 0xce, 0xf8, 0xbd, 0x7a, 0xce, 0x29, 0x4a, 0xc8, 0x41, 0x8b, 0x52, 0x87, 0x39, 0x00, 0x00, 0x0d, 0x6b, 0x11, 0x8c, 0xf0, 0x83, 0x77, 0xb5, 0x8f, 0x73, 0x52, 0x8c, 0x46, 0x29, 0xe4, 0x20, 0xab, 0x5a, 0xe8, 0x41, 0x87, 0x31, 0x46, 0x29, 0xcc, 0x62, 0x29, 0x4a, 0x25, 0x29, 0x00, 0x00, 0x8b, 0x5a, 0x49, 0x4a, 0xb3, 0x9c, 0xf0, 0x83, 0x0d, 0x6b, 0xc5, 0x20, 0xa3, 0x18, 0x8b, 0x52, 0xab, 0x52, 0x45, 0x29, 0x86, 0x41, 0x46, 0x49, 0xab, 0x82, 0xe8, 0x69, 0x61, 0x30, 0x21, 0x40, 0x02, 0x70, 0x02, 0x88, 0x01, 0x80, 0x41, 0x68, 0xc2, 0x48, 0x03, 0x39, 0x04, 0x31, 0xc4, 0x38, 0x84, 0x30, 0xc5, 0x30, 0x46, 0x21, 0x66, 0x29, 0x65, 0x31, 0xc8, 0x49, 0xe8, 0x49, 0xa7, 0x29, 0xc7, 0x21, 0xa7, 0x19, 0x46, 0x29, 0x06, 0x31, 0x05, 0x31, 0x25, 0x39, 0x25, 0x41, 0xc4, 0x50, 0x62, 0x70, 0xc2, 0xa0, 0xc2, 0xb0, 0x60, 0x98, 0xa2, 0xb8, 0x82, 0xc0, 0x45, 0xd1, 0x82, 0xb0, 0x63, 0xb8, 0xa5, 0xc0, 0xc6, 0xa8, 0xe3, 0x58, 0xc6, 0x59, 0x64, 0x29, 0x86, 0x31, 0x66, 0x31, 0x45, 0x29, 0x45, 0x29, 0x66, 0x29, 0x65, 0x29, 0x45, 0x21, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x66, 0x31, 0x66, 0x29, 0x04, 0x21, 0x87, 0x31, 0x87, 0x31, 0xe8, 0x39, 0xcf, 0x7b, 0x6d, 0x73, 0x07, 0x6a, 0x40, 0x60, 0x41, 0x88, 0x01, 0x98, 0x01, 0xa8, 0x00, 0xa0, 0x25, 0xc1, 0xa3, 0xb0, 0x62, 0xb8, 0x22, 0xd0, 0x42, 0xe0, 0x00, 0xd0, 0x20, 0xd0, 0x62, 0xd0, 0x82, 0xc8, 0x01, 0xc0, 0x01, 0xb8, 0x62, 0xc0, 0x03, 0xb9, 0xe7, 0xe1, 0xc4, 0xd8, 0x23, 0xc0, 0x83, 0xb0, 0xe4, 0xa0, 0x82, 0x90, 0x29, 0xd2, 0x8b, 0xea, 0x22, 0xb0, 0x25, 0xb9, 0x69, 0xe2, 0xa6, 0xb9, 0x44, 0xb1, 0x44, 0xb1, 0x65, 0xa9, 0xa5, 0xb1, 0xb9, 0xfe, 0x3c, 0xff, 0x7d, 0xff, 0x9b, 0xfe, 0xb4, 0xe4, 0x6c, 0xa2, 0x2b, 0x8a, 0x73, 0xcc, 0xd8, 0xdd, 0x9f, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x29, 0x42, 0x25, 0x21, 0xcb, 0x5a, 0x59, 0xce, 0x72, 0x8c, 0xcf, 0x7b, 0xb7, 0xb5, 0x4e, 0x73, 0x8a, 0x5a, 0xc8, 0x41, 0xe8, 0x49, 0x8b, 0x62, 0x4e, 0x7b, 0xb8, 0xcd, 0xd4, 0xac, 0x11, 0x8c, 0x92, 0x94, 0x97, 0xb5, 0x76, 0xad, 0x11, 0x84, 0x4a, 0x4a, 0x09, 0x42, 0x87, 0x31, 0xe8, 0x41, 0xa8, 0x39, 0x05, 0x21, 0x6a, 0x52, 0xd0, 0x83, 0x04, 0x21, 0x0c, 0x63, 0x92, 0x94, 0xf0, 0x83, 0x09, 0x4a, 0xb8, 0xbd, 0x72, 0x8c, 0x45, 0x19, 0x0c, 0x5b, 0x08, 0x42, 0x24, 0x29, 0x66, 0x49, 0x6a, 0x72, 0x66, 0x51, 0xa1, 0x20, 0x81, 0x38, 0x02, 0x70, 0x02, 0x88, 0x01, 0x88, 0x61, 0x60, 0x03, 0x49, 0x44, 0x31, 0x05, 0x31, 0xc5, 0x38, 0x85, 0x38, 0xc5, 0x30, 0x66, 0x29, 0x85, 0x21, 0x43, 0x19, 0x45, 0x31, 0x46, 0x39, 0x25, 0x21, 0x66, 0x21, 0x66, 0x19, 0x47, 0x31, 0x47, 0x39, 0x87, 0x39, 0x66, 0x31, 0xe3, 0x28, 0x41, 0x38, 0x01, 0x68, 0x62, 0xa0, 0x41, 0xa0, 0x00, 0x78, 0x00, 0x88, 0x61, 0xa8, 0x65, 0xc1, 0x25, 0xb1, 0x02, 0x98, 0x44, 0xa0, 0x26, 0x89, 0x10, 0xb4, 0x8a, 0x5a, 0x65, 0x29, 0x86, 0x31, 0x66, 0x29, 0x45, 0x29, 0x45, 0x29, 0x66, 0x31, 0x66, 0x29, 0x66, 0x29, 0x66, 0x31, 0x66, 0x31, 0x66, 0x29, 0x66, 0x29, 0x66, 0x29, 0x86, 0x31, 0x86, 0x31, 0x87, 0x31, 0x87, 0x39, 0x67, 0x31, 0xc5, 0x20, 0x67, 0x31, 0x92, 0xa4, 0xcb, 0x82, 0xc3, 0x70, 0x42, 0x90, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x88, 0xa2, 0xa0, 0x63, 0xa0, 0xc4, 0xc0, 0x83, 0xc8, 0x42, 0xd8, 0x00, 0xd8, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xb8, 0x82, 0xc0, 0xa2, 0xb8, 0x20, 0xa8, 0x65, 0xd1, 0xa2, 0xb0, 0x43, 0xc8, 0x84, 0xc0, 0xcb, 0xe2, 0x89, 0xc2, 0x65, 0x99, 0x82, 0xa0, 0xa8, 0xe1, 0xe9, 0xf1, 0x42, 0xc0, 0x45, 0xc9, 0xa6, 0xc1, 0x69, 0xda, 0x28, 0xd2, 0x24, 0xa9, 0x0c, 0xc3, 0xf3, 0xec, 0xb2, 0xcc, 0x92, 0xcc, 0x8e, 0xa3, 0x8c, 0x92, 0x8d, 0x92, 0x4f, 0x9b, 0xd8, 0xd5, 0xd8, 0xbd, 0x1c, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x09, 0x42, 0x25, 0x29, 0x08, 0x42, 0x51, 0x84, 0xcf, 0x7b, 0x8e, 0x73, 0x4d, 0x6b, 0x8b, 0x5a, 0x29, 0x4a, 0x66, 0x31, 0x66, 0x39, 0xf4, 0xac, 0x36, 0xbd, 0x15, 0xb5, 0xd4, 0xac, 0x97, 0xbd, 0xd4, 0x9c, 0x76, 0xad, 0xf8, 0xbd, 0xf0, 0x83, 0x66, 0x29, 0x4e, 0x6b, 0x46, 0x29, 0x6a, 0x52, 0x4a, 0x52, 0x87, 0x39, 0x46, 0x31, 0x31, 0x8c, 0x15, 0xa5, 0x76, 0xb5, 0x96, 0xb5, 0xb7, 0xbd, 0x97, 0xbd, 0x76, 0xb5, 0x11, 0x84, 0xa7, 0x29, 0x2c, 0x5b, 0xcb, 0x5a, 0xe3, 0x20, 0x86, 0x49, 0xa7, 0x59, 0x82, 0x38, 0xe2, 0x20, 0xc2, 0x28, 0x42, 0x58, 0x22, 0x78, 0x21, 0x70, 0xa2, 0x58, 0x44, 0x41, 0x64, 0x29, 0xe4, 0x20, 0xc5, 0x30, 0xa5, 0x38, 0xa5, 0x28, 0x66, 0x29, 0xc6, 0x21, 0x85, 0x19, 0x45, 0x39, 0x25, 0x41, 0x05, 0x39, 0x66, 0x39, 0x66, 0x39, 0x04, 0x39, 0xa2, 0x30, 0xe2, 0x38, 0x43, 0x49, 0x22, 0x49, 0xc2, 0x60, 0xc3, 0x90, 0x86, 0xd9, 0xa2, 0xb8, 0x40, 0x90, 0x81, 0x90, 0x24, 0x99, 0x85, 0x99, 0x86, 0x91, 0x42, 0x70, 0xc5, 0x80, 0x8b, 0x9a, 0x31, 0xac, 0xa6, 0x31, 0x65, 0x29, 0x86, 0x31, 0x66, 0x31, 0x66, 0x29, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x31, 0x66, 0x31, 0x86, 0x31, 0x66, 0x29, 0xc7, 0x39, 0x05, 0x29, 0x47, 0x31, 0xea, 0x49, 0x63, 0x08, 0x4d, 0x7b, 0x0c, 0x8b, 0x65, 0x81, 0xc3, 0x98, 0x83, 0xa8, 0x83, 0xb0, 0x82, 0xa0, 0x45, 0xb1, 0x00, 0x88, 0xa3, 0xa8, 0x62, 0xa8, 0x41, 0xb8, 0x41, 0xc8, 0x00, 0xc8, 0x21, 0xc8, 0x62, 0xc0, 0x00, 0xa0, 0x00, 0x80, 0x04, 0xa1, 0x45, 0xd1, 0x62, 0xc8, 0xe5, 0xc8, 0xa8, 0xd1, 0x8e, 0xd3, 0x91, 0xe4, 0x00, 0x70, 0x41, 0x90, 0x62, 0xb0, 0x01, 0xb8, 0x25, 0xd1, 0xe8, 0xd9, 0x86, 0xb9, 0x86, 0xb1, 0xe4, 0xa8, 0x01, 0x90, 0x05, 0x99, 0xec, 0xba, 0x29, 0x8a, 0x66, 0x69, 0x6a, 0x82, 0x4b, 0x82, 0xa8, 0x61, 0x2a, 0x62, 0x6e, 0x73, 0xcb, 0x42, 0x71, 0x74, 0x79, 0xbe, 0xbe, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x09, 0x42, 0x66, 0x31, 0xc7, 0x39, 0xec, 0x5a, 0xcf, 0x7b, 0xcf, 0x7b, 0x86, 0x31, 0x08, 0x42, 0xab, 0x5a, 0x66, 0x31, 0xc4, 0x20, 0x8b, 0x5a, 0x56, 0xbd, 0x6f, 0x7b, 0x8b, 0x62, 0x6e, 0x73, 0x00, 0x00, 0xf0, 0x7b, 0x72, 0x8c, 0x09, 0x42, 0x09, 0x42, 0x11, 0x84, 0xe8, 0x39, 0xec, 0x62, 0xa8, 0x39, 0x67, 0x31, 0x25, 0x29, 0xcc, 0x62, 0xd4, 0x9c, 0xcb, 0x5a, 0xd4, 0xa4, 0x29, 0x4a, 0x35, 0xad, 0x72, 0x94, 0xe8, 0x39, 0x04, 0x19, 0x8e, 0x6b, 0xae, 0x73, 0xa2, 0x20, 0x86, 0x49, 0x45, 0x49, 0x62, 0x30, 0x03, 0x21, 0xc2, 0x28, 0x62, 0x50, 0x42, 0x70, 0x42, 0x70, 0xe3, 0x50, 0x64, 0x41, 0x64, 0x29, 0xe4, 0x18, 0xa4, 0x28, 0xa5, 0x30, 0xa4, 0x28, 0x25, 0x21, 0xa6, 0x29, 0x65, 0x29, 0x25, 0x39, 0x05, 0x41, 0xe3, 0x40, 0x44, 0x49, 0x24, 0x51, 0x24, 0x79, 0xc3, 0x80, 0x03, 0x89, 0x84, 0x89, 0x43, 0x89, 0x81, 0x98, 0x62, 0xb0, 0xe4, 0xd0, 0x42, 0xb0, 0xa2, 0x98, 0x85, 0x91, 0xe3, 0x68, 0x60, 0x48, 0x82, 0x48, 0xe4, 0x50, 0x00, 0x38, 0xaf, 0x9b, 0xa6, 0x49, 0x03, 0x21, 0x64, 0x21, 0xa6, 0x31, 0xa7, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x29, 0xe8, 0x39, 0x87, 0x39, 0x26, 0x31, 0xea, 0x41, 0x87, 0x31, 0x86, 0x39, 0x28, 0x6a, 0x04, 0x71, 0x00, 0x80, 0x21, 0x90, 0x21, 0x98, 0x41, 0x90, 0xa3, 0x90, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x60, 0xa0, 0x61, 0xb0, 0x20, 0xb8, 0x21, 0xb8, 0x41, 0xa8, 0x62, 0xa0, 0x04, 0xa9, 0xab, 0xf2, 0x86, 0xd9, 0x42, 0xc8, 0xc9, 0xd1, 0x87, 0xa1, 0x89, 0xa2, 0x4c, 0xb3, 0x00, 0x50, 0x20, 0x88, 0x41, 0xa8, 0x41, 0xb8, 0x25, 0xd1, 0x25, 0xc1, 0x00, 0x90, 0x00, 0x80, 0x21, 0x80, 0x01, 0x80, 0x84, 0x90, 0xc8, 0x99, 0xc3, 0x58, 0x49, 0x7a, 0x0c, 0x93, 0x2e, 0x93, 0x4e, 0x93, 0x6e, 0x83, 0xaf, 0x73, 0x4c, 0x53, 0x71, 0x74, 0x34, 0x95, 0x55, 0xa5, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x29, 0x42, 0xa7, 0x31, 0xc7, 0x39, 0x86, 0x31, 0xe8, 0x39, 0x29, 0x4a, 0xa7, 0x31, 0xab, 0x5a, 0xab, 0x5a, 0xe8, 0x41, 0x66, 0x31, 0x00, 0x00, 0x72, 0x9c, 0x31, 0x94, 0x67, 0x39, 0x05, 0x29, 0x8e, 0x6b, 0xd4, 0x9c, 0xaf, 0x73, 0x00, 0x00, 0x29, 0x4a, 0x31, 0x8c, 0xcc, 0x5a, 0xe8, 0x39, 0x2a, 0x4a, 0x29, 0x4a, 0x00, 0x00, 0x09, 0x4a, 0xb3, 0x9c, 0x4e, 0x6b, 0x00, 0x00, 0x2d, 0x6b, 0xf0, 0x83, 0x6e, 0x73, 0xe4, 0x18, 0xa3, 0x08, 0x71, 0x84, 0x51, 0x8c, 0x00, 0x00, 0x65, 0x41, 0xa7, 0x59, 0x21, 0x30, 0xc3, 0x28, 0xa2, 0x30, 0x42, 0x58, 0x43, 0x70, 0x63, 0x70, 0xe3, 0x58, 0x64, 0x41, 0x65, 0x29, 0x04, 0x21, 0xc4, 0x28, 0xc4, 0x30, 0xe4, 0x28, 0x24, 0x21, 0x45, 0x31, 0x25, 0x41, 0x05, 0x51, 0x25, 0x61, 0xe3, 0x60, 0x44, 0x79, 0x44, 0x91, 0x82, 0x98, 0xc3, 0xc0, 0x04, 0xd1, 0xa2, 0xc0, 0x41, 0xb8, 0x82, 0xc8, 0xc3, 0xd8, 0xe4, 0xc8, 0x26, 0xc1, 0x45, 0xa1, 0xa6, 0x79, 0x60, 0x28, 0x44, 0x39, 0x04, 0x29, 0x66, 0x31, 0x00, 0x00, 0xec, 0x62, 0x29, 0x52, 0x03, 0x21, 0xa5, 0x29, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0x86, 0x31, 0x66, 0x31, 0x66, 0x29, 0x66, 0x29, 0x86, 0x31, 0x86, 0x31, 0xa7, 0x31, 0x86, 0x31, 0x66, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xc8, 0x41, 0xa8, 0x41, 0x26, 0x29, 0x87, 0x31, 0xa7, 0x41, 0xc7, 0x61, 0x24, 0x71, 0x00, 0x78, 0x00, 0x88, 0x00, 0x80, 0x00, 0x78, 0x00, 0x78, 0x01, 0x78, 0x00, 0x70, 0x20, 0x80, 0xe2, 0xa0, 0x60, 0x98, 0x00, 0x98, 0x00, 0x90, 0x00, 0x70, 0x21, 0x88, 0x82, 0x90, 0xc7, 0xc9, 0x05, 0xd1, 0x63, 0xc8, 0xc8, 0xb9, 0x25, 0x81, 0xe3, 0x68, 0x60, 0x50, 0x40, 0x68, 0xa6, 0xb9, 0x40, 0xa8, 0x41, 0xb8, 0x21, 0xb0, 0x01, 0xa0, 0x21, 0x90, 0x00, 0x78, 0x01, 0x78, 0x42, 0x80, 0x05, 0x99, 0x83, 0x60, 0x41, 0x40, 0xe7, 0x61, 0x6a, 0x6a, 0x8b, 0x72, 0x8b, 0x6a, 0xec, 0x6a, 0x4d, 0x63, 0x2c, 0x5b, 0xcf, 0x6b, 0xcf, 0x7b, 0x6e, 0x73, 0x51, 0x8c, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x09, 0x42, 0x87, 0x31, 0xa7, 0x39, 0xe4, 0x20, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x10, 0xc7, 0x39, 0x8a, 0x52, 0x49, 0x52, 0xe8, 0x41, 0x25, 0x31, 0xb3, 0xa4, 0x92, 0x9c, 0xa7, 0x41, 0xc8, 0x41, 0xb3, 0x94, 0x97, 0xb5, 0xd4, 0x9c, 0xa7, 0x31, 0x6e, 0x73, 0xb3, 0x9c, 0x09, 0x42, 0x09, 0x42, 0xab, 0x5a, 0x46, 0x29, 0x09, 0x4a, 0x56, 0xad, 0x15, 0xa5, 0x76, 0xb5, 0x8e, 0x73, 0x10, 0x84, 0xf8, 0xc5, 0xf1, 0x83, 0x42, 0x00, 0x6a, 0x4a, 0xd3, 0x94, 0xef, 0x7b, 0x00, 0x00, 0x45, 0x41, 0xa6, 0x51, 0x01, 0x30, 0x63, 0x38, 0x23, 0x48, 0x03, 0x60, 0x23, 0x78, 0x63, 0x78, 0xa3, 0x60, 0x24, 0x49, 0x25, 0x31, 0x25, 0x31, 0xc4, 0x30, 0xa4, 0x30, 0x05, 0x31, 0x04, 0x29, 0x82, 0x30, 0x22, 0x50, 0x64, 0x80, 0xa5, 0x98, 0x64, 0xa8, 0x25, 0xc1, 0x65, 0xd1, 0xaa, 0xfa, 0xea, 0xfa, 0x27, 0xda, 0x02, 0xb9, 0x44, 0xc1, 0x45, 0xd9, 0xc4, 0xc8, 0xc3, 0xa8, 0x25, 0xa9, 0xe4, 0x80, 0x24, 0x49, 0x81, 0x10, 0x45, 0x29, 0x25, 0x21, 0xa7, 0x21, 0x25, 0x09, 0xaa, 0x42, 0x09, 0x4a, 0xc2, 0x18, 0xc6, 0x29, 0x86, 0x29, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x29, 0x66, 0x29, 0x66, 0x29, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x31, 0x66, 0x31, 0x86, 0x31, 0x66, 0x29, 0x87, 0x31, 0xc9, 0x41, 0xa8, 0x39, 0x87, 0x31, 0x45, 0x31, 0x45, 0x49, 0x24, 0x69, 0x01, 0x70, 0x00, 0x80, 0x00, 0x70, 0x21, 0x70, 0x00, 0x60, 0x21, 0x68, 0x21, 0x78, 0x21, 0x88, 0x82, 0x98, 0x40, 0x90, 0x00, 0x78, 0x20, 0x70, 0x00, 0x58, 0x41, 0x80, 0xa3, 0xa0, 0x01, 0xa0, 0x26, 0xd1, 0xe5, 0xc0, 0xc8, 0xa9, 0xc8, 0x89, 0x00, 0x48, 0x20, 0x58, 0x00, 0x70, 0x27, 0xd2, 0x20, 0xa8, 0x62, 0xc0, 0x21, 0xa8, 0x00, 0x98, 0x00, 0x80, 0x00, 0x58, 0x63, 0x70, 0x05, 0x81, 0x62, 0x68, 0x00, 0x30, 0xe2, 0x38, 0xe2, 0x20, 0xe7, 0x41, 0x86, 0x41, 0x66, 0x41, 0xa7, 0x41, 0xa7, 0x31, 0x86, 0x31, 0x66, 0x31, 0xa8, 0x49, 0xc8, 0x51, 0x08, 0x4a, 0x69, 0x4a, 0xf8, 0xc5, 0xff, 0xff, 0xdf, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xe8, 0x41, 0x66, 0x31, 0x45, 0x29, 0xcb, 0x5a, 0xb3, 0x9c, 0x92, 0x94, 0x4d, 0x6b, 0x46, 0x29, 0x6a, 0x52, 0x4a, 0x52, 0x49, 0x4a, 0x00, 0x00, 0x31, 0x8c, 0x72, 0x94, 0x00, 0x00, 0x86, 0x31, 0x49, 0x42, 0x11, 0x84, 0xf0, 0x7b, 0x87, 0x31, 0x31, 0x84, 0x52, 0x8c, 0xc3, 0x18, 0x4a, 0x4a, 0x2a, 0x4a, 0xcc, 0x5a, 0x05, 0x29, 0x31, 0x8c, 0x93, 0x94, 0x11, 0x84, 0xc7, 0x39, 0x8b, 0x5a, 0xcc, 0x5a, 0x11, 0x84, 0xaf, 0x73, 0xcb, 0x52, 0xd3, 0x94, 0xcb, 0x5a, 0x82, 0x18, 0x66, 0x49, 0x04, 0x41, 0x42, 0x38, 0x43, 0x40, 0x03, 0x48, 0x03, 0x60, 0x44, 0x78, 0x84, 0x70, 0xa4, 0x58, 0xe4, 0x48, 0x04, 0x31, 0x25, 0x39, 0xa4, 0x30, 0x63, 0x30, 0x45, 0x49, 0x03, 0x39, 0x21, 0x48, 0x84, 0x78, 0x67, 0xb1, 0xe9, 0xd1, 0xe9, 0xe1, 0x8a, 0xfa, 0x2c, 0xfb, 0x07, 0xda, 0xc5, 0xc9, 0x23, 0xa9, 0x85, 0xb1, 0x89, 0xd2, 0x86, 0xc1, 0x00, 0x78, 0x00, 0x68, 0x20, 0x68, 0x01, 0x50, 0x04, 0x31, 0xa6, 0x29, 0x05, 0x19, 0x67, 0x21, 0x26, 0x19, 0xe4, 0x00, 0x0d, 0x4b, 0xc4, 0x28, 0x86, 0x39, 0x64, 0x21, 0x45, 0x29, 0x86, 0x31, 0xa7, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x31, 0x66, 0x31, 0x25, 0x21, 0xa7, 0x31, 0xa7, 0x39, 0x06, 0x29, 0x67, 0x31, 0x87, 0x31, 0x86, 0x31, 0xa6, 0x51, 0xc7, 0x79, 0xa3, 0x80, 0x42, 0x80, 0x00, 0x70, 0x62, 0x70, 0x21, 0x60, 0x00, 0x58, 0x42, 0x80, 0x00, 0x80, 0x00, 0x88, 0x20, 0x88, 0x80, 0x70, 0x60, 0x58, 0x81, 0x60, 0x00, 0x68, 0xa4, 0x98, 0x01, 0x98, 0x62, 0xa8, 0x45, 0xc1, 0xac, 0xc2, 0x22, 0x60, 0x00, 0x60, 0x00, 0x68, 0x61, 0x90, 0x00, 0x88, 0xe3, 0xc0, 0x20, 0xb0, 0x21, 0xb0, 0xa7, 0xc9, 0xe9, 0xc1, 0x00, 0x68, 0x00, 0x50, 0x01, 0x58, 0x62, 0x50, 0x81, 0x38, 0xc1, 0x18, 0xe6, 0x39, 0x03, 0x19, 0x66, 0x31, 0x45, 0x31, 0x46, 0x31, 0x25, 0x29, 0x86, 0x39, 0x05, 0x39, 0xa5, 0x40, 0xa5, 0x40, 0x04, 0x29, 0xe3, 0x18, 0x69, 0x4a, 0xf8, 0xc5, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x0c, 0x63, 0x87, 0x31, 0xa7, 0x31, 0xec, 0x62, 0xd3, 0x9c, 0x35, 0xa5, 0xcb, 0x5a, 0xc4, 0x18, 0x08, 0x42, 0x8a, 0x52, 0xcb, 0x5a, 0xc4, 0x20, 0x2d, 0x6b, 0x72, 0x94, 0x2d, 0x6b, 0x2d, 0x63, 0x4e, 0x6b, 0xf0, 0x7b, 0xab, 0x52, 0x8f, 0x73, 0x72, 0x8c, 0xec, 0x62, 0xc4, 0x18, 0x66, 0x31, 0x09, 0x42, 0xec, 0x62, 0xe8, 0x41, 0x00, 0x00, 0x31, 0x8c, 0xcc, 0x5a, 0x8a, 0x52, 0x6e, 0x73, 0x31, 0x8c, 0x8f, 0x73, 0x8b, 0x52, 0x10, 0x7c, 0x10, 0x7c, 0x65, 0x29, 0x45, 0x31, 0x86, 0x49, 0x66, 0x51, 0x42, 0x38, 0xc4, 0x38, 0xa4, 0x40, 0x84, 0x58, 0x83, 0x58, 0xa3, 0x58, 0x04, 0x51, 0x45, 0x49, 0x45, 0x39, 0x46, 0x41, 0xc4, 0x40, 0x00, 0x18, 0x2d, 0x9b, 0xaa, 0x8a, 0x00, 0x60, 0x49, 0xb2, 0x6d, 0xdb, 0xef, 0xeb, 0x8d, 0xe3, 0x6c, 0xeb, 0x43, 0xa9, 0xc2, 0xa0, 0x61, 0x88, 0x24, 0x99, 0xe8, 0xa9, 0xe8, 0xa1, 0x26, 0x71, 0xc3, 0x58, 0x20, 0x38, 0x41, 0x40, 0x41, 0x40, 0x24, 0x29, 0xc7, 0x29, 0x06, 0x21, 0x48, 0x29, 0xe6, 0x18, 0x67, 0x19, 0xec, 0x52, 0x26, 0x39, 0x45, 0x31, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xe8, 0x39, 0xc7, 0x39, 0x86, 0x31, 0x66, 0x31, 0x66, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0x66, 0x31, 0x47, 0x31, 0x67, 0x31, 0x87, 0x31, 0x45, 0x29, 0xa6, 0x51, 0x04, 0x59, 0x22, 0x68, 0x00, 0x68, 0x21, 0x70, 0x82, 0x68, 0xa2, 0x60, 0x00, 0x60, 0x01, 0x78, 0x01, 0x88, 0x62, 0x98, 0x00, 0x70, 0xe3, 0x78, 0x44, 0x79, 0x40, 0x50, 0x00, 0x50, 0x42, 0x78, 0x21, 0x88, 0x25, 0xb1, 0xc3, 0xa8, 0x6b, 0xc2, 0x88, 0xa1, 0x02, 0x80, 0x00, 0x88, 0x82, 0xa8, 0x82, 0xb0, 0x00, 0xa0, 0x00, 0xa8, 0xe4, 0xb8, 0x09, 0xd2, 0xc4, 0x98, 0x42, 0x70, 0x01, 0x58, 0x42, 0x58, 0x00, 0x40, 0x82, 0x38, 0x02, 0x29, 0xe2, 0x08, 0x64, 0x21, 0x45, 0x29, 0x25, 0x29, 0x25, 0x29, 0x25, 0x29, 0x25, 0x29, 0x05, 0x31, 0xc5, 0x40, 0xc5, 0x40, 0x25, 0x31, 0xa6, 0x31, 0x28, 0x42, 0xcf, 0x7b, 0x92, 0x94, 0xef, 0x7b, 0x71, 0x8c, 0xb2, 0x94, 0x18, 0xc6, 0x5d, 0xef, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x0c, 0x63, 0x46, 0x29, 0x25, 0x21, 0xdb, 0xde, 0x7a, 0xce, 0x55, 0xad, 0xd7, 0xbd, 0x0c, 0x63, 0x25, 0x29, 0x29, 0x4a, 0x29, 0x42, 0xe8, 0x39, 0xab, 0x5a, 0x6e, 0x6b, 0x31, 0x8c, 0xf4, 0xa4, 0x31, 0x84, 0x2d, 0x63, 0x0d, 0x63, 0xf0, 0x7b, 0x4e, 0x6b, 0x25, 0x29, 0x25, 0x21, 0xc8, 0x39, 0xc8, 0x39, 0x6a, 0x52, 0x6a, 0x52, 0xc8, 0x41, 0x0d, 0x63, 0xd0, 0x7b, 0x31, 0x8c, 0x93, 0x94, 0xd0, 0x83, 0x2d, 0x6b, 0x6e, 0x6b, 0x10, 0x7c, 0x49, 0x42, 0x04, 0x21, 0x65, 0x31, 0x86, 0x49, 0x45, 0x49, 0x00, 0x30, 0x25, 0x39, 0x45, 0x29, 0x24, 0x31, 0xe3, 0x38, 0xe2, 0x38, 0x23, 0x39, 0x65, 0x41, 0x65, 0x41, 0xc4, 0x38, 0x26, 0x59, 0x83, 0x50, 0xe4, 0x70, 0xa7, 0x89, 0xc3, 0x90, 0x69, 0xca, 0x8d, 0xf3, 0x03, 0xb1, 0xe3, 0xb0, 0x07, 0xc2, 0x04, 0x99, 0x40, 0x68, 0xc2, 0x68, 0xc2, 0x58, 0x00, 0x30, 0x22, 0x30, 0x87, 0x49, 0xe8, 0x49, 0xa0, 0x20, 0x40, 0x28, 0x00, 0x20, 0x2d, 0x6b, 0xab, 0x52, 0x47, 0x31, 0xaa, 0x49, 0x89, 0x39, 0xad, 0x52, 0xd1, 0x7b, 0x06, 0x39, 0xc4, 0x28, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x31, 0x66, 0x31, 0xc7, 0x39, 0xa7, 0x31, 0x66, 0x31, 0x45, 0x29, 0x45, 0x29, 0x66, 0x31, 0x85, 0x29, 0x65, 0x29, 0x66, 0x31, 0x46, 0x31, 0x67, 0x31, 0x87, 0x31, 0x45, 0x29, 0xa7, 0x49, 0xc3, 0x48, 0x00, 0x50, 0x00, 0x60, 0x21, 0x60, 0x62, 0x50, 0x62, 0x58, 0xe5, 0x88, 0x25, 0x99, 0x00, 0x78, 0x41, 0x80, 0x82, 0x80, 0x04, 0x81, 0x49, 0xa2, 0x04, 0x69, 0x00, 0x48, 0x00, 0x50, 0x61, 0x70, 0x24, 0xa9, 0xe3, 0xa8, 0x02, 0x90, 0x23, 0x90, 0x02, 0x98, 0x22, 0xa8, 0x63, 0xb0, 0x62, 0xb0, 0x20, 0xa0, 0x21, 0xa0, 0x21, 0x98, 0x83, 0xa0, 0x21, 0x88, 0x00, 0x68, 0x82, 0x68, 0xc4, 0x70, 0x63, 0x60, 0x62, 0x40, 0xc2, 0x28, 0x03, 0x21, 0x65, 0x29, 0x45, 0x29, 0x25, 0x29, 0x45, 0x29, 0x65, 0x21, 0x65, 0x21, 0x45, 0x29, 0x05, 0x31, 0x05, 0x39, 0x25, 0x29, 0x86, 0x31, 0x49, 0x4a, 0x8e, 0x73, 0x2c, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x51, 0x8c, 0x9e, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xef, 0x0d, 0x63, 0xe4, 0x18, 0xcb, 0x5a, 0xbb, 0xde, 0x92, 0x94, 0xf0, 0x83, 0x18, 0xc6, 0x4d, 0x6b, 0xe4, 0x18, 0x86, 0x31, 0xe8, 0x41, 0xab, 0x52, 0x49, 0x4a, 0xa7, 0x31, 0x28, 0x42, 0x8a, 0x52, 0x29, 0x42, 0xab, 0x52, 0x6e, 0x6b, 0xcb, 0x5a, 0x46, 0x29, 0x25, 0x29, 0x66, 0x31, 0x87, 0x31, 0x66, 0x31, 0xc8, 0x39, 0x4a, 0x52, 0x6a, 0x52, 0x09, 0x42, 0x29, 0x42, 0x8a, 0x52, 0x8b, 0x5a, 0xcc, 0x62, 0x2d, 0x6b, 0xec, 0x5a, 0x6a, 0x4a, 0x82, 0x00, 0xe7, 0x39, 0xe7, 0x41, 0x45, 0x41, 0x66, 0x51, 0x6a, 0x6a, 0x07, 0x3a, 0xa9, 0x3a, 0x68, 0x3a, 0x84, 0x21, 0x63, 0x29, 0xa4, 0x31, 0x64, 0x31, 0x45, 0x41, 0x45, 0x51, 0x05, 0x61, 0x83, 0x68, 0x00, 0x68, 0xc4, 0x98, 0xa2, 0xa0, 0x41, 0xb0, 0x86, 0xd1, 0xa3, 0xb0, 0x01, 0xb0, 0x02, 0xa8, 0x02, 0x90, 0x61, 0x58, 0x20, 0x20, 0xa1, 0x10, 0x25, 0x21, 0x05, 0x19, 0x66, 0x21, 0xe7, 0x29, 0x02, 0x19, 0x81, 0x10, 0x00, 0x00, 0x14, 0xad, 0x6f, 0x7b, 0xa8, 0x49, 0xee, 0x72, 0xad, 0x62, 0xee, 0x6a, 0xb0, 0x7b, 0x26, 0x31, 0xe4, 0x28, 0x05, 0x21, 0x45, 0x29, 0x66, 0x29, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x66, 0x29, 0x45, 0x29, 0xc7, 0x39, 0xa7, 0x31, 0x66, 0x31, 0x45, 0x29, 0x45, 0x29, 0x66, 0x29, 0x65, 0x29, 0x45, 0x29, 0x46, 0x31, 0x46, 0x31, 0x67, 0x31, 0x67, 0x29, 0x05, 0x21, 0xc7, 0x49, 0x25, 0x51, 0xa3, 0x60, 0x42, 0x60, 0x01, 0x50, 0x82, 0x48, 0x25, 0x69, 0x05, 0x91, 0xe9, 0xb9, 0xc3, 0x80, 0x20, 0x70, 0xa2, 0x88, 0x21, 0x78, 0x66, 0x91, 0xc3, 0x60, 0x00, 0x40, 0x00, 0x48, 0x20, 0x58, 0xe3, 0xa0, 0x04, 0xb9, 0xe4, 0xb8, 0x84, 0xb0, 0x02, 0xa8, 0x00, 0xa8, 0x01, 0xa8, 0x62, 0xa8, 0xa2, 0xa0, 0x61, 0x90, 0x00, 0x88, 0x00, 0x88, 0x42, 0x90, 0x82, 0x80, 0xa7, 0x99, 0x67, 0x91, 0x64, 0x70, 0x22, 0x48, 0x62, 0x30, 0xe3, 0x28, 0x45, 0x31, 0x25, 0x29, 0x25, 0x29, 0x45, 0x21, 0x65, 0x19, 0x85, 0x11, 0x65, 0x19, 0x45, 0x21, 0x45, 0x29, 0x45, 0x29, 0x04, 0x21, 0xa7, 0x39, 0x2d, 0x6b, 0x8e, 0x73, 0x28, 0x42, 0xa7, 0x39, 0x45, 0x29, 0x49, 0x4a, 0xeb, 0x5a, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x2d, 0x6b, 0xe4, 0x20, 0x29, 0x4a, 0xf0, 0x83, 0x10, 0x84, 0xcf, 0x7b, 0x4d, 0x6b, 0x86, 0x31, 0x25, 0x21, 0xe8, 0x39, 0x86, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0x29, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x8b, 0x52, 0x6a, 0x4a, 0xe8, 0x39, 0x25, 0x29, 0xe4, 0x20, 0x25, 0x21, 0x09, 0x42, 0xc8, 0x39, 0xa7, 0x39, 0x46, 0x31, 0x66, 0x31, 0x09, 0x4a, 0x29, 0x4a, 0x6a, 0x4a, 0x8a, 0x52, 0x8b, 0x52, 0x6a, 0x52, 0xe8, 0x41, 0x66, 0x29, 0x66, 0x29, 0x86, 0x29, 0xa6, 0x31, 0x65, 0x31, 0x86, 0x49, 0xa7, 0x59, 0xa6, 0x59, 0x44, 0x29, 0xa5, 0x21, 0x06, 0x32, 0xc5, 0x29, 0x01, 0x19, 0x02, 0x29, 0xa5, 0x41, 0x04, 0x41, 0x25, 0x59, 0x83, 0x60, 0x83, 0x78, 0x45, 0xa9, 0xc7, 0xc9, 0xe8, 0xe1, 0x82, 0xb0, 0x00, 0x88, 0x25, 0xb1, 0x42, 0x98, 0x00, 0x78, 0xa5, 0x88, 0x64, 0x68, 0xe9, 0x71, 0xc8, 0x59, 0x84, 0x30, 0xe5, 0x38, 0x67, 0x29, 0x04, 0x11, 0x24, 0x21, 0xe3, 0x18, 0x00, 0x00, 0xd4, 0xac, 0xab, 0x6a, 0xa4, 0x28, 0x4a, 0x5a, 0x09, 0x4a, 0xe9, 0x49, 0xec, 0x62, 0x66, 0x29, 0x87, 0x31, 0xa7, 0x39, 0xc8, 0x39, 0xe8, 0x39, 0x08, 0x42, 0x08, 0x42, 0xe8, 0x41, 0xc7, 0x39, 0xc7, 0x39, 0x08, 0x42, 0xe8, 0x41, 0xc7, 0x39, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0xe7, 0x39, 0x48, 0x42, 0x29, 0x4a, 0x2a, 0x4a, 0x2a, 0x4a, 0x0a, 0x42, 0xc8, 0x31, 0xa7, 0x41, 0x04, 0x51, 0x82, 0x58, 0x21, 0x58, 0x00, 0x48, 0x62, 0x40, 0xe4, 0x58, 0x22, 0x70, 0x25, 0x89, 0x65, 0x91, 0x81, 0x78, 0x00, 0x58, 0x00, 0x78, 0xc4, 0x88, 0x42, 0x70, 0x00, 0x40, 0x00, 0x48, 0x00, 0x48, 0x04, 0xa1, 0x24, 0xc1, 0xc3, 0xb8, 0x62, 0xb8, 0x01, 0xb8, 0x01, 0xb8, 0x01, 0xa8, 0x41, 0x98, 0x62, 0x88, 0x21, 0x78, 0x00, 0x78, 0x00, 0x80, 0x21, 0x90, 0x41, 0x88, 0x65, 0xa1, 0x05, 0x89, 0x02, 0x60, 0x22, 0x48, 0x82, 0x30, 0xc3, 0x28, 0x25, 0x31, 0x05, 0x31, 0x05, 0x29, 0x25, 0x21, 0x65, 0x19, 0x85, 0x11, 0x85, 0x11, 0x45, 0x19, 0x44, 0x21, 0x25, 0x29, 0x45, 0x29, 0xe7, 0x39, 0xcb, 0x5a, 0xeb, 0x5a, 0xc7, 0x39, 0xc3, 0x18, 0x62, 0x10, 0x29, 0x4a, 0x8a, 0x52, 0x14, 0xa5, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x6e, 0x6b, 0x25, 0x29, 0x25, 0x29, 0xec, 0x62, 0x72, 0x8c, 0x0c, 0x63, 0x08, 0x42, 0x08, 0x42, 0x45, 0x29, 0xc7, 0x39, 0x86, 0x31, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x29, 0x4a, 0xe8, 0x39, 0xc8, 0x39, 0x66, 0x29, 0xe4, 0x18, 0x66, 0x29, 0x49, 0x4a, 0x29, 0x4a, 0x66, 0x31, 0x66, 0x31, 0xc8, 0x39, 0xc8, 0x39, 0x87, 0x31, 0xa7, 0x39, 0x87, 0x31, 0xa7, 0x39, 0x66, 0x31, 0x25, 0x29, 0x25, 0x29, 0x05, 0x21, 0xa7, 0x31, 0x87, 0x29, 0xe8, 0x39, 0x86, 0x31, 0x86, 0x39, 0x86, 0x49, 0xa6, 0x59, 0x45, 0x49, 0x46, 0x49, 0x49, 0x62, 0xe7, 0x51, 0x00, 0x18, 0x00, 0x20, 0x20, 0x28, 0x00, 0x20, 0x00, 0x30, 0x00, 0x40, 0x00, 0x58, 0x66, 0xa1, 0x09, 0xca, 0x08, 0xe2, 0x08, 0xda, 0x00, 0x90, 0x00, 0x68, 0x04, 0x91, 0x22, 0x80, 0x02, 0x80, 0xc6, 0x88, 0xd1, 0xb3, 0xf1, 0xa3, 0xe9, 0x59, 0x43, 0x30, 0x05, 0x39, 0x25, 0x21, 0x44, 0x19, 0xc3, 0x18, 0xe3, 0x20, 0x61, 0x00, 0x2d, 0x83, 0xc7, 0x51, 0xa2, 0x18, 0x85, 0x31, 0x44, 0x29, 0xe8, 0x41, 0x2d, 0x63, 0xa6, 0x21, 0x09, 0x3a, 0x4a, 0x52, 0x09, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x49, 0x4a, 0x49, 0x4a, 0x29, 0x4a, 0x08, 0x42, 0x08, 0x42, 0x28, 0x42, 0x49, 0x4a, 0x69, 0x4a, 0x6a, 0x52, 0x4a, 0x52, 0x4b, 0x4a, 0x2a, 0x42, 0xc8, 0x31, 0xc7, 0x41, 0xe4, 0x40, 0x00, 0x40, 0x00, 0x48, 0x21, 0x48, 0x41, 0x30, 0x00, 0x30, 0x61, 0x60, 0x04, 0x79, 0x24, 0x89, 0x20, 0x70, 0x41, 0x70, 0x45, 0xa1, 0x87, 0xa1, 0x09, 0xaa, 0x25, 0x89, 0x25, 0x91, 0xc3, 0x90, 0x04, 0xb1, 0x82, 0xa8, 0x40, 0xa8, 0x00, 0xa8, 0x00, 0xb0, 0x01, 0xb8, 0x22, 0xa8, 0x42, 0x88, 0x61, 0x78, 0x20, 0x68, 0x21, 0x78, 0x01, 0x88, 0x00, 0x88, 0x00, 0x88, 0x20, 0x88, 0x21, 0x70, 0x01, 0x50, 0x42, 0x38, 0xa3, 0x30, 0xc3, 0x20, 0x05, 0x31, 0x05, 0x31, 0x05, 0x31, 0x25, 0x29, 0x45, 0x21, 0x65, 0x19, 0x65, 0x19, 0x44, 0x21, 0x44, 0x21, 0x45, 0x29, 0x45, 0x29, 0xe7, 0x39, 0x6a, 0x52, 0xeb, 0x5a, 0xab, 0x5a, 0x86, 0x31, 0x45, 0x29, 0xc7, 0x39, 0xe8, 0x41, 0x30, 0x84, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x8e, 0x73, 0x45, 0x29, 0xc7, 0x39, 0x25, 0x29, 0x25, 0x29, 0x09, 0x42, 0x86, 0x31, 0x25, 0x21, 0x08, 0x42, 0x66, 0x29, 0x49, 0x4a, 0x6a, 0x52, 0x69, 0x4a, 0xe8, 0x39, 0xc7, 0x39, 0x29, 0x42, 0x4a, 0x4a, 0x49, 0x42, 0x49, 0x4a, 0xe8, 0x39, 0x66, 0x29, 0x25, 0x29, 0xe8, 0x41, 0xc8, 0x39, 0x66, 0x31, 0x87, 0x39, 0x4a, 0x52, 0x4a, 0x52, 0xc7, 0x39, 0x86, 0x31, 0x6a, 0x52, 0x4a, 0x52, 0x09, 0x4a, 0xa7, 0x39, 0x08, 0x3a, 0x87, 0x29, 0xa7, 0x29, 0x86, 0x31, 0x65, 0x39, 0x62, 0x30, 0xcf, 0xa3, 0x36, 0xe5, 0x70, 0xbb, 0xb1, 0xcb, 0x6f, 0xb3, 0xf0, 0xa3, 0x31, 0xac, 0x31, 0xb4, 0x31, 0xac, 0xf0, 0xb3, 0x4a, 0x9a, 0xa4, 0x80, 0x66, 0xa9, 0x86, 0xc1, 0x08, 0xe2, 0x85, 0xc9, 0xe3, 0x90, 0xc6, 0x91, 0xa6, 0x99, 0x42, 0x70, 0x00, 0x58, 0x6c, 0xa2, 0x72, 0xac, 0x71, 0x8c, 0x07, 0x32, 0x24, 0x29, 0x85, 0x31, 0x22, 0x11, 0x85, 0x21, 0x83, 0x20, 0xc4, 0x20, 0xc3, 0x18, 0x66, 0x49, 0x86, 0x51, 0x24, 0x29, 0xc5, 0x29, 0x84, 0x21, 0x08, 0x42, 0x4d, 0x63, 0xe7, 0x21, 0x29, 0x3a, 0x2a, 0x4a, 0x08, 0x42, 0xe8, 0x41, 0xe8, 0x39, 0xe8, 0x39, 0xe8, 0x39, 0x08, 0x42, 0x08, 0x42, 0x29, 0x4a, 0x49, 0x4a, 0x29, 0x4a, 0x08, 0x42, 0x08, 0x42, 0x29, 0x4a, 0x28, 0x42, 0x08, 0x42, 0x09, 0x4a, 0xc9, 0x41, 0xe9, 0x41, 0xe9, 0x39, 0xa7, 0x29, 0xa7, 0x41, 0x86, 0x59, 0xe4, 0x58, 0x01, 0x48, 0x41, 0x48, 0x82, 0x38, 0x61, 0x28, 0x81, 0x48, 0x23, 0x79, 0x61, 0x70, 0x00, 0x78, 0x45, 0xa9, 0x65, 0x91, 0x41, 0x70, 0x87, 0x91, 0x09, 0xb2, 0x46, 0xa9, 0x46, 0xb9, 0x66, 0xc9, 0x44, 0xc1, 0x03, 0xc1, 0xe2, 0xb8, 0xc3, 0xc8, 0xc4, 0xc8, 0x63, 0xa8, 0x42, 0x80, 0x81, 0x68, 0x40, 0x58, 0x20, 0x68, 0x21, 0x88, 0x00, 0x88, 0x00, 0x98, 0x00, 0x88, 0x00, 0x68, 0x01, 0x38, 0x62, 0x28, 0xe3, 0x28, 0x03, 0x21, 0x45, 0x31, 0x25, 0x39, 0x06, 0x39, 0x26, 0x31, 0x46, 0x29, 0x65, 0x29, 0x45, 0x29, 0x25, 0x31, 0x25, 0x31, 0x05, 0x29, 0x45, 0x29, 0x08, 0x42, 0x8a, 0x52, 0xab, 0x5a, 0x8a, 0x52, 0xc3, 0x18, 0x25, 0x29, 0x65, 0x29, 0x29, 0x4a, 0xaf, 0x7b, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0xae, 0x7b, 0x45, 0x29, 0xc7, 0x39, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x46, 0x29, 0x25, 0x21, 0xc8, 0x39, 0x4a, 0x4a, 0x8a, 0x4a, 0x66, 0x29, 0xe4, 0x18, 0x4d, 0x63, 0xcb, 0x52, 0x4a, 0x4a, 0x6e, 0x73, 0xaf, 0x7b, 0x29, 0x4a, 0x08, 0x42, 0x49, 0x4a, 0x86, 0x31, 0x86, 0x31, 0xe7, 0x31, 0x86, 0x29, 0x29, 0x42, 0x6a, 0x4a, 0x46, 0x31, 0x0d, 0x6b, 0x10, 0x84, 0x72, 0x94, 0xd3, 0xa4, 0xf0, 0x83, 0x6a, 0x52, 0x29, 0x42, 0x2a, 0x3a, 0xa8, 0x31, 0xc7, 0x41, 0x45, 0x41, 0x00, 0x40, 0x8e, 0xbb, 0x72, 0xe4, 0x47, 0xb1, 0xc6, 0xa8, 0xf5, 0xec, 0x7e, 0xff, 0x5e, 0xff, 0xdd, 0xfe, 0x9f, 0xff, 0x9e, 0xff, 0x14, 0xed, 0x46, 0xa1, 0xa3, 0xa8, 0xc3, 0xb0, 0x48, 0xea, 0x64, 0xa9, 0x63, 0x91, 0x10, 0xfc, 0x66, 0x99, 0x21, 0x50, 0x64, 0x60, 0x65, 0x68, 0x26, 0x49, 0xaf, 0x83, 0xeb, 0x5a, 0x04, 0x19, 0x65, 0x29, 0x43, 0x21, 0x24, 0x21, 0xc4, 0x30, 0xe4, 0x20, 0xc3, 0x10, 0xe5, 0x30, 0x47, 0x41, 0x26, 0x31, 0xa6, 0x29, 0xc6, 0x21, 0xc7, 0x29, 0xab, 0x52, 0xc7, 0x39, 0xa8, 0x39, 0xe9, 0x41, 0x09, 0x42, 0x29, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0xe8, 0x41, 0xe8, 0x41, 0xe8, 0x49, 0xe8, 0x49, 0xc7, 0x41, 0xc7, 0x49, 0xe8, 0x49, 0x28, 0x4a, 0x49, 0x42, 0x2a, 0x52, 0x2a, 0x52, 0x09, 0x4a, 0xe8, 0x39, 0xa6, 0x31, 0x44, 0x31, 0xe7, 0x69, 0x05, 0x69, 0x01, 0x50, 0x00, 0x48, 0xa2, 0x48, 0xa1, 0x40, 0x00, 0x40, 0x20, 0x58, 0x00, 0x70, 0x62, 0xa0, 0xe4, 0xb0, 0x00, 0x70, 0x00, 0x68, 0xc3, 0x80, 0x86, 0x91, 0x00, 0x68, 0xa3, 0xa0, 0x63, 0xb0, 0x04, 0xb1, 0x03, 0xa9, 0x65, 0xc9, 0x66, 0xd9, 0xe5, 0xd0, 0x62, 0xa8, 0x82, 0x78, 0x60, 0x50, 0x40, 0x48, 0x20, 0x68, 0x01, 0x98, 0x00, 0x90, 0x21, 0xa0, 0x40, 0x90, 0x20, 0x68, 0x41, 0x40, 0x21, 0x30, 0x82, 0x30, 0x25, 0x49, 0x66, 0x49, 0x26, 0x41, 0x67, 0x41, 0x87, 0x39, 0x46, 0x29, 0x26, 0x29, 0x26, 0x29, 0x26, 0x39, 0x67, 0x41, 0x46, 0x31, 0x26, 0x29, 0x09, 0x4a, 0xe9, 0x41, 0xab, 0x5a, 0xab, 0x5a, 0xe4, 0x20, 0x46, 0x31, 0x25, 0x29, 0x6a, 0x4a, 0xec, 0x5a, 0xbb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0xef, 0x83, 0x45, 0x29, 0x66, 0x29, 0x66, 0x29, 0x52, 0x8c, 0x93, 0x94, 0x4d, 0x63, 0x66, 0x29, 0x66, 0x29, 0xab, 0x52, 0x87, 0x29, 0xc7, 0x31, 0x45, 0x21, 0xf4, 0x9c, 0xcf, 0x73, 0x00, 0x00, 0x8e, 0x73, 0x93, 0x9c, 0x86, 0x39, 0x8a, 0x5a, 0x49, 0x4a, 0xe7, 0x39, 0x65, 0x21, 0x65, 0x21, 0x8a, 0x42, 0xec, 0x52, 0x29, 0x42, 0x06, 0x29, 0x73, 0x9c, 0x31, 0x84, 0x8a, 0x52, 0xec, 0x62, 0x6e, 0x6b, 0xab, 0x52, 0xc8, 0x31, 0x6b, 0x42, 0x2a, 0x42, 0x46, 0x39, 0x42, 0x38, 0x21, 0x60, 0x85, 0xa9, 0x45, 0xc9, 0x03, 0xc0, 0x46, 0xb9, 0x76, 0xed, 0xbf, 0xff, 0xb8, 0xe5, 0xd1, 0xb3, 0x97, 0xe5, 0xfe, 0xff, 0x38, 0xfe, 0x87, 0xb9, 0x00, 0xa8, 0x82, 0xb0, 0x28, 0xda, 0xa5, 0xa1, 0xa0, 0x70, 0xac, 0xe2, 0x00, 0x80, 0x00, 0x30, 0x00, 0x38, 0xc6, 0x70, 0x02, 0x40, 0x8b, 0x72, 0xab, 0x62, 0x04, 0x21, 0x24, 0x21, 0x24, 0x29, 0x04, 0x29, 0xc3, 0x28, 0xe3, 0x20, 0xe3, 0x10, 0x47, 0x31, 0x68, 0x41, 0x48, 0x41, 0x88, 0x31, 0xe7, 0x29, 0xe7, 0x31, 0x6a, 0x52, 0xa8, 0x49, 0x05, 0x31, 0xa7, 0x39, 0x09, 0x42, 0x29, 0x42, 0x08, 0x42, 0xc7, 0x39, 0xe7, 0x39, 0xc7, 0x41, 0xa7, 0x39, 0x66, 0x31, 0x86, 0x39, 0x86, 0x41, 0x66, 0x39, 0x66, 0x39, 0x87, 0x41, 0xe8, 0x41, 0x09, 0x42, 0x09, 0x4a, 0xe9, 0x49, 0xc8, 0x41, 0xa6, 0x31, 0x64, 0x21, 0x64, 0x39, 0x86, 0x59, 0x22, 0x60, 0x01, 0x60, 0x00, 0x48, 0x41, 0x40, 0x40, 0x40, 0x00, 0x58, 0xa1, 0x78, 0x03, 0xa1, 0x26, 0xd1, 0x83, 0xc0, 0x00, 0x88, 0x00, 0x88, 0xe3, 0x98, 0xa0, 0x70, 0x00, 0x50, 0xa3, 0xa0, 0x22, 0xa0, 0x00, 0x98, 0x21, 0x90, 0x45, 0xa9, 0xc4, 0xb0, 0x85, 0xc0, 0x84, 0xb8, 0xc2, 0x78, 0x20, 0x30, 0x80, 0x48, 0x00, 0x70, 0x00, 0x98, 0x00, 0x88, 0x00, 0x90, 0x20, 0x90, 0x00, 0x60, 0x20, 0x48, 0x41, 0x48, 0xa4, 0x58, 0xe5, 0x58, 0x67, 0x61, 0x09, 0x62, 0xe8, 0x49, 0x29, 0x42, 0x09, 0x32, 0x6b, 0x42, 0xac, 0x5a, 0xca, 0x51, 0xca, 0x51, 0xce, 0x6a, 0x8c, 0x5a, 0x8c, 0x5a, 0x0a, 0x4a, 0x8c, 0x5a, 0x6b, 0x5a, 0x46, 0x31, 0x67, 0x31, 0x26, 0x29, 0x8b, 0x52, 0x8b, 0x52, 0x5a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0xef, 0x7b, 0x25, 0x29, 0x29, 0x42, 0x05, 0x19, 0xb3, 0x94, 0xf4, 0x9c, 0xcc, 0x5a, 0x01, 0x00, 0x4e, 0x6b, 0x6a, 0x4a, 0xe4, 0x18, 0x4e, 0x6b, 0x49, 0x42, 0x4d, 0x63, 0x14, 0x9d, 0x72, 0x8c, 0x35, 0xa5, 0xec, 0x62, 0x6e, 0x73, 0xd4, 0xa4, 0xe8, 0x39, 0xec, 0x5a, 0xa7, 0x31, 0x04, 0x19, 0xec, 0x52, 0xe8, 0x39, 0x66, 0x29, 0x67, 0x39, 0x77, 0xbd, 0xcf, 0x7b, 0x04, 0x21, 0x51, 0x8c, 0xb7, 0xbd, 0x11, 0x7c, 0x46, 0x19, 0x6b, 0x42, 0xcc, 0x5a, 0x67, 0x49, 0x05, 0x61, 0x29, 0xaa, 0xc3, 0xa8, 0x8a, 0xf2, 0xa7, 0xd9, 0xc7, 0xa1, 0x58, 0xf6, 0xfb, 0xf6, 0x32, 0xcc, 0x6d, 0xba, 0x09, 0x82, 0xda, 0xfe, 0xd6, 0xfd, 0xa8, 0xd1, 0xc3, 0xc0, 0x40, 0xa0, 0x27, 0xc2, 0x47, 0xba, 0x60, 0x78, 0xe5, 0xb0, 0x83, 0x90, 0x00, 0x40, 0x46, 0x69, 0xee, 0xaa, 0xa4, 0x38, 0x29, 0x4a, 0x29, 0x42, 0xe4, 0x20, 0x05, 0x29, 0x05, 0x29, 0xe3, 0x28, 0xe2, 0x20, 0x02, 0x19, 0xe3, 0x10, 0x66, 0x29, 0x67, 0x39, 0x26, 0x31, 0x66, 0x31, 0x85, 0x29, 0x65, 0x31, 0x28, 0x4a, 0xa7, 0x49, 0x25, 0x29, 0xa6, 0x29, 0x08, 0x3a, 0x28, 0x3a, 0xe8, 0x39, 0xa6, 0x29, 0x86, 0x29, 0xa6, 0x31, 0xa6, 0x29, 0x45, 0x21, 0x86, 0x29, 0x86, 0x29, 0x65, 0x29, 0x65, 0x29, 0x86, 0x29, 0xc7, 0x31, 0xa7, 0x31, 0x87, 0x39, 0x66, 0x39, 0x46, 0x31, 0x65, 0x29, 0x44, 0x21, 0x65, 0x39, 0xc7, 0x69, 0x2a, 0x92, 0xc8, 0x91, 0xc4, 0x60, 0x20, 0x38, 0x00, 0x28, 0x00, 0x60, 0x61, 0x90, 0xe3, 0xb0, 0xc5, 0xd8, 0xa4, 0xd0, 0x46, 0xc1, 0x66, 0xc1, 0x45, 0xc1, 0x44, 0x99, 0x00, 0x70, 0x21, 0xa0, 0x01, 0xb0, 0xa4, 0xc0, 0x04, 0xa1, 0x86, 0xa1, 0xa7, 0xb9, 0xa8, 0xc9, 0x83, 0xa0, 0x40, 0x60, 0x60, 0x38, 0x80, 0x40, 0x41, 0x70, 0xc3, 0xa8, 0xa3, 0x98, 0xe6, 0xb1, 0x89, 0xc2, 0xa5, 0x89, 0x60, 0x48, 0x20, 0x48, 0xa2, 0x50, 0xa2, 0x50, 0xa7, 0x69, 0x86, 0x51, 0xcb, 0x62, 0xef, 0x73, 0xcf, 0x63, 0x30, 0x74, 0xf4, 0x94, 0xd4, 0x9c, 0x16, 0xa5, 0x98, 0xbd, 0xb8, 0xbd, 0xb0, 0x7b, 0x4b, 0x52, 0x8c, 0x5a, 0x2a, 0x4a, 0xa8, 0x39, 0xa8, 0x39, 0xc8, 0x41, 0x09, 0x4a, 0x29, 0x42, 0xf8, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0xf0, 0x7b, 0x45, 0x29, 0x00, 0x00, 0x97, 0xb5, 0xbb, 0xde, 0x96, 0xb5, 0x7a, 0xd6, 0x4d, 0x6b, 0x49, 0x4a, 0x46, 0x31, 0xe4, 0x20, 0xc4, 0x28, 0x76, 0xb5, 0xd8, 0xc5, 0xf4, 0xa4, 0x4d, 0x6b, 0xf4, 0x9c, 0xd4, 0x9c, 0xd7, 0xbd, 0xc8, 0x39, 0xe8, 0x39, 0xec, 0x5a, 0x86, 0x31, 0x08, 0x3a, 0x8b, 0x52, 0x66, 0x29, 0x04, 0x21, 0x83, 0x18, 0xd8, 0xc5, 0x39, 0xce, 0x8b, 0x52, 0xf0, 0x83, 0x31, 0x84, 0x4d, 0x63, 0x01, 0x00, 0x87, 0x29, 0x6a, 0x52, 0xe8, 0x59, 0x05, 0x69, 0x08, 0xb2, 0x21, 0xa8, 0x24, 0xd9, 0x86, 0xd9, 0x44, 0x99, 0x74, 0xdd, 0x7c, 0xff, 0x56, 0xed, 0x2e, 0xbb, 0x6e, 0xbb, 0x3b, 0xff, 0xb5, 0xfd, 0x46, 0xd1, 0xc3, 0xc0, 0x00, 0xa0, 0xa6, 0xc9, 0xea, 0xea, 0x65, 0xb1, 0x46, 0xc1, 0x87, 0xa9, 0x00, 0x28, 0x29, 0x8a, 0x6b, 0x9a, 0x82, 0x28, 0xe6, 0x29, 0xc6, 0x29, 0xe4, 0x20, 0x05, 0x31, 0x05, 0x29, 0xe3, 0x20, 0x03, 0x21, 0x02, 0x21, 0xc2, 0x10, 0x24, 0x21, 0x24, 0x29, 0xc3, 0x28, 0xc3, 0x30, 0xa2, 0x30, 0xa1, 0x30, 0xc6, 0x51, 0xc6, 0x49, 0x65, 0x29, 0xc7, 0x29, 0xe7, 0x31, 0x08, 0x3a, 0x08, 0x3a, 0xa7, 0x31, 0x86, 0x29, 0xa6, 0x29, 0xa6, 0x29, 0x86, 0x21, 0xa6, 0x29, 0xa6, 0x29, 0xa6, 0x21, 0xa6, 0x21, 0xa6, 0x29, 0xa6, 0x29, 0xa6, 0x29, 0x66, 0x31, 0x46, 0x31, 0x45, 0x31, 0x65, 0x29, 0x65, 0x29, 0x82, 0x20, 0x8e, 0x9b, 0xb4, 0xdc, 0x8c, 0xa2, 0x42, 0x50, 0xe3, 0x48, 0xe3, 0x58, 0x82, 0x88, 0x24, 0xb1, 0x66, 0xc1, 0x63, 0xb8, 0x00, 0x98, 0x25, 0xb1, 0xa7, 0xc9, 0x66, 0xc9, 0x65, 0xb1, 0x00, 0x80, 0x21, 0xa0, 0x83, 0xb8, 0x63, 0xb8, 0xaa, 0xd2, 0x8a, 0xca, 0x4a, 0xca, 0xc9, 0xc9, 0x67, 0xb9, 0x45, 0x89, 0x60, 0x50, 0x40, 0x50, 0x82, 0x78, 0x66, 0xb9, 0xa6, 0xb1, 0x0b, 0xdb, 0xce, 0xf3, 0x68, 0xb2, 0x00, 0x68, 0x00, 0x58, 0x00, 0x50, 0x21, 0x60, 0xa3, 0x68, 0x00, 0x48, 0x45, 0x59, 0x92, 0xac, 0x18, 0xce, 0xf7, 0xc5, 0x7a, 0xd6, 0x9b, 0xde, 0xbc, 0xe6, 0xfd, 0xe6, 0x9f, 0xf7, 0xb4, 0x9c, 0x0a, 0x42, 0xcc, 0x5a, 0xe9, 0x41, 0x32, 0x8c, 0x36, 0xad, 0x15, 0xad, 0xab, 0x5a, 0x29, 0x4a, 0x96, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x9e, 0xef, 0x10, 0x7c, 0x25, 0x21, 0x00, 0x00, 0x39, 0xd6, 0xd4, 0xac, 0xf0, 0x8b, 0xd4, 0xac, 0x8a, 0x62, 0xa7, 0x49, 0xa7, 0x49, 0x46, 0x39, 0x66, 0x41, 0xb4, 0xb4, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x52, 0xa8, 0x31, 0x87, 0x31, 0xed, 0x62, 0x46, 0x29, 0x4a, 0x4a, 0xc8, 0x39, 0x09, 0x42, 0x05, 0x21, 0xc8, 0x39, 0x72, 0x94, 0x93, 0x94, 0xa7, 0x31, 0x2d, 0x63, 0x4d, 0x6b, 0xef, 0x73, 0xec, 0x52, 0x00, 0x00, 0x4a, 0x52, 0x0d, 0x8b, 0x83, 0x68, 0x63, 0x98, 0x62, 0xc0, 0x00, 0xc8, 0x01, 0xd8, 0x04, 0xb9, 0x95, 0xfd, 0x9c, 0xff, 0xb9, 0xfe, 0x59, 0xf6, 0xb9, 0xfe, 0xfd, 0xff, 0x36, 0xf6, 0x04, 0xb1, 0x00, 0xb0, 0x00, 0xc0, 0x63, 0xd8, 0x87, 0xe9, 0x66, 0xd1, 0x41, 0x98, 0x82, 0x88, 0xc2, 0x68, 0xe4, 0x68, 0xa3, 0x60, 0xa1, 0x18, 0xc5, 0x19, 0xa5, 0x19, 0x05, 0x29, 0x06, 0x39, 0x05, 0x21, 0xe4, 0x18, 0xe3, 0x20, 0xe3, 0x28, 0xa2, 0x20, 0x04, 0x29, 0x03, 0x29, 0x81, 0x30, 0xa2, 0x48, 0x82, 0x58, 0x61, 0x58, 0xa6, 0x69, 0xe7, 0x51, 0x65, 0x29, 0xa7, 0x29, 0x87, 0x31, 0xc8, 0x39, 0xe8, 0x39, 0xc7, 0x39, 0xa7, 0x31, 0xa7, 0x31, 0x86, 0x29, 0x66, 0x21, 0x86, 0x21, 0xa6, 0x29, 0xa6, 0x21, 0xa6, 0x21, 0xa6, 0x21, 0x86, 0x21, 0x86, 0x21, 0x86, 0x29, 0x66, 0x31, 0x66, 0x31, 0x66, 0x31, 0x65, 0x29, 0x86, 0x39, 0x46, 0x49, 0x00, 0x08, 0x00, 0x28, 0x42, 0x40, 0x61, 0x30, 0x00, 0x30, 0x82, 0x88, 0xc7, 0xb9, 0x8a, 0xd2, 0x45, 0xb9, 0x00, 0x78, 0xa2, 0x80, 0x65, 0xb1, 0xa7, 0xc9, 0x24, 0xa1, 0x00, 0x70, 0x41, 0x88, 0x04, 0xb1, 0xa2, 0xa0, 0x83, 0xa0, 0x2a, 0xca, 0xac, 0xda, 0x46, 0xb1, 0x47, 0xb9, 0x26, 0xa1, 0x00, 0x60, 0x00, 0x68, 0x00, 0x80, 0x01, 0x98, 0x00, 0x80, 0x00, 0x90, 0x00, 0x98, 0x00, 0x90, 0xc3, 0xa8, 0x21, 0xa0, 0xa3, 0xa8, 0xa8, 0xc1, 0xa4, 0xa8, 0xc9, 0xb9, 0x88, 0xa1, 0x90, 0xd3, 0xb4, 0xdc, 0xd1, 0xbb, 0x94, 0xcc, 0x3b, 0xfe, 0x7c, 0xf6, 0xbc, 0xe6, 0xbc, 0xd6, 0x93, 0x94, 0x09, 0x42, 0x8b, 0x52, 0xcc, 0x5a, 0x7a, 0xce, 0x9f, 0xf7, 0xdc, 0xde, 0x4a, 0x4a, 0xc8, 0x39, 0x76, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x9e, 0xef, 0x11, 0x7c, 0x25, 0x21, 0xa3, 0x18, 0xf0, 0x83, 0x10, 0x8c, 0x31, 0x94, 0xcb, 0x62, 0x25, 0x31, 0x09, 0x52, 0xc8, 0x49, 0x25, 0x39, 0xe9, 0x51, 0xb4, 0xac, 0x6f, 0x83, 0xed, 0x72, 0xa7, 0x41, 0x87, 0x29, 0x6a, 0x4a, 0x87, 0x29, 0x66, 0x29, 0x87, 0x31, 0x6f, 0x73, 0x2a, 0x4a, 0x25, 0x29, 0x09, 0x4a, 0x09, 0x4a, 0x83, 0x18, 0x0d, 0x63, 0xec, 0x62, 0xcc, 0x5a, 0xec, 0x62, 0x29, 0x42, 0xd7, 0xb5, 0x96, 0xad, 0x2c, 0x5b, 0x00, 0x00, 0x6a, 0x5a, 0x52, 0xbc, 0x46, 0x89, 0x83, 0xa8, 0x62, 0xc8, 0x00, 0xd0, 0x01, 0xd8, 0xa2, 0xb0, 0x4f, 0xe4, 0x16, 0xfe, 0x17, 0xfe, 0x37, 0xee, 0x57, 0xfe, 0xb6, 0xe6, 0xd0, 0xd4, 0x25, 0xc1, 0xe4, 0xd0, 0x01, 0xb8, 0x00, 0xc0, 0x25, 0xd9, 0x6a, 0xf2, 0x04, 0xa9, 0x81, 0x80, 0xc6, 0x99, 0xe3, 0x78, 0x82, 0x58, 0xc2, 0x28, 0x64, 0x19, 0x85, 0x21, 0x66, 0x29, 0x26, 0x31, 0x05, 0x21, 0x04, 0x19, 0xa3, 0x28, 0xa3, 0x30, 0x83, 0x30, 0x04, 0x31, 0x03, 0x31, 0x81, 0x38, 0xc3, 0x68, 0xc4, 0x88, 0x83, 0x80, 0xa7, 0x89, 0xc7, 0x59, 0x24, 0x21, 0x46, 0x21, 0x66, 0x31, 0x67, 0x39, 0x87, 0x39, 0xa7, 0x39, 0xc8, 0x41, 0xa7, 0x39, 0x66, 0x31, 0x87, 0x31, 0x87, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0xa7, 0x31, 0x87, 0x31, 0x86, 0x29, 0x86, 0x21, 0x86, 0x29, 0x86, 0x31, 0x66, 0x31, 0x66, 0x31, 0x45, 0x29, 0x86, 0x39, 0x05, 0x41, 0x01, 0x28, 0x83, 0x40, 0x62, 0x30, 0x82, 0x28, 0x41, 0x40, 0xc3, 0x90, 0x86, 0xb1, 0xc7, 0xb1, 0xe3, 0x90, 0x00, 0x68, 0x81, 0x78, 0x44, 0xa1, 0x45, 0xb1, 0xa2, 0x98, 0x00, 0x78, 0x82, 0x88, 0xa6, 0xb1, 0xc6, 0xb1, 0x04, 0x99, 0x21, 0x80, 0x29, 0xb2, 0x49, 0xb2, 0x25, 0x99, 0x42, 0x80, 0x84, 0x88, 0x26, 0x91, 0x46, 0xa1, 0xc4, 0x98, 0x04, 0x99, 0x65, 0xb1, 0x25, 0xb9, 0x24, 0xb9, 0x24, 0xb9, 0x61, 0xa0, 0xe7, 0xd1, 0xaf, 0xfb, 0xab, 0xea, 0x8f, 0xfb, 0x6b, 0xc2, 0xa8, 0x99, 0x4a, 0x92, 0x6a, 0x82, 0x4e, 0x93, 0x97, 0xd5, 0xb7, 0xcd, 0x76, 0xb5, 0xd4, 0x9c, 0xd0, 0x73, 0x4a, 0x42, 0x6a, 0x4a, 0xec, 0x5a, 0x7a, 0xce, 0x5e, 0xef, 0x9a, 0xd6, 0x09, 0x42, 0xc8, 0x39, 0x15, 0xa5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x9e, 0xf7, 0xf0, 0x7b, 0x05, 0x19, 0xc7, 0x31, 0xe8, 0x39, 0xec, 0x5a, 0xab, 0x52, 0xc7, 0x31, 0x45, 0x29, 0x8a, 0x52, 0x29, 0x4a, 0x08, 0x4a, 0x29, 0x52, 0x52, 0x9c, 0xaf, 0x83, 0x6f, 0x7b, 0x09, 0x52, 0x6b, 0x5a, 0x93, 0x9c, 0x15, 0xa5, 0xa4, 0x10, 0xed, 0x5a, 0x73, 0x94, 0x0a, 0x4a, 0x26, 0x31, 0xe9, 0x49, 0xe8, 0x49, 0x66, 0x31, 0xa7, 0x39, 0xc7, 0x39, 0x67, 0x29, 0xe8, 0x39, 0x14, 0xa5, 0x4d, 0x63, 0x86, 0x29, 0xa6, 0x29, 0xa2, 0x00, 0xec, 0x6a, 0x93, 0xc4, 0x47, 0x91, 0x83, 0xa8, 0x00, 0xc0, 0x25, 0xf1, 0xa3, 0xe8, 0x00, 0xb8, 0x48, 0xca, 0x0b, 0xcb, 0x49, 0xb2, 0x45, 0xa1, 0x2c, 0xc3, 0x8b, 0xbb, 0xa8, 0xba, 0xa3, 0xb8, 0xa3, 0xb0, 0x42, 0xa8, 0x42, 0xb0, 0xa3, 0xb0, 0x28, 0xd2, 0x69, 0xd2, 0x81, 0x90, 0xc3, 0x78, 0x86, 0x99, 0xc3, 0x68, 0x40, 0x30, 0xe2, 0x28, 0x65, 0x29, 0x86, 0x31, 0x46, 0x29, 0x25, 0x19, 0x25, 0x19, 0xa4, 0x28, 0xa4, 0x38, 0x63, 0x38, 0xe4, 0x30, 0xc2, 0x30, 0x40, 0x38, 0x62, 0x70, 0x63, 0xa0, 0x43, 0x98, 0x87, 0x99, 0x87, 0x59, 0x05, 0x29, 0x46, 0x29, 0x67, 0x31, 0x66, 0x31, 0x46, 0x31, 0x87, 0x39, 0xe8, 0x49, 0xc8, 0x49, 0x87, 0x39, 0x67, 0x39, 0x67, 0x39, 0x67, 0x41, 0x88, 0x41, 0x67, 0x41, 0x47, 0x39, 0x86, 0x31, 0xc6, 0x29, 0xa6, 0x29, 0x86, 0x31, 0x66, 0x31, 0x66, 0x31, 0x46, 0x31, 0x67, 0x41, 0x09, 0x5a, 0x67, 0x51, 0x83, 0x30, 0x42, 0x28, 0xc3, 0x38, 0x00, 0x38, 0xa7, 0xb9, 0x08, 0xca, 0xc3, 0x90, 0x00, 0x68, 0x20, 0x68, 0x20, 0x70, 0x61, 0x80, 0x82, 0x98, 0x00, 0x90, 0x82, 0x98, 0x41, 0x88, 0x44, 0xa1, 0x07, 0xb2, 0x04, 0x99, 0x00, 0x58, 0xc2, 0x68, 0x45, 0x69, 0x04, 0x71, 0x83, 0x70, 0xa4, 0x80, 0xa8, 0xa9, 0xc8, 0xa9, 0xc3, 0x80, 0xe3, 0x80, 0xc2, 0x88, 0x21, 0x88, 0x81, 0x88, 0x60, 0x78, 0x00, 0x80, 0x03, 0xa1, 0x49, 0xca, 0x49, 0xd2, 0x49, 0xc2, 0x08, 0xaa, 0x00, 0x40, 0xcb, 0x8a, 0x31, 0xac, 0x10, 0x94, 0x18, 0xc6, 0x59, 0xc6, 0x4e, 0x6b, 0x72, 0x8c, 0x0d, 0x63, 0x29, 0x42, 0xab, 0x52, 0x08, 0x3a, 0x8e, 0x6b, 0x72, 0x8c, 0x51, 0x8c, 0xe8, 0x41, 0x29, 0x4a, 0xb3, 0x9c, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xbe, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x51, 0x94, 0xe3, 0x18, 0xe7, 0x31, 0xc6, 0x19, 0xa5, 0x19, 0x28, 0x32, 0xe2, 0x00, 0x49, 0x3a, 0x07, 0x3a, 0x8a, 0x4a, 0xaa, 0x52, 0x65, 0x29, 0x08, 0x42, 0x08, 0x42, 0x04, 0x29, 0x46, 0x39, 0xe4, 0x30, 0xe4, 0x20, 0x66, 0x31, 0x29, 0x4a, 0x11, 0x8c, 0x12, 0x8c, 0xe5, 0x20, 0x06, 0x31, 0xc8, 0x49, 0x6b, 0x5a, 0xe8, 0x41, 0xa3, 0x10, 0x45, 0x21, 0xa7, 0x31, 0x29, 0x4a, 0x4e, 0x6b, 0xe8, 0x39, 0x04, 0x19, 0x24, 0x19, 0x45, 0x21, 0x6e, 0x7b, 0x8f, 0xa3, 0x84, 0x70, 0xc8, 0xc9, 0x00, 0xc0, 0x25, 0xf9, 0x27, 0xfa, 0xe9, 0xfa, 0x64, 0xb9, 0xc6, 0xd1, 0x42, 0xb8, 0xc9, 0xf9, 0x67, 0xe1, 0xa1, 0x98, 0xc2, 0xa8, 0x21, 0xb0, 0x00, 0x80, 0x00, 0x70, 0x20, 0x70, 0x40, 0x70, 0xc1, 0x80, 0x48, 0xc2, 0x04, 0xa1, 0x00, 0x78, 0xc3, 0x88, 0x24, 0x89, 0x04, 0x79, 0x00, 0x30, 0x44, 0x49, 0x65, 0x39, 0x85, 0x21, 0x66, 0x19, 0x05, 0x19, 0xe5, 0x28, 0xa5, 0x30, 0xa4, 0x38, 0xe4, 0x28, 0xe3, 0x28, 0x60, 0x30, 0x22, 0x68, 0x23, 0x90, 0x64, 0x90, 0x47, 0x89, 0x46, 0x51, 0xc4, 0x18, 0x67, 0x29, 0x25, 0x21, 0x45, 0x21, 0x86, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0x87, 0x39, 0xa8, 0x41, 0x87, 0x41, 0x67, 0x41, 0x67, 0x41, 0x47, 0x41, 0x47, 0x41, 0x47, 0x41, 0x67, 0x39, 0xa6, 0x31, 0xa6, 0x29, 0x86, 0x29, 0x66, 0x29, 0x46, 0x31, 0x46, 0x39, 0xa8, 0x49, 0x67, 0x41, 0x26, 0x41, 0xc4, 0x30, 0x62, 0x30, 0x00, 0x10, 0x46, 0x79, 0xe6, 0xb8, 0x06, 0xc9, 0x82, 0x90, 0x00, 0x70, 0x03, 0x91, 0x00, 0x78, 0x00, 0x80, 0x21, 0xa0, 0x42, 0xb8, 0x01, 0xb0, 0x00, 0xa0, 0x81, 0x98, 0xa2, 0x90, 0x65, 0xa9, 0x00, 0x68, 0x20, 0x48, 0x20, 0x38, 0x20, 0x38, 0x21, 0x58, 0x00, 0x50, 0x41, 0x68, 0x41, 0x68, 0x00, 0x58, 0x00, 0x58, 0x20, 0x70, 0xa2, 0x90, 0xa2, 0xa0, 0x82, 0xa0, 0x41, 0xa0, 0x21, 0xa0, 0x42, 0xa8, 0x22, 0xa0, 0xc8, 0xc9, 0xe9, 0xc9, 0xe5, 0x90, 0x09, 0x9a, 0x8b, 0x92, 0xaf, 0x9b, 0x59, 0xde, 0x8e, 0x7b, 0x2d, 0x6b, 0xb7, 0xbd, 0x4d, 0x6b, 0xe8, 0x39, 0xab, 0x52, 0x8a, 0x4a, 0xc4, 0x10, 0x25, 0x21, 0x46, 0x29, 0xc8, 0x39, 0xe9, 0x41, 0x31, 0x8c, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x3c, 0xff, 0xcf, 0x9b, 0x00, 0x18, 0x89, 0x62, 0x58, 0xd6, 0xd6, 0xc5, 0x55, 0xbd, 0x54, 0xb5, 0xd3, 0xac, 0xeb, 0x72, 0x08, 0x5a, 0x8a, 0x6a, 0x45, 0x41, 0xcb, 0x7a, 0x10, 0x9c, 0x6a, 0x6a, 0x22, 0x38, 0xe9, 0x71, 0xd0, 0xa3, 0xab, 0x72, 0xab, 0x62, 0x31, 0x8c, 0x2e, 0x6b, 0x83, 0x18, 0xe5, 0x30, 0xe9, 0x51, 0xcc, 0x6a, 0xe8, 0x41, 0x04, 0x19, 0x0c, 0x5b, 0xe5, 0x20, 0x05, 0x21, 0xa3, 0x18, 0x66, 0x31, 0x6a, 0x4a, 0x48, 0x42, 0x0c, 0x5b, 0x14, 0xad, 0x29, 0x6a, 0x46, 0x79, 0x6f, 0xeb, 0x87, 0xe9, 0x05, 0xe9, 0x64, 0xe9, 0xe5, 0xe9, 0xa2, 0xc0, 0xe4, 0xd8, 0x21, 0xc8, 0xa6, 0xf8, 0x84, 0xe8, 0x45, 0xd1, 0x41, 0xb0, 0x21, 0xb0, 0xc2, 0x90, 0x64, 0x81, 0x00, 0x50, 0x00, 0x40, 0x40, 0x48, 0xa6, 0x99, 0x49, 0xca, 0x25, 0xb1, 0x00, 0x68, 0x48, 0xb2, 0x4a, 0xc2, 0x62, 0x78, 0x20, 0x48, 0xe3, 0x28, 0x07, 0x32, 0x85, 0x29, 0x46, 0x29, 0x05, 0x29, 0xc5, 0x28, 0xa4, 0x28, 0xe4, 0x20, 0x04, 0x21, 0xc2, 0x30, 0x21, 0x48, 0x01, 0x70, 0x43, 0x78, 0xe5, 0x70, 0x66, 0x49, 0x46, 0x29, 0xe5, 0x10, 0xc6, 0x29, 0xa5, 0x21, 0x85, 0x21, 0x85, 0x21, 0x85, 0x29, 0xa6, 0x31, 0xc8, 0x39, 0x66, 0x31, 0x67, 0x39, 0x67, 0x39, 0x47, 0x39, 0x47, 0x39, 0x47, 0x39, 0x66, 0x39, 0x86, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x66, 0x29, 0x46, 0x31, 0x47, 0x39, 0x26, 0x39, 0xa4, 0x28, 0xc4, 0x28, 0x62, 0x28, 0x01, 0x28, 0x62, 0x40, 0x67, 0x99, 0xc9, 0xe1, 0x88, 0xd9, 0x22, 0x98, 0x61, 0x88, 0x81, 0x88, 0x20, 0x88, 0x20, 0x98, 0xa3, 0xb8, 0x83, 0xc8, 0x00, 0xa8, 0x00, 0x90, 0x62, 0xa8, 0x24, 0xb1, 0x24, 0xb1, 0x00, 0x78, 0x00, 0x48, 0x00, 0x30, 0x03, 0x51, 0xa7, 0x89, 0x27, 0x91, 0x02, 0x78, 0x21, 0x70, 0x00, 0x50, 0x00, 0x60, 0x61, 0x88, 0xa2, 0xa0, 0xe4, 0xb0, 0x87, 0xc9, 0xc4, 0xb8, 0x00, 0x88, 0x00, 0x98, 0x22, 0xa8, 0x43, 0xa8, 0x64, 0xa8, 0xe6, 0xa8, 0x43, 0x78, 0x03, 0x60, 0x8c, 0x8a, 0xaf, 0x9b, 0x66, 0x39, 0xf4, 0xac, 0xf8, 0xc5, 0x4d, 0x6b, 0xe8, 0x39, 0xe8, 0x39, 0x6a, 0x4a, 0x86, 0x29, 0x45, 0x21, 0x46, 0x29, 0xc8, 0x39, 0xc8, 0x41, 0x11, 0x8c, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xf7, 0xd6, 0xe5, 0xd7, 0xf5, 0xf8, 0xfd, 0x39, 0xfe, 0x76, 0xfd, 0x0c, 0xab, 0xc3, 0x68, 0x00, 0x48, 0x93, 0xe4, 0xd0, 0xcb, 0x0d, 0xb3, 0x6e, 0xc3, 0x09, 0x9a, 0x22, 0x70, 0x05, 0x79, 0x83, 0x70, 0xc4, 0x78, 0x6b, 0xaa, 0x4a, 0xa2, 0xe5, 0x78, 0x63, 0x70, 0x26, 0x81, 0xc8, 0x81, 0x87, 0x61, 0xcb, 0x72, 0x6e, 0x7b, 0x25, 0x29, 0x26, 0x31, 0x06, 0x31, 0x05, 0x31, 0x09, 0x4a, 0x4a, 0x52, 0x6a, 0x4a, 0x10, 0x7c, 0xd4, 0x94, 0xf1, 0x83, 0x11, 0x84, 0x55, 0xb5, 0x72, 0x94, 0xaa, 0x52, 0x8e, 0x73, 0x2d, 0x73, 0x42, 0x20, 0xa4, 0x58, 0xa8, 0xa1, 0x42, 0xa8, 0x46, 0xd9, 0x82, 0xd8, 0x61, 0xe0, 0x41, 0xd0, 0x22, 0xd8, 0x01, 0xd8, 0x01, 0xe0, 0x22, 0xd0, 0x65, 0xc9, 0xc2, 0xb0, 0x41, 0xa8, 0x81, 0x78, 0xe2, 0x68, 0x01, 0x58, 0x00, 0x38, 0x68, 0x82, 0xae, 0xcb, 0xa7, 0xa9, 0x66, 0xc1, 0x00, 0x88, 0x00, 0x78, 0xa4, 0xb0, 0xa4, 0xa8, 0x83, 0x70, 0xa1, 0x38, 0x23, 0x29, 0x61, 0x20, 0x25, 0x31, 0x25, 0x21, 0xe5, 0x18, 0xc4, 0x10, 0x04, 0x11, 0x44, 0x19, 0x03, 0x29, 0xa2, 0x38, 0x41, 0x48, 0x41, 0x50, 0x82, 0x40, 0x45, 0x41, 0xc7, 0x39, 0x66, 0x21, 0x85, 0x19, 0x84, 0x19, 0xc5, 0x21, 0x06, 0x2a, 0xc6, 0x21, 0x85, 0x19, 0x44, 0x19, 0x65, 0x21, 0x66, 0x29, 0x66, 0x29, 0x46, 0x29, 0x46, 0x29, 0x46, 0x29, 0x46, 0x31, 0x45, 0x31, 0x66, 0x31, 0x66, 0x29, 0x46, 0x29, 0x46, 0x31, 0x46, 0x39, 0x05, 0x31, 0xa3, 0x28, 0xa3, 0x28, 0x62, 0x30, 0x00, 0x28, 0xa8, 0x89, 0x0a, 0xba, 0x47, 0xc9, 0xe5, 0xb8, 0x00, 0x80, 0x21, 0x78, 0x00, 0x68, 0x21, 0x90, 0x00, 0x90, 0x82, 0xa0, 0x43, 0xb8, 0x00, 0xa8, 0x00, 0x98, 0x82, 0xa8, 0x61, 0xa0, 0x21, 0xa8, 0xe4, 0xb0, 0xe3, 0x90, 0x00, 0x50, 0x20, 0x40, 0xa7, 0x89, 0xad, 0xca, 0x07, 0xa9, 0x26, 0xa1, 0x82, 0x80, 0x00, 0x80, 0x21, 0x98, 0x21, 0xa0, 0x62, 0xa8, 0x46, 0xc1, 0x25, 0xb9, 0x82, 0x98, 0x82, 0xa0, 0xc4, 0xb0, 0xe4, 0xb0, 0xa4, 0xa8, 0xc5, 0xa8, 0xa4, 0x88, 0x67, 0x89, 0x46, 0x69, 0x4a, 0x72, 0x72, 0xac, 0x97, 0xc5, 0x92, 0x9c, 0x29, 0x52, 0x6a, 0x52, 0x49, 0x4a, 0x29, 0x42, 0x86, 0x31, 0x66, 0x29, 0x66, 0x29, 0xc8, 0x39, 0x87, 0x31, 0x31, 0x8c, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x55, 0xd5, 0xab, 0xaa, 0xab, 0xc2, 0x6b, 0xca, 0x8b, 0xda, 0x49, 0xca, 0xa6, 0xa9, 0x24, 0x99, 0x62, 0xa0, 0x2a, 0xd2, 0x47, 0xc1, 0x67, 0xc1, 0x67, 0xc1, 0xe5, 0xb8, 0xc5, 0xb8, 0x84, 0xa8, 0x84, 0xb0, 0xc4, 0xb0, 0x26, 0xc1, 0x63, 0xb8, 0x43, 0xa8, 0xe5, 0xb8, 0x47, 0xb1, 0x67, 0x99, 0x46, 0x79, 0x25, 0x51, 0xc3, 0x28, 0x04, 0x29, 0x26, 0x29, 0x88, 0x41, 0x47, 0x39, 0x66, 0x39, 0xe8, 0x41, 0x28, 0x3a, 0x6a, 0x42, 0x0d, 0x63, 0xd0, 0x7b, 0xd0, 0x83, 0x0c, 0x6b, 0xcb, 0x62, 0xcb, 0x5a, 0x0c, 0x63, 0x66, 0x31, 0xe4, 0x30, 0x46, 0x59, 0x63, 0x68, 0x66, 0xa1, 0x05, 0xb1, 0x61, 0xd0, 0x00, 0xd8, 0x41, 0xe0, 0x01, 0xd8, 0x02, 0xe0, 0x01, 0xd8, 0x22, 0xd0, 0x65, 0xc9, 0x24, 0xb9, 0x00, 0x90, 0x00, 0x58, 0x85, 0x69, 0xc4, 0x60, 0x00, 0x40, 0x65, 0x51, 0xc6, 0x69, 0x04, 0x81, 0x4a, 0xda, 0x42, 0x98, 0x20, 0x80, 0x00, 0xa0, 0xa4, 0xb0, 0x86, 0xa9, 0x24, 0x71, 0xa1, 0x40, 0x04, 0x59, 0x45, 0x51, 0x04, 0x29, 0xe4, 0x18, 0xe4, 0x10, 0x04, 0x19, 0x25, 0x21, 0xe3, 0x20, 0xc3, 0x30, 0xa2, 0x38, 0xa1, 0x40, 0xc2, 0x48, 0x04, 0x41, 0x24, 0x39, 0xe3, 0x20, 0x85, 0x29, 0x64, 0x21, 0x84, 0x21, 0xc6, 0x29, 0xa5, 0x29, 0x85, 0x29, 0x85, 0x29, 0x65, 0x21, 0x65, 0x21, 0x65, 0x21, 0x66, 0x21, 0x66, 0x21, 0x66, 0x29, 0x45, 0x31, 0x25, 0x39, 0x45, 0x31, 0x45, 0x29, 0x45, 0x29, 0x26, 0x31, 0x26, 0x39, 0xe5, 0x30, 0xe4, 0x30, 0x82, 0x28, 0x62, 0x30, 0x00, 0x38, 0x2a, 0xba, 0x6c, 0xda, 0xc9, 0xc9, 0x22, 0x98, 0xa3, 0x98, 0x20, 0x70, 0x41, 0x68, 0xa2, 0x98, 0x81, 0x90, 0xa2, 0x90, 0x42, 0xa8, 0x00, 0x98, 0x61, 0xa0, 0x03, 0xb9, 0x82, 0xa8, 0x83, 0xb8, 0x25, 0xc1, 0xe4, 0x98, 0x81, 0x58, 0x80, 0x40, 0x21, 0x50, 0x42, 0x70, 0xa8, 0xa9, 0x63, 0x80, 0x00, 0x68, 0x00, 0x88, 0x82, 0xa0, 0x24, 0xb9, 0x03, 0xb1, 0xc4, 0xb0, 0x86, 0xc9, 0x45, 0xc1, 0x24, 0xb9, 0x65, 0xc1, 0x86, 0xc9, 0xc7, 0xd1, 0x87, 0xc1, 0x09, 0xca, 0x4a, 0xba, 0x45, 0x79, 0x62, 0x58, 0x4e, 0x93, 0x8f, 0x93, 0xec, 0x72, 0xe8, 0x51, 0x6a, 0x5a, 0x29, 0x4a, 0x29, 0x42, 0xa7, 0x31, 0x66, 0x29, 0x87, 0x31, 0xa7, 0x39, 0x46, 0x29, 0x72, 0x94, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xd3, 0xe4, 0x06, 0xa9, 0x26, 0xc1, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc8, 0x81, 0xc0, 0xa2, 0xc0, 0x62, 0xd0, 0x00, 0xc0, 0x00, 0xc8, 0x01, 0xc8, 0x00, 0xc8, 0x22, 0xd8, 0x21, 0xc8, 0x01, 0xd0, 0x21, 0xd0, 0x01, 0xc8, 0x00, 0xc8, 0x21, 0xd0, 0x01, 0xd0, 0x06, 0xe1, 0x4b, 0xfa, 0xe9, 0xc9, 0xa3, 0x70, 0xa2, 0x40, 0x45, 0x41, 0x66, 0x31, 0xc8, 0x41, 0x87, 0x39, 0x47, 0x39, 0x46, 0x31, 0x25, 0x29, 0xa6, 0x29, 0x49, 0x3a, 0x87, 0x29, 0xe8, 0x41, 0xab, 0x5a, 0xc8, 0x41, 0xe8, 0x49, 0x86, 0x39, 0xa3, 0x18, 0x42, 0x08, 0x09, 0x4a, 0x4e, 0x8b, 0x00, 0x28, 0x6a, 0x9a, 0xeb, 0xd2, 0xc2, 0xc0, 0x00, 0xd0, 0x20, 0xd8, 0x00, 0xd8, 0x02, 0xe0, 0x01, 0xd8, 0x41, 0xc8, 0xa5, 0xd1, 0x24, 0xb9, 0x00, 0x88, 0x40, 0x58, 0x69, 0x82, 0x05, 0x61, 0x00, 0x38, 0xc4, 0x48, 0x00, 0x28, 0x21, 0x48, 0xe9, 0xd1, 0x67, 0xc1, 0x20, 0x70, 0x00, 0x90, 0x82, 0xa8, 0x49, 0xca, 0xe7, 0xa9, 0x20, 0x60, 0x25, 0x81, 0xc3, 0x60, 0xa2, 0x38, 0xc2, 0x20, 0xc3, 0x20, 0xe4, 0x20, 0xc4, 0x28, 0xa3, 0x30, 0xc2, 0x30, 0xa2, 0x30, 0x80, 0x30, 0xa1, 0x48, 0x82, 0x50, 0xa3, 0x50, 0x86, 0x61, 0x03, 0x41, 0xe3, 0x38, 0xe3, 0x30, 0xe3, 0x30, 0xe3, 0x30, 0x24, 0x31, 0x65, 0x39, 0x65, 0x31, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x86, 0x29, 0x66, 0x29, 0x25, 0x31, 0x05, 0x41, 0x45, 0x31, 0x45, 0x29, 0x46, 0x29, 0x26, 0x31, 0x46, 0x39, 0x83, 0x28, 0xe4, 0x30, 0x41, 0x20, 0x40, 0x30, 0xa3, 0x68, 0xe9, 0xc9, 0x2b, 0xe2, 0x66, 0xb1, 0x62, 0x88, 0x25, 0xb1, 0x20, 0x70, 0x24, 0x99, 0x66, 0xb9, 0xe3, 0x98, 0x23, 0x99, 0x25, 0xb9, 0x62, 0xb0, 0x61, 0xa0, 0xe3, 0xb8, 0x04, 0xc9, 0x21, 0xb0, 0x05, 0xc1, 0x86, 0xb9, 0x03, 0x79, 0x60, 0x30, 0x00, 0x40, 0x62, 0x60, 0x46, 0x91, 0xe4, 0x80, 0x24, 0x89, 0xc3, 0xa8, 0xa2, 0xb0, 0xe7, 0xd1, 0xc7, 0xc9, 0x00, 0xa0, 0xa3, 0xb0, 0x82, 0xa0, 0xc2, 0xa8, 0x65, 0xc9, 0xc2, 0xb0, 0x24, 0xc1, 0xe4, 0xb8, 0x87, 0xc9, 0xc7, 0xc1, 0x8a, 0xc2, 0x8a, 0xb2, 0x46, 0x71, 0x09, 0x6a, 0x6a, 0x6a, 0x09, 0x5a, 0xe8, 0x49, 0x08, 0x4a, 0x29, 0x4a, 0x08, 0x3a, 0xe8, 0x39, 0xe8, 0x39, 0xe8, 0x39, 0x25, 0x21, 0xb4, 0x9c, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x7d, 0xff, 0xf4, 0xec, 0x00, 0xb0, 0x64, 0xd0, 0x02, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x40, 0xd8, 0x00, 0xd0, 0x41, 0xe0, 0x20, 0xe0, 0x40, 0xd8, 0x41, 0xe0, 0x00, 0xd0, 0x82, 0xe8, 0x00, 0xc8, 0x40, 0xd8, 0x40, 0xe0, 0x00, 0xd0, 0x00, 0xd0, 0x21, 0xd0, 0xe6, 0xe0, 0x06, 0xc1, 0x00, 0x70, 0x00, 0x40, 0xe3, 0x38, 0x86, 0x39, 0xa7, 0x39, 0x25, 0x29, 0x67, 0x39, 0xc8, 0x41, 0x46, 0x29, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x31, 0xc8, 0x39, 0x05, 0x29, 0x83, 0x20, 0x09, 0x52, 0xe4, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x39, 0x00, 0x20, 0x6a, 0x82, 0x4d, 0xcb, 0xe2, 0xb0, 0x40, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd8, 0x21, 0xd0, 0x20, 0xb8, 0x84, 0xc1, 0x44, 0xb1, 0x41, 0x90, 0x81, 0x58, 0x07, 0x72, 0xe6, 0x68, 0x85, 0x58, 0xc5, 0x50, 0xc3, 0x30, 0x82, 0x48, 0xa9, 0xc9, 0xe8, 0xd1, 0xa2, 0x88, 0x00, 0x80, 0xc2, 0xa8, 0x69, 0xda, 0x8a, 0xda, 0xe4, 0x98, 0xe4, 0x98, 0x83, 0x78, 0x20, 0x50, 0x61, 0x38, 0x61, 0x28, 0x63, 0x38, 0x64, 0x40, 0x43, 0x48, 0x82, 0x40, 0x81, 0x30, 0x20, 0x38, 0x00, 0x40, 0x20, 0x68, 0x45, 0x91, 0x6a, 0xaa, 0xe4, 0x68, 0x05, 0x69, 0x87, 0x79, 0xa8, 0x79, 0x46, 0x61, 0xe4, 0x50, 0xe4, 0x48, 0x04, 0x41, 0x04, 0x39, 0x04, 0x31, 0x05, 0x29, 0x24, 0x21, 0x04, 0x21, 0xc4, 0x30, 0xc4, 0x38, 0x04, 0x31, 0x25, 0x21, 0x05, 0x21, 0x05, 0x29, 0x05, 0x31, 0xa3, 0x28, 0xc3, 0x28, 0x81, 0x20, 0x81, 0x48, 0xe8, 0xa1, 0xa8, 0xd9, 0x68, 0xd9, 0xa4, 0xa8, 0xa4, 0xa8, 0xe5, 0xb8, 0x41, 0x90, 0xc4, 0xa0, 0xa4, 0xb8, 0xc3, 0xa8, 0x65, 0xb1, 0x25, 0xc9, 0x83, 0xc8, 0x62, 0xb0, 0x62, 0xc0, 0x63, 0xd0, 0x02, 0xd0, 0x00, 0xb8, 0x63, 0xb8, 0xa3, 0x88, 0x40, 0x48, 0x20, 0x50, 0x00, 0x58, 0x63, 0x80, 0xe9, 0xb9, 0x09, 0xca, 0x83, 0xc0, 0x00, 0xb0, 0x82, 0xb8, 0xc3, 0xc0, 0x21, 0xb8, 0x41, 0xb0, 0x00, 0xa8, 0xe2, 0xb8, 0xe6, 0xe9, 0x03, 0xc9, 0x61, 0xc8, 0x00, 0xb0, 0x21, 0xc0, 0x83, 0xb8, 0x08, 0xd2, 0x29, 0xca, 0x4a, 0xaa, 0x4a, 0x7a, 0xc8, 0x59, 0x87, 0x49, 0xe8, 0x51, 0x8a, 0x5a, 0x29, 0x4a, 0xc7, 0x39, 0x08, 0x3a, 0x29, 0x42, 0xe8, 0x41, 0xe5, 0x20, 0xf5, 0xac, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x7d, 0xff, 0x93, 0xec, 0x00, 0xa0, 0x01, 0xd0, 0x01, 0xe8, 0x00, 0xe8, 0x00, 0xf0, 0x00, 0xe0, 0x20, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xc8, 0x40, 0xe0, 0x40, 0xe0, 0x00, 0xd0, 0x20, 0xd8, 0x40, 0xd8, 0x01, 0xd8, 0x00, 0xc8, 0x02, 0xb8, 0x4a, 0xca, 0xec, 0x9a, 0xc3, 0x28, 0x83, 0x18, 0x05, 0x29, 0x46, 0x39, 0x26, 0x39, 0x83, 0x20, 0xe8, 0x41, 0xcf, 0x73, 0xef, 0x7b, 0x02, 0x10, 0xe4, 0x28, 0x25, 0x39, 0x66, 0x41, 0x82, 0x20, 0xc7, 0x41, 0xf0, 0x83, 0x72, 0x9c, 0x52, 0xac, 0xe5, 0x50, 0x46, 0x71, 0xc7, 0x89, 0x65, 0x91, 0x80, 0xa8, 0x81, 0xd0, 0x41, 0xc8, 0x82, 0xd8, 0x41, 0xd0, 0x82, 0xd0, 0x61, 0xb0, 0xe5, 0xc9, 0x02, 0xa9, 0x40, 0x90, 0xa1, 0x70, 0x86, 0x81, 0xe6, 0x80, 0x85, 0x78, 0x23, 0x60, 0x25, 0x59, 0xc3, 0x60, 0x06, 0xa9, 0x08, 0xca, 0x24, 0x99, 0x20, 0x88, 0x60, 0x90, 0x00, 0x88, 0x65, 0xb9, 0x45, 0xb9, 0xa3, 0x98, 0x20, 0x70, 0x00, 0x58, 0x00, 0x40, 0x20, 0x30, 0x21, 0x38, 0x62, 0x48, 0x83, 0x50, 0x42, 0x40, 0x40, 0x38, 0x60, 0x48, 0x00, 0x58, 0x42, 0x88, 0x05, 0xa1, 0xe5, 0xa0, 0x22, 0x78, 0x63, 0x80, 0xa4, 0x88, 0x83, 0x78, 0x01, 0x60, 0x00, 0x50, 0x21, 0x48, 0x62, 0x40, 0x82, 0x38, 0x82, 0x30, 0x82, 0x30, 0x62, 0x30, 0x42, 0x30, 0x21, 0x40, 0x01, 0x48, 0x42, 0x38, 0x82, 0x28, 0xa2, 0x20, 0xa3, 0x20, 0xa3, 0x28, 0xa3, 0x30, 0x61, 0x30, 0x81, 0x38, 0x04, 0x69, 0x4a, 0xca, 0x47, 0xd9, 0x44, 0xc8, 0x42, 0xa0, 0xc5, 0xb8, 0x64, 0xb8, 0x67, 0xc9, 0xa8, 0xd1, 0x0a, 0xf2, 0x6a, 0xea, 0x49, 0xda, 0xa3, 0xb8, 0x00, 0xb0, 0x41, 0xb0, 0x62, 0xc8, 0x83, 0xd8, 0xa3, 0xd8, 0x83, 0xd0, 0x88, 0xf1, 0x46, 0xc1, 0x00, 0x60, 0x00, 0x70, 0x62, 0x88, 0xc4, 0xa0, 0x67, 0xc1, 0xc5, 0xb8, 0x02, 0xc8, 0xa4, 0xd8, 0x82, 0xc8, 0x41, 0xc8, 0x21, 0xc8, 0x00, 0xc0, 0x82, 0xd0, 0x82, 0xc8, 0x03, 0xd9, 0xc2, 0xd8, 0x81, 0xd8, 0x61, 0xd8, 0x41, 0xd0, 0x82, 0xc8, 0x29, 0xea, 0xa7, 0xc9, 0xe8, 0xb1, 0xc8, 0x81, 0x87, 0x69, 0x87, 0x61, 0xa7, 0x51, 0x49, 0x5a, 0x28, 0x4a, 0xe8, 0x39, 0xa7, 0x31, 0xe8, 0x39, 0xe8, 0x31, 0xe4, 0x08, 0x56, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x72, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd0, 0x20, 0xc0, 0x01, 0xc0, 0x0e, 0xe3, 0xf0, 0xa3, 0x90, 0x7b, 0x2f, 0x73, 0x06, 0x39, 0x63, 0x28, 0xa3, 0x38, 0x00, 0x18, 0x89, 0x5a, 0x75, 0xb5, 0x34, 0xad, 0xe5, 0x40, 0x05, 0x41, 0x01, 0x28, 0x82, 0x30, 0xa2, 0x28, 0x48, 0x52, 0xda, 0xe6, 0xba, 0xf6, 0xf4, 0xec, 0x47, 0xa1, 0x05, 0xa9, 0x25, 0xa9, 0xc7, 0xc1, 0xc3, 0xb0, 0x24, 0xd1, 0xc7, 0xf1, 0xc7, 0xf1, 0xa3, 0xd0, 0x04, 0xd9, 0x85, 0xd9, 0x64, 0xc9, 0x24, 0xb9, 0x03, 0xb1, 0x81, 0x98, 0x41, 0x90, 0xc4, 0xa8, 0xe5, 0xa8, 0xe6, 0xa8, 0x22, 0x80, 0x83, 0x80, 0x24, 0x89, 0xcb, 0xd2, 0xe7, 0xa9, 0x40, 0x90, 0x61, 0x98, 0xe3, 0xa8, 0x20, 0x90, 0xe3, 0x98, 0xc6, 0xb1, 0xc3, 0x88, 0x21, 0x58, 0x00, 0x38, 0x40, 0x30, 0x20, 0x28, 0xc2, 0x40, 0x23, 0x51, 0x81, 0x48, 0x00, 0x40, 0x00, 0x48, 0x00, 0x60, 0x01, 0x80, 0xe5, 0xa8, 0x47, 0xb9, 0xe4, 0xa8, 0x62, 0x98, 0x83, 0xa0, 0x22, 0x98, 0x01, 0x90, 0x62, 0x88, 0x21, 0x70, 0x00, 0x50, 0x20, 0x40, 0x20, 0x40, 0x00, 0x48, 0x00, 0x58, 0x01, 0x68, 0x01, 0x80, 0x00, 0x88, 0x00, 0x68, 0x21, 0x48, 0x61, 0x30, 0xa2, 0x30, 0x24, 0x41, 0x00, 0x20, 0x81, 0x48, 0x20, 0x60, 0x00, 0x70, 0x00, 0xa0, 0x84, 0xc8, 0x03, 0xb8, 0x00, 0xa8, 0x22, 0xb0, 0xa4, 0xc0, 0x25, 0xc9, 0x87, 0xd1, 0x26, 0xc9, 0xc3, 0xb8, 0xc3, 0xb8, 0x62, 0xb0, 0x41, 0xa8, 0xc3, 0xb8, 0xc3, 0xc0, 0xc7, 0xe1, 0x07, 0xe2, 0xe3, 0xc8, 0x42, 0xd0, 0x42, 0xd0, 0x01, 0xb8, 0x00, 0xa0, 0x00, 0x98, 0xa3, 0xb0, 0xe4, 0xc0, 0x63, 0xc0, 0x02, 0xc8, 0x0a, 0xfa, 0xc7, 0xe1, 0x41, 0xc8, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xd8, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x20, 0xd0, 0x61, 0xd0, 0x82, 0xd0, 0x41, 0xc0, 0x25, 0xc9, 0x46, 0xc9, 0x42, 0x90, 0x8b, 0xba, 0xab, 0xb2, 0x25, 0x79, 0x86, 0x61, 0x69, 0x62, 0x28, 0x4a, 0x08, 0x42, 0xc9, 0x41, 0xe9, 0x39, 0x49, 0x32, 0x65, 0x01, 0x38, 0xc6, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x72, 0xec, 0x00, 0xb0, 0x00, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x81, 0xd0, 0x01, 0xc0, 0x64, 0x98, 0x6f, 0x83, 0xd9, 0xc5, 0x37, 0xb5, 0x0e, 0x73, 0x00, 0x10, 0xa3, 0x38, 0xe3, 0x38, 0x44, 0x39, 0x80, 0x20, 0xa7, 0x51, 0xed, 0x92, 0x05, 0x59, 0x22, 0x38, 0x63, 0x38, 0x00, 0x20, 0xcb, 0x72, 0xba, 0xf6, 0x34, 0xd5, 0x6a, 0xa2, 0x46, 0xa1, 0x05, 0xb1, 0xc4, 0xb8, 0x66, 0xc9, 0x45, 0xd1, 0xa6, 0xd9, 0xa6, 0xe1, 0x45, 0xd9, 0x82, 0xc0, 0x24, 0xd1, 0x69, 0xf2, 0xc2, 0xb8, 0x03, 0xb1, 0x24, 0xb9, 0x81, 0xa0, 0x62, 0xa0, 0x66, 0xc1, 0x87, 0xc1, 0xa8, 0xb9, 0x42, 0x68, 0xa2, 0x68, 0x07, 0x9a, 0xc6, 0x99, 0xa6, 0xb1, 0x61, 0x98, 0x21, 0xa0, 0xc3, 0xb0, 0xa3, 0xa8, 0x00, 0x98, 0x61, 0xa0, 0xc3, 0xa0, 0x21, 0x78, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0xc2, 0x68, 0xa2, 0x70, 0x01, 0x70, 0x22, 0x80, 0xe4, 0x90, 0xa7, 0xa9, 0xc7, 0xa9, 0x66, 0xa9, 0xa3, 0x98, 0x82, 0x90, 0x20, 0x88, 0x41, 0xa8, 0x42, 0xb8, 0x01, 0xb8, 0x42, 0xc0, 0x83, 0xb8, 0x62, 0xa0, 0x82, 0x98, 0x61, 0x88, 0x21, 0x88, 0x21, 0x90, 0x01, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x20, 0x88, 0x00, 0x70, 0x01, 0x60, 0x83, 0x68, 0x46, 0x81, 0xa3, 0x80, 0x01, 0x80, 0xa3, 0xa8, 0x66, 0xd1, 0x05, 0xd1, 0xc4, 0xc8, 0x87, 0xd9, 0xc8, 0xd1, 0x45, 0xc1, 0xc7, 0xd1, 0xe8, 0xd9, 0xc3, 0xb8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xb0, 0x62, 0xb8, 0xe4, 0xd0, 0x65, 0xd9, 0xe2, 0xc0, 0x20, 0xb0, 0x00, 0xc8, 0x01, 0xd0, 0x01, 0xd0, 0xc3, 0xc8, 0x24, 0xc1, 0x28, 0xda, 0xe3, 0xc0, 0x01, 0xb8, 0x00, 0xb8, 0x66, 0xe9, 0x66, 0xd1, 0x82, 0xc8, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x00, 0xc8, 0x40, 0xc8, 0x20, 0xc0, 0x00, 0xb0, 0x86, 0xd9, 0xa7, 0xd1, 0x00, 0x88, 0x87, 0x99, 0xac, 0xc2, 0x09, 0xa2, 0x86, 0x71, 0x89, 0x6a, 0x07, 0x42, 0xc8, 0x41, 0xea, 0x49, 0x4b, 0x42, 0x66, 0x19, 0x28, 0x32, 0x99, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x72, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xc8, 0x40, 0xc8, 0x01, 0xc0, 0xc5, 0x98, 0xd0, 0x93, 0x3a, 0xc6, 0x58, 0xb5, 0x53, 0x9c, 0x83, 0x30, 0x82, 0x38, 0xc2, 0x38, 0x03, 0x39, 0x20, 0x20, 0x25, 0x49, 0xf1, 0xc3, 0xc9, 0x81, 0x63, 0x48, 0xc5, 0x50, 0x83, 0x38, 0x6a, 0x72, 0x31, 0xa4, 0xcf, 0xa3, 0xaa, 0x92, 0x00, 0x60, 0x62, 0x90, 0x43, 0xb8, 0x23, 0xd0, 0xc4, 0xc0, 0x24, 0xc1, 0x41, 0xb0, 0x00, 0xa8, 0x21, 0xb0, 0x21, 0xb0, 0x45, 0xc9, 0x44, 0xc1, 0x20, 0x98, 0x40, 0x90, 0x00, 0x88, 0x00, 0x80, 0x62, 0x90, 0x62, 0x80, 0x82, 0x60, 0x40, 0x40, 0x20, 0x28, 0xa1, 0x40, 0x44, 0x81, 0x45, 0xb1, 0x00, 0x90, 0x00, 0xa0, 0x21, 0xa0, 0x00, 0xa0, 0x22, 0xb0, 0x43, 0xc0, 0x64, 0xb8, 0xc8, 0xc1, 0x08, 0xba, 0x09, 0xba, 0xa7, 0xb1, 0x87, 0xb9, 0xa8, 0xc1, 0x09, 0xd2, 0x09, 0xda, 0xe8, 0xd1, 0x08, 0xca, 0xa6, 0xb1, 0x44, 0x99, 0xa1, 0x80, 0x00, 0x78, 0x00, 0x80, 0x61, 0xb0, 0xc3, 0xe0, 0x22, 0xe0, 0x00, 0xd8, 0x01, 0xd8, 0x21, 0xc8, 0x41, 0xc0, 0x41, 0xb8, 0x41, 0xb8, 0x21, 0xb8, 0x22, 0xc0, 0x21, 0xb8, 0x81, 0xb0, 0xc3, 0xb0, 0xc4, 0xa8, 0x84, 0xa0, 0x85, 0xa0, 0xa5, 0xb0, 0x84, 0xc0, 0x22, 0xb8, 0x42, 0xc8, 0xe4, 0xd0, 0xe4, 0xc8, 0x24, 0xc9, 0xc6, 0xd1, 0x27, 0xd2, 0x45, 0xb1, 0xc7, 0xc9, 0xe7, 0xd1, 0xa2, 0xb8, 0x21, 0xb0, 0x21, 0xb8, 0x00, 0xb0, 0x00, 0xb8, 0x21, 0xc0, 0x41, 0xc8, 0xe4, 0xe0, 0xc3, 0xd8, 0xc3, 0xd0, 0x21, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x42, 0xd8, 0x65, 0xe1, 0xa6, 0xd9, 0xaa, 0xf2, 0x04, 0xc1, 0x01, 0xc0, 0x62, 0xc8, 0xe8, 0xf1, 0x65, 0xd1, 0x61, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x20, 0xd0, 0x40, 0xc8, 0x23, 0xd9, 0x86, 0xd9, 0xa7, 0xd1, 0xe8, 0xd1, 0xe8, 0xc1, 0x83, 0x78, 0x2a, 0xb2, 0x29, 0xaa, 0x86, 0x71, 0x28, 0x6a, 0x45, 0x31, 0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x96, 0xa5, 0xdf, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x72, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd0, 0x20, 0xc8, 0x22, 0xc8, 0xe6, 0xa0, 0xf0, 0x93, 0x5a, 0xc6, 0x5b, 0xce, 0xf5, 0xac, 0xcc, 0x72, 0x42, 0x38, 0x24, 0x49, 0x04, 0x49, 0x04, 0x49, 0x62, 0x48, 0xa8, 0x89, 0xa8, 0x89, 0xa4, 0x50, 0xe4, 0x48, 0x83, 0x38, 0xc4, 0x30, 0x41, 0x18, 0x21, 0x18, 0x60, 0x20, 0xc6, 0x69, 0x24, 0x91, 0xc5, 0xd0, 0x85, 0xe8, 0x42, 0xb8, 0x45, 0xb9, 0xe4, 0xb8, 0x00, 0xa0, 0x25, 0xc9, 0x04, 0xc1, 0x24, 0xc1, 0x65, 0xc1, 0x60, 0x98, 0xc2, 0xa0, 0xa2, 0x98, 0x21, 0x88, 0x01, 0x88, 0xa3, 0x90, 0xa3, 0x78, 0xe2, 0x58, 0x60, 0x38, 0x81, 0x40, 0x28, 0xb2, 0x45, 0xb1, 0x00, 0x80, 0x01, 0xa8, 0xe4, 0xa8, 0xc6, 0xb1, 0x8a, 0xd2, 0x09, 0xe2, 0x67, 0xd1, 0xc8, 0xd1, 0xa7, 0xc9, 0x86, 0xb9, 0xa7, 0xb9, 0x66, 0xb1, 0x24, 0xa9, 0xe3, 0x98, 0x62, 0x88, 0x61, 0x88, 0x41, 0x80, 0x20, 0x68, 0x80, 0x70, 0xc0, 0x78, 0x20, 0x98, 0x00, 0xa8, 0x82, 0xd0, 0xe3, 0xf8, 0x21, 0xf0, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x40, 0xb8, 0x60, 0xb0, 0x60, 0xb0, 0x60, 0xb8, 0x61, 0xc0, 0xc2, 0xb8, 0xe2, 0xb0, 0x81, 0xa0, 0x21, 0x98, 0x63, 0xa0, 0xa5, 0xc0, 0xc5, 0xd0, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xc8, 0x00, 0xb8, 0x80, 0xb0, 0xa1, 0xa8, 0x80, 0x90, 0x61, 0x90, 0x60, 0x98, 0xa1, 0xa8, 0x81, 0xb0, 0x20, 0xb0, 0x20, 0xb8, 0x21, 0xc0, 0x00, 0xb8, 0x00, 0xc8, 0x21, 0xd0, 0x00, 0xc8, 0x62, 0xd0, 0x21, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x01, 0xd8, 0x01, 0xd0, 0x21, 0xd0, 0xa2, 0xc0, 0x40, 0xa8, 0xc2, 0xb0, 0x85, 0xd9, 0xe8, 0xf1, 0x04, 0xd9, 0x86, 0xe9, 0x04, 0xd1, 0x40, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x61, 0xd8, 0x00, 0xc0, 0x23, 0xd9, 0x28, 0xf2, 0x28, 0xe2, 0x08, 0xca, 0x08, 0xba, 0x01, 0x68, 0x67, 0x99, 0x09, 0xaa, 0xc7, 0x89, 0x28, 0x72, 0x0b, 0x73, 0x10, 0x8c, 0xd5, 0xac, 0x5b, 0xce, 0xff, 0xf7, 0xff, 0xf7, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x72, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x20, 0xd0, 0x63, 0xd0, 0x84, 0x98, 0xaf, 0x83, 0x9b, 0xce, 0xdd, 0xde, 0xd8, 0xc5, 0x8e, 0x8b, 0x00, 0x20, 0xc3, 0x48, 0x41, 0x38, 0x05, 0x61, 0xa4, 0x60, 0xc3, 0x60, 0x86, 0x79, 0xa3, 0x48, 0x83, 0x38, 0xa4, 0x30, 0x06, 0x39, 0xa3, 0x18, 0x04, 0x21, 0x02, 0x19, 0x47, 0x62, 0x27, 0x92, 0x46, 0xd1, 0xe5, 0xe0, 0x62, 0xb0, 0xc7, 0xc1, 0x49, 0xda, 0x00, 0xa0, 0xc3, 0xb8, 0xe3, 0xb8, 0x04, 0xb9, 0xc2, 0xa8, 0xe3, 0xa0, 0xa6, 0xb9, 0x45, 0xa9, 0xa3, 0x98, 0x83, 0x98, 0x84, 0x98, 0xa4, 0x88, 0xa2, 0x68, 0x00, 0x40, 0x40, 0x58, 0x24, 0x99, 0xe4, 0xb8, 0x06, 0xc9, 0xa7, 0xd1, 0x89, 0xca, 0xa9, 0xba, 0xe6, 0x99, 0xa2, 0x88, 0x00, 0x80, 0x41, 0x90, 0x41, 0x90, 0x00, 0x78, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0x00, 0x78, 0x00, 0x88, 0x41, 0x98, 0x40, 0x90, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x60, 0xa8, 0x00, 0xa8, 0x20, 0xc0, 0x40, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x20, 0xc8, 0x60, 0xc0, 0x80, 0xb8, 0x80, 0xb0, 0x80, 0xb0, 0x60, 0xb8, 0x40, 0xb8, 0x60, 0xb0, 0x40, 0x98, 0x00, 0x80, 0x00, 0x78, 0x21, 0x90, 0x84, 0xb0, 0x83, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc8, 0x40, 0xc0, 0x40, 0xb0, 0x40, 0x98, 0x40, 0x98, 0x00, 0x90, 0x61, 0xb0, 0x82, 0xb8, 0x41, 0xc0, 0x41, 0xc8, 0x21, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x20, 0xc8, 0x00, 0xc0, 0x20, 0xc0, 0x41, 0xc8, 0x42, 0xd0, 0x00, 0xd0, 0x01, 0xd8, 0x01, 0xd0, 0x21, 0xc8, 0x61, 0xb8, 0x40, 0xa8, 0x64, 0xc9, 0x48, 0xf2, 0x28, 0xfa, 0xa3, 0xd0, 0xc2, 0xd0, 0x41, 0xb8, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0xc2, 0xd8, 0xc5, 0xf1, 0xe7, 0xe1, 0x28, 0xda, 0x49, 0xd2, 0xa7, 0xa9, 0x21, 0x60, 0xa4, 0x80, 0xa8, 0xa1, 0x66, 0x81, 0x0c, 0x93, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x72, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x63, 0xd0, 0xc5, 0x98, 0xcf, 0x83, 0x7a, 0xc6, 0x9c, 0xd6, 0x39, 0xce, 0x8e, 0x8b, 0x00, 0x28, 0x00, 0x38, 0x20, 0x40, 0x63, 0x58, 0x04, 0x61, 0xea, 0x9a, 0x27, 0x72, 0x81, 0x30, 0x05, 0x41, 0x42, 0x20, 0x84, 0x30, 0x84, 0x20, 0xc4, 0x20, 0x40, 0x08, 0xa8, 0x6a, 0xc9, 0x8a, 0x00, 0x70, 0xe3, 0xa0, 0x41, 0x90, 0xe3, 0x98, 0x49, 0xda, 0x62, 0xa8, 0x21, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x00, 0x88, 0x00, 0x80, 0x61, 0x80, 0x20, 0x78, 0x21, 0x80, 0x42, 0x88, 0x22, 0x88, 0x23, 0x88, 0x62, 0x80, 0x00, 0x60, 0x41, 0x78, 0x46, 0xb1, 0xe9, 0xd9, 0x4a, 0xe2, 0x66, 0xb1, 0xa1, 0x80, 0x00, 0x50, 0x23, 0x61, 0x43, 0x69, 0x41, 0x48, 0x06, 0xa2, 0x64, 0x99, 0x20, 0x78, 0x00, 0x78, 0x20, 0x78, 0x20, 0x80, 0xa2, 0x98, 0x21, 0xa0, 0x00, 0xb0, 0x01, 0xb8, 0x02, 0xb8, 0x43, 0xc0, 0x62, 0xb8, 0xe2, 0xa8, 0x80, 0x98, 0xc1, 0xa8, 0x80, 0xa8, 0x20, 0xa8, 0x80, 0xb8, 0x40, 0xb0, 0x00, 0xa0, 0x20, 0xa0, 0x40, 0xa8, 0x20, 0xb0, 0x21, 0xb8, 0x21, 0xc0, 0x41, 0xb0, 0x81, 0xa0, 0x41, 0x88, 0x00, 0x78, 0x21, 0x78, 0x62, 0x88, 0x00, 0x88, 0x20, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x20, 0xb0, 0x00, 0xb0, 0x21, 0xc8, 0x21, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xc8, 0x20, 0xc8, 0x40, 0xb8, 0x00, 0xa8, 0xc2, 0xc0, 0xe4, 0xe8, 0x01, 0xd0, 0x01, 0xc8, 0x21, 0xc8, 0x20, 0xb8, 0x81, 0xb8, 0xc2, 0xb8, 0xe2, 0xc0, 0x81, 0xc0, 0xc3, 0xd8, 0x00, 0xc0, 0x41, 0xc8, 0x20, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0xa2, 0xd8, 0xa5, 0xf1, 0xc6, 0xe1, 0x07, 0xd2, 0x49, 0xca, 0xe8, 0xa1, 0x00, 0x40, 0x22, 0x70, 0x88, 0xa9, 0x66, 0x91, 0xab, 0x8a, 0x9d, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x92, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd8, 0x00, 0xd0, 0x22, 0xd0, 0xc5, 0x98, 0xcf, 0x8b, 0x7a, 0xc6, 0xfd, 0xde, 0x19, 0xce, 0xf0, 0x9b, 0x00, 0x48, 0x20, 0x40, 0x41, 0x50, 0x42, 0x60, 0x82, 0x58, 0x69, 0x92, 0x44, 0x69, 0xe4, 0x58, 0x45, 0x49, 0x42, 0x18, 0x82, 0x10, 0x04, 0x21, 0x04, 0x21, 0x20, 0x10, 0x07, 0x6a, 0xe6, 0x81, 0xe6, 0xa1, 0x85, 0xa9, 0x00, 0x78, 0x20, 0x78, 0x86, 0xb9, 0xc3, 0xa8, 0x62, 0xa0, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x20, 0x70, 0x00, 0x68, 0x00, 0x68, 0x41, 0x80, 0x45, 0xa1, 0x83, 0x80, 0x01, 0x70, 0x01, 0x68, 0x00, 0x70, 0x26, 0xa9, 0xe9, 0xc9, 0xa7, 0xc1, 0x00, 0x88, 0x61, 0x98, 0xa2, 0x88, 0x00, 0x68, 0x0b, 0xc3, 0x8c, 0xcb, 0x00, 0x48, 0xe5, 0x89, 0xe6, 0x99, 0x45, 0x99, 0x82, 0x90, 0x62, 0x98, 0x62, 0x98, 0xa4, 0xb0, 0x63, 0xb8, 0x44, 0xc8, 0x23, 0xd0, 0x23, 0xc0, 0x43, 0xb0, 0x21, 0x90, 0x61, 0x70, 0x40, 0x60, 0xa1, 0x80, 0xe3, 0x98, 0xe4, 0xa8, 0xa4, 0xb0, 0x84, 0xb8, 0xc4, 0xc0, 0xa3, 0xc0, 0xe4, 0xc0, 0x04, 0xc9, 0xe4, 0xc8, 0x04, 0xc9, 0x25, 0xc1, 0x04, 0xb1, 0xa3, 0x98, 0x00, 0x68, 0x21, 0x70, 0x41, 0x70, 0x00, 0x70, 0x41, 0x98, 0x40, 0xb0, 0x20, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x21, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd8, 0x00, 0xc8, 0x00, 0xc0, 0x40, 0xb8, 0x00, 0x98, 0xc2, 0xc0, 0x83, 0xd0, 0x83, 0xd0, 0x82, 0xc0, 0xc3, 0xc0, 0x03, 0xb9, 0xc2, 0xb0, 0x81, 0xb0, 0x61, 0xb8, 0x61, 0xc8, 0x04, 0xe9, 0x20, 0xd0, 0x00, 0xd0, 0x41, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xd0, 0x20, 0xe0, 0x00, 0xd0, 0x40, 0xd0, 0x65, 0xd9, 0x08, 0xd2, 0xe8, 0xb9, 0xa7, 0x91, 0x00, 0x40, 0x42, 0x68, 0xc5, 0x90, 0x46, 0x99, 0xcb, 0x92, 0xbe, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x92, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x22, 0xd0, 0x84, 0x98, 0xcf, 0x8b, 0x7a, 0xc6, 0xbc, 0xd6, 0x39, 0xd6, 0x10, 0xa4, 0xa2, 0x60, 0x04, 0x69, 0x82, 0x60, 0xa3, 0x70, 0x01, 0x70, 0x21, 0x80, 0xa3, 0x80, 0x45, 0x81, 0xc3, 0x50, 0x61, 0x20, 0xe3, 0x10, 0x03, 0x11, 0xc3, 0x18, 0x00, 0x10, 0x46, 0x79, 0x29, 0xb2, 0x08, 0xba, 0xe3, 0x90, 0x00, 0x60, 0x20, 0x80, 0xc3, 0xa0, 0x21, 0x90, 0x21, 0x98, 0x00, 0x88, 0x00, 0x88, 0x00, 0x80, 0x00, 0x78, 0x00, 0x78, 0x41, 0x80, 0xc3, 0x90, 0xa7, 0xb1, 0x62, 0x68, 0x00, 0x38, 0x00, 0x60, 0x67, 0xa9, 0x09, 0xd2, 0x46, 0xb1, 0x00, 0x70, 0x0c, 0xdb, 0x49, 0xd2, 0x66, 0xc1, 0x00, 0x98, 0xc6, 0xa9, 0x48, 0xb2, 0xc2, 0x68, 0xce, 0xd3, 0xcb, 0xca, 0x46, 0xb1, 0x42, 0xa0, 0x84, 0xb0, 0x63, 0xa0, 0x42, 0xa0, 0x22, 0xa0, 0x23, 0xb0, 0x23, 0xb0, 0x01, 0x90, 0x00, 0x68, 0xc1, 0x50, 0xc1, 0x48, 0x81, 0x48, 0x41, 0x60, 0xa3, 0x80, 0xa4, 0x98, 0x64, 0xa8, 0x64, 0xb0, 0x84, 0xb0, 0x43, 0xb0, 0x83, 0xb0, 0xa3, 0xa8, 0x62, 0x98, 0x82, 0x90, 0x83, 0x90, 0x42, 0x88, 0x22, 0x78, 0x00, 0x48, 0x00, 0x60, 0x00, 0x58, 0x00, 0x68, 0x61, 0x98, 0x41, 0xb8, 0x01, 0xd0, 0x01, 0xd8, 0x01, 0xe0, 0x02, 0xe0, 0x02, 0xe0, 0x00, 0xc8, 0x01, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xd8, 0x21, 0xd8, 0x21, 0xc8, 0x00, 0xc0, 0x00, 0xa8, 0x20, 0xa8, 0x00, 0xb0, 0x42, 0xb0, 0x41, 0xa0, 0x81, 0xa0, 0xe3, 0xa8, 0xc2, 0xa8, 0xa2, 0xb8, 0x20, 0xb8, 0x41, 0xc8, 0x62, 0xd8, 0x00, 0xc8, 0x00, 0xd0, 0x20, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x20, 0xc8, 0x45, 0xd1, 0x29, 0xd2, 0x09, 0xb2, 0x66, 0x81, 0x41, 0x48, 0x62, 0x70, 0xe5, 0xa0, 0xc8, 0xb1, 0x49, 0x92, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x92, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x02, 0xd0, 0x83, 0x90, 0xaf, 0x8b, 0x7a, 0xce, 0x9b, 0xde, 0x9b, 0xe6, 0x8e, 0x9b, 0xc2, 0x60, 0x85, 0x79, 0x04, 0x79, 0xa4, 0x78, 0x42, 0x80, 0x01, 0x90, 0x22, 0x90, 0x84, 0x90, 0x22, 0x60, 0x00, 0x28, 0x81, 0x18, 0xa2, 0x20, 0x61, 0x28, 0x01, 0x50, 0x63, 0x80, 0xe5, 0xa8, 0x26, 0xb1, 0x62, 0x88, 0x00, 0x58, 0xa2, 0x90, 0xa2, 0x98, 0x00, 0x88, 0x41, 0xa0, 0xa3, 0xb0, 0x20, 0x98, 0x00, 0x88, 0x00, 0x70, 0x00, 0x70, 0x41, 0x80, 0x82, 0x88, 0xa3, 0x88, 0x00, 0x40, 0x20, 0x38, 0x45, 0x89, 0x09, 0xca, 0x05, 0xb9, 0x41, 0x90, 0x00, 0x68, 0xa6, 0xa9, 0xe3, 0xa0, 0xc8, 0xe1, 0x0a, 0xf2, 0x84, 0xc0, 0x82, 0xa0, 0x45, 0xa1, 0xa6, 0xa1, 0x25, 0xa9, 0x83, 0xb0, 0xa5, 0xc0, 0x06, 0xc1, 0xa3, 0x90, 0x00, 0x70, 0x00, 0x68, 0x00, 0x78, 0x21, 0x80, 0xe3, 0x80, 0x81, 0x48, 0x60, 0x20, 0x81, 0x40, 0x62, 0x50, 0x42, 0x58, 0x02, 0x60, 0x02, 0x70, 0x02, 0x70, 0x00, 0x70, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x58, 0x21, 0x50, 0x41, 0x50, 0x62, 0x50, 0x21, 0x48, 0x00, 0x48, 0x00, 0x70, 0x41, 0xa0, 0x21, 0xb8, 0x21, 0xd0, 0x01, 0xd8, 0x01, 0xd0, 0x02, 0xd0, 0x03, 0xd0, 0x20, 0xc0, 0x41, 0xc8, 0x41, 0xc8, 0x82, 0xd8, 0x00, 0xc8, 0x01, 0xd0, 0x01, 0xd0, 0x00, 0xc8, 0x21, 0xd0, 0x22, 0xd0, 0x00, 0xc0, 0x83, 0xd0, 0x20, 0xb8, 0x83, 0xc0, 0x01, 0xa0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x98, 0x01, 0xc0, 0x62, 0xd8, 0x62, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x21, 0xc8, 0x20, 0xc8, 0x20, 0xd0, 0x20, 0xd8, 0x00, 0xd0, 0x00, 0xc0, 0x25, 0xc9, 0x6a, 0xd2, 0xe9, 0xa1, 0xc3, 0x58, 0xa2, 0x48, 0x21, 0x60, 0x68, 0xb1, 0x2a, 0xc2, 0xc7, 0x79, 0xd9, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x92, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x02, 0xd0, 0x83, 0x98, 0xaf, 0x8b, 0x7a, 0xd6, 0x9b, 0xe6, 0x3a, 0xe6, 0x29, 0x7a, 0x00, 0x48, 0xa2, 0x68, 0xc3, 0x70, 0xe4, 0x80, 0x66, 0x99, 0x62, 0x88, 0x22, 0x88, 0x22, 0x88, 0x00, 0x60, 0x00, 0x48, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0xa4, 0x88, 0x64, 0x90, 0xc5, 0xa0, 0x05, 0xa1, 0x41, 0x78, 0x00, 0x60, 0x44, 0xa1, 0x41, 0x90, 0x20, 0x90, 0x21, 0xa0, 0xc3, 0xb0, 0x62, 0xa0, 0xa3, 0xa8, 0x41, 0x90, 0x61, 0x90, 0xa2, 0x90, 0x62, 0x88, 0x21, 0x80, 0x00, 0x38, 0x60, 0x48, 0x29, 0xb2, 0x09, 0xda, 0x22, 0xb0, 0x62, 0xa0, 0x41, 0x80, 0xc2, 0x90, 0x82, 0x98, 0x46, 0xd9, 0x26, 0xe1, 0x01, 0xb8, 0x62, 0xa8, 0x45, 0xb9, 0x00, 0x88, 0x01, 0x98, 0x00, 0xa0, 0x01, 0xa8, 0x42, 0xa0, 0xe3, 0x90, 0xa2, 0x68, 0x40, 0x70, 0xe5, 0xa8, 0xc4, 0xa0, 0xe8, 0xb9, 0x85, 0x81, 0x20, 0x38, 0x20, 0x38, 0x01, 0x40, 0x21, 0x48, 0x42, 0x50, 0x62, 0x50, 0x21, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x58, 0x00, 0x58, 0x00, 0x60, 0x21, 0x70, 0x00, 0x68, 0x20, 0x48, 0x82, 0x38, 0x61, 0x30, 0x20, 0x30, 0x82, 0x48, 0x82, 0x60, 0xa3, 0x88, 0xc3, 0xb0, 0x61, 0xc0, 0x21, 0xc8, 0x21, 0xd0, 0x22, 0xc8, 0x22, 0xc0, 0x01, 0xb0, 0x20, 0xb0, 0x61, 0xb0, 0xa2, 0xc0, 0x45, 0xd9, 0x21, 0xb8, 0x01, 0xb8, 0x01, 0xb8, 0x01, 0xc0, 0x22, 0xc8, 0x01, 0xc8, 0x22, 0xc0, 0x05, 0xe1, 0x47, 0xe9, 0x47, 0xd1, 0xc4, 0xa8, 0x00, 0x70, 0x00, 0x60, 0x00, 0x70, 0x00, 0x88, 0x21, 0xb0, 0x22, 0xc8, 0x22, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xd0, 0x21, 0xc8, 0x21, 0xc0, 0x20, 0xc0, 0x00, 0xc8, 0x20, 0xd8, 0x00, 0xd0, 0x00, 0xc0, 0x25, 0xc1, 0x4a, 0xc2, 0xc8, 0x89, 0x21, 0x38, 0xc2, 0x38, 0x21, 0x60, 0x88, 0xb9, 0xe9, 0xc1, 0x85, 0x71, 0x98, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x92, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x01, 0xc8, 0x84, 0x98, 0xcf, 0x93, 0x7b, 0xde, 0x7b, 0xe6, 0xf5, 0xcc, 0xc4, 0x58, 0x00, 0x38, 0x00, 0x50, 0x00, 0x58, 0x82, 0x70, 0x66, 0x89, 0x85, 0x79, 0x65, 0x81, 0x66, 0x99, 0x05, 0xa1, 0xc5, 0xa0, 0xe5, 0xa8, 0x06, 0xb1, 0xc4, 0xa0, 0x67, 0xb1, 0xe5, 0x98, 0x25, 0x91, 0x04, 0x79, 0x00, 0x28, 0xe3, 0x80, 0x44, 0xa1, 0x00, 0x78, 0x20, 0x90, 0x00, 0x98, 0x21, 0xa8, 0x25, 0xb9, 0x49, 0xc2, 0x69, 0xba, 0x8a, 0xba, 0x49, 0xba, 0x49, 0xb2, 0x6a, 0xb2, 0x08, 0x9a, 0x8a, 0xb2, 0xab, 0xe2, 0xa5, 0xc0, 0x00, 0xa8, 0x25, 0xc1, 0xc6, 0xc9, 0x61, 0x80, 0x20, 0x88, 0x00, 0xa8, 0x21, 0xb0, 0x42, 0xb8, 0x25, 0xc9, 0xc7, 0xc9, 0xc3, 0xa8, 0x00, 0xa0, 0x00, 0xa0, 0x41, 0xb0, 0xe3, 0xb0, 0xc1, 0x88, 0x60, 0x68, 0xa2, 0x90, 0xe5, 0xc8, 0x23, 0xd0, 0xa6, 0xe0, 0x84, 0xb8, 0x21, 0x80, 0x62, 0x60, 0x00, 0x38, 0x00, 0x28, 0x40, 0x30, 0x20, 0x20, 0x20, 0x20, 0x40, 0x38, 0x00, 0x40, 0x00, 0x58, 0x20, 0x70, 0x42, 0x90, 0x42, 0xa0, 0x00, 0x90, 0x20, 0x50, 0x61, 0x20, 0xe2, 0x30, 0x41, 0x28, 0x28, 0x82, 0xaa, 0xb2, 0x69, 0xca, 0x45, 0xc9, 0xa2, 0xc8, 0x20, 0xc8, 0x61, 0xc8, 0x82, 0xc0, 0x41, 0xa8, 0x00, 0x90, 0x20, 0xa0, 0x04, 0xc1, 0xa6, 0xd1, 0xc7, 0xd9, 0xa2, 0xb0, 0x82, 0xb0, 0x62, 0xa8, 0xa3, 0xb8, 0x62, 0xb0, 0x01, 0xa8, 0x43, 0xb8, 0x01, 0xb0, 0xa8, 0xe1, 0x88, 0xd1, 0x46, 0xb1, 0x40, 0x70, 0x00, 0x58, 0x81, 0x78, 0x82, 0xa0, 0x62, 0xc0, 0xc5, 0xe8, 0x83, 0xe0, 0x21, 0xc8, 0x40, 0xc8, 0x40, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x21, 0xc0, 0x61, 0xc0, 0x61, 0xb8, 0x81, 0xc0, 0x61, 0xc8, 0x21, 0xd0, 0x41, 0xd0, 0x62, 0xc0, 0x25, 0xb1, 0xe8, 0xa1, 0x87, 0x71, 0x82, 0x30, 0xc2, 0x30, 0x82, 0x60, 0x47, 0xb1, 0xa8, 0xc1, 0x86, 0x79, 0xb9, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x92, 0xec, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x01, 0xc8, 0x84, 0x98, 0xaf, 0x9b, 0x3a, 0xde, 0x1a, 0xe6, 0xb0, 0xa3, 0xa3, 0x58, 0x41, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0xc2, 0x50, 0xe3, 0x60, 0x65, 0x81, 0x25, 0x99, 0x25, 0xb1, 0x46, 0xb9, 0x46, 0xb9, 0x25, 0xa1, 0x65, 0x91, 0xa2, 0x68, 0x20, 0x50, 0xc4, 0x70, 0x87, 0x91, 0x65, 0x99, 0xe3, 0x98, 0x00, 0x78, 0x82, 0x98, 0xa2, 0xb0, 0x20, 0xa8, 0x08, 0xda, 0xef, 0xfb, 0x10, 0xfc, 0x51, 0xfc, 0xef, 0xfb, 0xef, 0xfb, 0x10, 0xfc, 0xae, 0xf3, 0xcf, 0xf3, 0xac, 0xea, 0x23, 0xb0, 0x62, 0xb0, 0x04, 0xc1, 0x86, 0xc1, 0x03, 0xa9, 0xa1, 0xa0, 0x61, 0xa8, 0x82, 0xc0, 0x62, 0xc0, 0x00, 0xb8, 0x00, 0xb0, 0xc2, 0xa8, 0x24, 0xc9, 0xc3, 0xd8, 0xc3, 0xd8, 0x65, 0xd1, 0xa5, 0xb1, 0x27, 0xba, 0x85, 0xb9, 0x00, 0xb8, 0x02, 0xc8, 0x84, 0xe0, 0x62, 0xb0, 0x40, 0x80, 0x00, 0x60, 0x83, 0x68, 0x04, 0x71, 0xa2, 0x60, 0x20, 0x50, 0x00, 0x48, 0x00, 0x50, 0x00, 0x60, 0x20, 0x80, 0x82, 0xa0, 0xc3, 0xb0, 0x62, 0xb0, 0x00, 0xa0, 0x00, 0x68, 0x20, 0x28, 0xa2, 0x38, 0x41, 0x38, 0xe8, 0x89, 0x49, 0xb2, 0x07, 0xca, 0xe3, 0xd0, 0x61, 0xd0, 0x00, 0xd0, 0x20, 0xc8, 0x41, 0xc0, 0x20, 0xa8, 0x00, 0x98, 0x00, 0x98, 0x82, 0xb0, 0x04, 0xb9, 0x41, 0x98, 0x00, 0x88, 0x00, 0x78, 0x00, 0x80, 0x20, 0x88, 0x00, 0x80, 0x00, 0x80, 0x21, 0x98, 0x00, 0x88, 0xc4, 0xa8, 0xc5, 0xb0, 0xa4, 0x98, 0x00, 0x58, 0x00, 0x48, 0x41, 0x70, 0x42, 0x98, 0x22, 0xb8, 0x84, 0xe0, 0x63, 0xd8, 0x62, 0xd0, 0x00, 0xb0, 0x20, 0xb0, 0x40, 0xb8, 0x00, 0xc0, 0x00, 0xc0, 0x41, 0xb8, 0x82, 0xb8, 0xa2, 0xb0, 0xc2, 0xb8, 0xa2, 0xc8, 0xc3, 0xd8, 0xa2, 0xd0, 0xc3, 0xc8, 0x46, 0xb1, 0x87, 0x89, 0x25, 0x51, 0xc3, 0x28, 0xa1, 0x20, 0x62, 0x60, 0x06, 0xb1, 0x67, 0xb9, 0x86, 0x79, 0xb8, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x92, 0xec, 0x00, 0xb0, 0x00, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x21, 0xc8, 0x83, 0x98, 0x8f, 0x9b, 0xd8, 0xd5, 0xb8, 0xdd, 0x2a, 0x72, 0x41, 0x50, 0xe3, 0x78, 0x40, 0x68, 0x40, 0x68, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x50, 0x00, 0x58, 0x60, 0x70, 0xa1, 0x80, 0x80, 0x70, 0x60, 0x58, 0x40, 0x40, 0x20, 0x30, 0x00, 0x40, 0x67, 0x89, 0x6b, 0xba, 0xc7, 0xa1, 0x24, 0x91, 0x41, 0x90, 0xe3, 0xb0, 0x04, 0xc9, 0x00, 0x90, 0xe3, 0xb8, 0x86, 0xb9, 0x86, 0xb1, 0xc7, 0xb1, 0x86, 0xb1, 0xa7, 0xb9, 0xa7, 0xb9, 0xa7, 0xb1, 0x08, 0xc2, 0x05, 0xa1, 0x21, 0x90, 0x83, 0xb8, 0x41, 0xa0, 0x20, 0x98, 0x61, 0x90, 0x60, 0x90, 0x00, 0x88, 0x20, 0x98, 0x62, 0xa8, 0x22, 0xb0, 0x62, 0xb0, 0x64, 0xb9, 0x08, 0xea, 0x25, 0xe1, 0x00, 0xc0, 0x00, 0xb8, 0x23, 0xb1, 0x84, 0xb1, 0x03, 0xb1, 0xe4, 0xd0, 0x83, 0xd0, 0x62, 0xb8, 0x40, 0x88, 0x20, 0x68, 0x62, 0x88, 0x4a, 0xd2, 0x8b, 0xd2, 0xc3, 0x88, 0x21, 0x78, 0x41, 0x80, 0x00, 0x70, 0x00, 0x80, 0x21, 0x98, 0xa2, 0xb0, 0x82, 0xa8, 0x00, 0xa0, 0x40, 0xa8, 0xe3, 0x88, 0x01, 0x48, 0x00, 0x40, 0x00, 0x48, 0x21, 0x68, 0x00, 0x80, 0x00, 0xa8, 0x20, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xb8, 0x41, 0xb8, 0xc7, 0xe9, 0x05, 0xc9, 0x04, 0xc1, 0xe4, 0xb0, 0xcb, 0xda, 0xa5, 0xa9, 0x07, 0xaa, 0xe7, 0xa1, 0x65, 0x99, 0x86, 0xa1, 0xe8, 0xb9, 0xab, 0xd2, 0xc7, 0xb1, 0xe6, 0xb8, 0x22, 0x98, 0x00, 0x60, 0x00, 0x60, 0x40, 0x78, 0x00, 0x98, 0x22, 0xc0, 0x01, 0xc8, 0xc4, 0xd8, 0x66, 0xe9, 0x81, 0xb8, 0xc2, 0xb8, 0xa5, 0xd9, 0x03, 0xc1, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x98, 0x40, 0x98, 0x40, 0xa0, 0x20, 0xa8, 0x41, 0xb8, 0x20, 0xb0, 0x41, 0xa0, 0x04, 0x99, 0x25, 0x71, 0x04, 0x41, 0x04, 0x29, 0xe2, 0x28, 0x20, 0x58, 0x48, 0xb9, 0xc9, 0xc9, 0x65, 0x71, 0x98, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x14, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd0, 0x62, 0xc0, 0xa3, 0x90, 0x4d, 0xa3, 0xd7, 0xed, 0x92, 0xc4, 0x24, 0x61, 0x62, 0x68, 0x41, 0x78, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x78, 0x61, 0x78, 0x40, 0x68, 0x00, 0x48, 0x00, 0x40, 0xc2, 0x50, 0x45, 0x61, 0x04, 0x69, 0xe4, 0x70, 0xa8, 0x89, 0x6a, 0x9a, 0xc7, 0x79, 0x41, 0x40, 0x29, 0x72, 0xa7, 0x79, 0xa3, 0x88, 0x20, 0xa0, 0x20, 0xb0, 0x00, 0xa0, 0x00, 0x88, 0x81, 0x80, 0x41, 0x70, 0x00, 0x68, 0x83, 0x98, 0x83, 0xb0, 0x21, 0xb0, 0x05, 0xc1, 0xc8, 0xc1, 0x24, 0x91, 0x00, 0x68, 0x00, 0x88, 0x00, 0x78, 0x00, 0x58, 0x00, 0x60, 0x00, 0x58, 0x00, 0x48, 0x61, 0x40, 0x20, 0x38, 0x00, 0x40, 0x42, 0x68, 0x61, 0x78, 0x41, 0x78, 0xe4, 0xa8, 0x26, 0xc1, 0x6a, 0xea, 0x45, 0xc1, 0x40, 0xa8, 0x00, 0xa8, 0x48, 0xf2, 0x08, 0xe2, 0x62, 0xa0, 0x86, 0x99, 0x08, 0xaa, 0xe5, 0xc0, 0x67, 0xd9, 0x87, 0xc9, 0xa3, 0x98, 0x40, 0x80, 0xc2, 0x88, 0x24, 0x99, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x00, 0x70, 0x86, 0x91, 0xce, 0xd3, 0xcb, 0xaa, 0x82, 0x68, 0x00, 0x38, 0x00, 0x40, 0x00, 0x58, 0x00, 0x80, 0x43, 0xc0, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x20, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x20, 0xc0, 0x45, 0xd9, 0xa3, 0xc0, 0x21, 0xb8, 0x66, 0xd1, 0x49, 0xda, 0x48, 0xca, 0x48, 0xc2, 0x08, 0xca, 0xc4, 0xb8, 0x66, 0xd9, 0x25, 0xd1, 0xc7, 0xd9, 0xc7, 0xd9, 0x63, 0xc8, 0x01, 0xb8, 0x82, 0xa8, 0xa6, 0xc1, 0xc6, 0xb9, 0xa6, 0xc1, 0xa7, 0xc9, 0x01, 0xb0, 0x25, 0xd1, 0x46, 0xe1, 0x82, 0xc0, 0xc3, 0xc8, 0x65, 0xd1, 0xa2, 0xb8, 0x00, 0xa0, 0x00, 0x98, 0xc2, 0xb0, 0x40, 0x98, 0x40, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x41, 0xa0, 0x61, 0x80, 0xc3, 0x58, 0x45, 0x39, 0x03, 0x29, 0x80, 0x40, 0x41, 0x70, 0x68, 0xc1, 0x27, 0xa1, 0xc7, 0x79, 0xba, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x35, 0xed, 0x00, 0xa8, 0x21, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x21, 0xd0, 0x61, 0xb8, 0x82, 0x88, 0x8e, 0xc3, 0x75, 0xf5, 0xeb, 0x9a, 0x82, 0x68, 0x41, 0x78, 0x00, 0x88, 0x00, 0x90, 0x00, 0x90, 0x00, 0x88, 0x00, 0x88, 0x00, 0x80, 0x41, 0x80, 0x41, 0x70, 0x00, 0x50, 0x00, 0x30, 0x61, 0x28, 0xa3, 0x38, 0xa4, 0x48, 0x84, 0x60, 0x64, 0x68, 0x62, 0x50, 0x81, 0x38, 0xa1, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60, 0x00, 0xa0, 0x40, 0xc0, 0x00, 0xa8, 0x00, 0x78, 0x00, 0x50, 0x00, 0x58, 0x00, 0x50, 0x01, 0x80, 0x42, 0xa8, 0x41, 0xc0, 0x87, 0xd9, 0x09, 0xd2, 0xe2, 0x78, 0x00, 0x48, 0x00, 0x78, 0x00, 0x70, 0x20, 0x58, 0x00, 0x50, 0x00, 0x48, 0x61, 0x30, 0x23, 0x29, 0x03, 0x21, 0x41, 0x20, 0x01, 0x40, 0x00, 0x58, 0x00, 0x58, 0x21, 0x70, 0x21, 0x80, 0xe8, 0xd9, 0x29, 0xea, 0x00, 0xb8, 0x40, 0xc0, 0x65, 0xd9, 0x65, 0xc9, 0x62, 0x98, 0xc4, 0x88, 0xc4, 0x88, 0x84, 0xc0, 0x63, 0xd0, 0x21, 0xa8, 0x00, 0x78, 0x60, 0x80, 0x68, 0xb2, 0xce, 0xdb, 0xc7, 0xa9, 0x82, 0x78, 0x00, 0x60, 0x00, 0x48, 0x61, 0x50, 0x48, 0x82, 0xc7, 0x81, 0x20, 0x58, 0x00, 0x40, 0x60, 0x48, 0x40, 0x70, 0x00, 0x98, 0x01, 0xb8, 0x22, 0xc0, 0x20, 0xb0, 0x40, 0xb0, 0x40, 0xb8, 0x20, 0xc8, 0x20, 0xd8, 0x40, 0xd8, 0xa2, 0xc8, 0xa7, 0xe1, 0x86, 0xe1, 0x25, 0xc9, 0xc3, 0xb0, 0xc7, 0xc1, 0x08, 0xca, 0x45, 0xc1, 0x21, 0xb0, 0xc4, 0xd8, 0x83, 0xd0, 0x00, 0xb0, 0x00, 0xa8, 0x08, 0xfa, 0x45, 0xe1, 0x61, 0xb8, 0x24, 0xc1, 0xa6, 0xc9, 0x24, 0xb9, 0x00, 0x98, 0x83, 0xb8, 0x62, 0xb8, 0x00, 0xb0, 0x62, 0xc0, 0x21, 0xb8, 0x62, 0xb8, 0xe4, 0xd0, 0xe3, 0xc0, 0xa2, 0xa8, 0xe3, 0xb0, 0xa5, 0xc1, 0x60, 0xa8, 0x44, 0xd1, 0x03, 0xd9, 0x61, 0xc0, 0xe3, 0xb0, 0x45, 0x99, 0x04, 0x59, 0x04, 0x29, 0xc3, 0x28, 0x60, 0x50, 0x22, 0x80, 0x68, 0xb9, 0x68, 0xa1, 0xa7, 0x61, 0xba, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x35, 0xed, 0x00, 0xb0, 0x21, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x21, 0xd8, 0x21, 0xb8, 0x82, 0x98, 0xaa, 0xb2, 0x4d, 0xbb, 0x25, 0x71, 0x41, 0x70, 0x21, 0x80, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x01, 0x80, 0x01, 0x70, 0x01, 0x50, 0x41, 0x38, 0xa2, 0x28, 0xa2, 0x20, 0x62, 0x28, 0x43, 0x38, 0x01, 0x38, 0x00, 0x20, 0x40, 0x18, 0xc1, 0x18, 0x03, 0x19, 0xa2, 0x30, 0x00, 0x60, 0x00, 0x98, 0x00, 0xc0, 0x40, 0xc0, 0x40, 0xa8, 0x41, 0x80, 0x00, 0x60, 0x01, 0x70, 0x21, 0x88, 0x00, 0x78, 0xa2, 0xa8, 0xc8, 0xd9, 0x87, 0xc1, 0x81, 0x70, 0x00, 0x60, 0x61, 0x98, 0x61, 0x90, 0x81, 0x78, 0x41, 0x70, 0x01, 0x58, 0x41, 0x38, 0xe3, 0x30, 0xc3, 0x20, 0x21, 0x28, 0xc3, 0x58, 0x45, 0x81, 0xa6, 0xa1, 0x46, 0xa9, 0x8b, 0xe2, 0x05, 0xb9, 0x00, 0xa8, 0x41, 0xc0, 0x20, 0xc0, 0x00, 0xb8, 0x40, 0xb0, 0x41, 0x98, 0x41, 0x80, 0x00, 0x68, 0x01, 0xa0, 0x00, 0xa8, 0x00, 0x90, 0x00, 0x70, 0x20, 0x70, 0xc6, 0x99, 0xcb, 0xc2, 0x05, 0x99, 0x01, 0x70, 0x00, 0x68, 0x21, 0x60, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x40, 0x38, 0x80, 0x50, 0x61, 0x78, 0x21, 0xa0, 0x00, 0xc0, 0x00, 0xb8, 0x40, 0xb8, 0x60, 0xb8, 0x20, 0xc0, 0x00, 0xd0, 0x00, 0xd8, 0x21, 0xd8, 0x86, 0xf1, 0x86, 0xe1, 0x45, 0xd1, 0x65, 0xc9, 0x24, 0xb9, 0x49, 0xe2, 0x49, 0xe2, 0xe8, 0xe1, 0xa7, 0xe1, 0x08, 0xf2, 0x29, 0xfa, 0x65, 0xe9, 0x41, 0xc8, 0xe6, 0xd9, 0x06, 0xda, 0xe2, 0xb8, 0x00, 0xa8, 0x82, 0xb8, 0x42, 0xb8, 0x01, 0xb0, 0x62, 0xc0, 0x83, 0xc0, 0xc7, 0xe1, 0x87, 0xe9, 0x41, 0xc0, 0x41, 0xc0, 0x62, 0xc8, 0x29, 0xea, 0x69, 0xea, 0xa2, 0xa8, 0xe7, 0xd9, 0x85, 0xd1, 0x82, 0xc0, 0xc3, 0xd0, 0xc3, 0xd0, 0xc7, 0xd9, 0xe8, 0xb1, 0xa2, 0x50, 0x82, 0x20, 0x24, 0x39, 0x20, 0x58, 0x83, 0x88, 0x68, 0xb1, 0xe9, 0xa1, 0x86, 0x49, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x35, 0xed, 0x00, 0xb0, 0x21, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xe0, 0x20, 0xc0, 0x61, 0xa0, 0xa3, 0x90, 0x00, 0x70, 0x41, 0x70, 0x21, 0x80, 0x01, 0x88, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x90, 0x20, 0x88, 0x01, 0x88, 0x00, 0x80, 0x00, 0x70, 0x01, 0x60, 0xa3, 0x50, 0x24, 0x39, 0x24, 0x29, 0xe4, 0x20, 0xc4, 0x28, 0xa4, 0x30, 0xc4, 0x30, 0xe3, 0x20, 0x03, 0x19, 0xc2, 0x08, 0xe3, 0x38, 0xc3, 0x80, 0x41, 0xb0, 0x00, 0xc8, 0x21, 0xc8, 0x41, 0xb8, 0x62, 0x98, 0x42, 0x88, 0x22, 0x88, 0x21, 0x88, 0x41, 0x90, 0x23, 0xb1, 0xe8, 0xd1, 0x67, 0xb9, 0x21, 0x70, 0x00, 0x68, 0xa2, 0xa8, 0x81, 0xa0, 0x81, 0x88, 0x83, 0x90, 0x01, 0x68, 0x21, 0x38, 0xa3, 0x30, 0x82, 0x20, 0x63, 0x30, 0x87, 0x71, 0x28, 0xa2, 0xeb, 0xd2, 0xc7, 0xb1, 0x6a, 0xda, 0xa7, 0xd9, 0x41, 0xc8, 0x00, 0xc0, 0x61, 0xd8, 0x00, 0xc0, 0x61, 0xc0, 0xc2, 0xb0, 0xa2, 0x98, 0x01, 0x80, 0x00, 0x90, 0x00, 0x98, 0x00, 0x88, 0x00, 0x68, 0x00, 0x60, 0x00, 0x70, 0x41, 0x80, 0x83, 0x90, 0x42, 0x88, 0x01, 0x78, 0x42, 0x78, 0x21, 0x60, 0x00, 0x48, 0x00, 0x40, 0x00, 0x40, 0x20, 0x30, 0x00, 0x38, 0x00, 0x60, 0x00, 0xa0, 0x00, 0xc0, 0x00, 0xb8, 0x40, 0xc0, 0x60, 0xc8, 0x20, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x42, 0xd8, 0x20, 0xb8, 0x61, 0xb0, 0x24, 0xb9, 0xa3, 0xa0, 0xe4, 0xc0, 0xa4, 0xc0, 0xa8, 0xe1, 0x09, 0xe2, 0xa6, 0xd1, 0x69, 0xfa, 0xe8, 0xf1, 0x42, 0xc8, 0x20, 0xa0, 0xc1, 0xa8, 0x81, 0xb0, 0x00, 0xb0, 0x01, 0xb8, 0x00, 0xa8, 0x00, 0xb8, 0x21, 0xb8, 0xa2, 0xb8, 0x8a, 0xf2, 0xe7, 0xe9, 0x41, 0xc8, 0xa3, 0xd0, 0xc4, 0xd0, 0x86, 0xd9, 0x49, 0xea, 0xe8, 0xd9, 0xc7, 0xd9, 0xa7, 0xe1, 0xe4, 0xd8, 0x00, 0xc0, 0x41, 0xc0, 0x86, 0xd1, 0x08, 0xba, 0x66, 0x69, 0xe4, 0x30, 0x62, 0x30, 0x00, 0x60, 0xc5, 0x98, 0x87, 0xa9, 0x2a, 0x9a, 0x86, 0x39, 0xba, 0xce, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x55, 0xed, 0x00, 0xb0, 0x21, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe0, 0x41, 0xd0, 0x00, 0xa8, 0x00, 0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x90, 0x20, 0x88, 0x21, 0x90, 0x01, 0x88, 0x02, 0x80, 0x43, 0x70, 0x83, 0x58, 0xe3, 0x30, 0x03, 0x19, 0x24, 0x11, 0x04, 0x21, 0xc4, 0x20, 0xa3, 0x20, 0xc3, 0x18, 0xc2, 0x18, 0x64, 0x29, 0xa6, 0x59, 0x45, 0x91, 0x42, 0xb0, 0x00, 0xc0, 0x00, 0xc8, 0x21, 0xc0, 0x01, 0xa0, 0x42, 0x98, 0x01, 0x90, 0x00, 0x88, 0x61, 0x98, 0x60, 0x90, 0x05, 0xa9, 0x25, 0xb1, 0x00, 0x70, 0x00, 0x68, 0x41, 0xa8, 0x21, 0xa0, 0x00, 0x88, 0x02, 0x90, 0x22, 0x80, 0x21, 0x48, 0xa3, 0x38, 0xe4, 0x38, 0x62, 0x30, 0x82, 0x40, 0x44, 0x81, 0xef, 0xe3, 0x10, 0xf4, 0xab, 0xe2, 0x25, 0xc9, 0x41, 0xc0, 0x00, 0xb8, 0x61, 0xd8, 0x00, 0xc8, 0x20, 0xb0, 0x41, 0xa0, 0x20, 0x88, 0x00, 0x70, 0x00, 0x88, 0x40, 0x90, 0x40, 0x88, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x21, 0x80, 0xa3, 0x98, 0x63, 0x98, 0x22, 0x88, 0x01, 0x78, 0x62, 0x70, 0x00, 0x58, 0x00, 0x48, 0x01, 0x40, 0x20, 0x30, 0x00, 0x30, 0x00, 0x58, 0x00, 0x90, 0x20, 0xb8, 0x00, 0xb8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x21, 0xc8, 0x83, 0xd0, 0x26, 0xe9, 0x62, 0xc0, 0x00, 0x98, 0x00, 0x88, 0x00, 0x80, 0xe4, 0xc8, 0x67, 0xd9, 0x05, 0xc9, 0x25, 0xb9, 0xe3, 0xa8, 0x65, 0xc1, 0x04, 0xc9, 0x42, 0xc0, 0x41, 0xb0, 0x20, 0xa0, 0x20, 0xa8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0x98, 0x08, 0xe2, 0x8a, 0xe2, 0x48, 0xd2, 0xe6, 0xc9, 0x4c, 0xfb, 0x29, 0xf2, 0xe4, 0xd8, 0x6a, 0xfa, 0x4d, 0xfb, 0x4d, 0xfb, 0x08, 0xda, 0xc3, 0xb0, 0x08, 0xf2, 0xe4, 0xc8, 0x21, 0xc8, 0x62, 0xc8, 0xa7, 0xd9, 0x4a, 0xc2, 0x08, 0x8a, 0x66, 0x49, 0x42, 0x30, 0x01, 0x70, 0x26, 0xa1, 0xa8, 0xa1, 0x29, 0x82, 0xa6, 0x31, 0xb9, 0xc6, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x55, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x41, 0xd0, 0x21, 0xb8, 0x00, 0x90, 0x42, 0x98, 0x21, 0x88, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x90, 0x20, 0x88, 0x20, 0x88, 0x20, 0x90, 0x01, 0x90, 0x22, 0x90, 0x43, 0x80, 0x83, 0x60, 0xa2, 0x38, 0xe2, 0x18, 0x23, 0x11, 0x03, 0x19, 0xa3, 0x20, 0x62, 0x20, 0xa3, 0x28, 0xe3, 0x30, 0x20, 0x10, 0xc2, 0x48, 0xe4, 0x90, 0x83, 0xc0, 0x01, 0xc8, 0x00, 0xc0, 0x00, 0xb0, 0x00, 0x90, 0x00, 0x78, 0x01, 0x90, 0x21, 0x98, 0x61, 0xa0, 0xa1, 0xa0, 0x82, 0x98, 0xa3, 0x98, 0x20, 0x78, 0x00, 0x78, 0xa2, 0xb0, 0x82, 0xb0, 0x00, 0x90, 0x02, 0x98, 0x02, 0x80, 0x22, 0x48, 0xc4, 0x40, 0xa3, 0x38, 0x01, 0x20, 0xe4, 0x40, 0x51, 0xcc, 0x4c, 0xbb, 0xef, 0xdb, 0x31, 0xfc, 0x4a, 0xda, 0x25, 0xd1, 0x87, 0xe9, 0x04, 0xe1, 0x81, 0xc8, 0x00, 0xa0, 0x20, 0x98, 0x40, 0x88, 0x00, 0x70, 0x00, 0x88, 0x41, 0x90, 0x81, 0x90, 0x40, 0x88, 0x20, 0x80, 0x00, 0x78, 0x00, 0x78, 0x00, 0x80, 0x21, 0x80, 0x42, 0x90, 0x21, 0x78, 0x82, 0x70, 0x00, 0x50, 0x01, 0x48, 0x01, 0x48, 0x21, 0x30, 0x40, 0x30, 0x00, 0x48, 0x00, 0x78, 0x40, 0xa8, 0x60, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x01, 0xd0, 0x00, 0xb8, 0x00, 0xa0, 0xa3, 0xb0, 0xc4, 0xd0, 0x62, 0xb8, 0x20, 0xa0, 0x41, 0xa0, 0x00, 0x98, 0x62, 0xb8, 0x46, 0xd1, 0xc3, 0xb0, 0x00, 0x90, 0x40, 0x90, 0x41, 0x98, 0x00, 0xa0, 0x63, 0xc0, 0x22, 0xc0, 0x22, 0xc0, 0x42, 0xc0, 0x00, 0xa0, 0x00, 0x90, 0x00, 0x88, 0x30, 0xfc, 0x2f, 0xf4, 0xad, 0xdb, 0xe6, 0xa9, 0x8d, 0xf3, 0xcb, 0xf2, 0x01, 0xc0, 0x28, 0xe2, 0x28, 0xda, 0xa6, 0xc1, 0xe8, 0xd1, 0x66, 0xc9, 0xa7, 0xe1, 0x25, 0xe1, 0x00, 0xb0, 0x21, 0xb8, 0x87, 0xd1, 0xc7, 0xa9, 0xa3, 0x58, 0x62, 0x28, 0x83, 0x40, 0x63, 0x80, 0xa8, 0xb9, 0x08, 0x9a, 0x07, 0x6a, 0xe6, 0x31, 0xb9, 0xbe, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x55, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xe0, 0x20, 0xd0, 0x20, 0xc8, 0xa3, 0xc8, 0x00, 0x90, 0x00, 0x90, 0x01, 0x90, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x90, 0x20, 0x88, 0x40, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00, 0x90, 0x22, 0x88, 0x83, 0x70, 0x24, 0x51, 0x85, 0x39, 0x64, 0x29, 0x24, 0x31, 0x45, 0x49, 0x87, 0x61, 0xa7, 0x69, 0x66, 0x61, 0x07, 0x72, 0xc7, 0x81, 0xe4, 0xa0, 0x21, 0xb0, 0x00, 0xc0, 0x20, 0xc0, 0x40, 0xb8, 0x20, 0xa0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x90, 0x03, 0xb9, 0xa5, 0xc9, 0xe3, 0xa8, 0xe4, 0xa0, 0x40, 0x78, 0x00, 0x68, 0x20, 0xa0, 0x41, 0xa8, 0x00, 0xa0, 0x43, 0xa8, 0x00, 0x70, 0x83, 0x40, 0x46, 0x51, 0x82, 0x28, 0x00, 0x20, 0x10, 0x9c, 0xba, 0xfe, 0x9a, 0xfe, 0x55, 0xed, 0x66, 0x79, 0x87, 0xa9, 0x4a, 0xda, 0x66, 0xd9, 0x25, 0xd1, 0x61, 0xb8, 0x00, 0x88, 0x40, 0x90, 0xc3, 0x88, 0x61, 0x78, 0x82, 0x90, 0x61, 0x98, 0x41, 0x90, 0x00, 0x80, 0x20, 0x88, 0x21, 0x88, 0x01, 0x88, 0x42, 0x90, 0x00, 0x70, 0x62, 0x88, 0x21, 0x70, 0x61, 0x68, 0x00, 0x50, 0x01, 0x48, 0x02, 0x48, 0x01, 0x30, 0x00, 0x30, 0x00, 0x48, 0x00, 0x70, 0x81, 0xa8, 0xe2, 0xc0, 0x81, 0xc0, 0xc4, 0xd8, 0x05, 0xe1, 0x42, 0xb8, 0x00, 0x80, 0x61, 0x90, 0xc3, 0xb8, 0x04, 0xc1, 0x82, 0xb0, 0x82, 0xb0, 0x62, 0xa8, 0x66, 0xc9, 0xc7, 0xd1, 0xe3, 0xa0, 0x61, 0x90, 0x40, 0x88, 0x00, 0x88, 0x20, 0x90, 0x00, 0x98, 0x02, 0xb8, 0x03, 0xc0, 0x64, 0xc0, 0x83, 0xa8, 0xe4, 0xa0, 0x00, 0x70, 0x4c, 0xc3, 0xb5, 0xfd, 0x91, 0xe4, 0xea, 0xc2, 0x48, 0xc2, 0x6a, 0xe2, 0x86, 0xd1, 0x00, 0xa0, 0x81, 0xa0, 0xe3, 0xa8, 0xa3, 0xa8, 0x09, 0xda, 0xa7, 0xe1, 0x62, 0xb8, 0x41, 0xc0, 0x21, 0xb0, 0x86, 0xc1, 0xe8, 0xb1, 0xa3, 0x58, 0x62, 0x28, 0xe4, 0x50, 0xa4, 0x90, 0x09, 0xc2, 0x49, 0x9a, 0xc6, 0x59, 0x06, 0x32, 0x99, 0xbe, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x96, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc0, 0xa2, 0xc0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x90, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x90, 0x20, 0x88, 0x40, 0x80, 0x40, 0x80, 0x20, 0x88, 0x00, 0x90, 0x00, 0x98, 0x42, 0x98, 0x41, 0x78, 0xa2, 0x58, 0x02, 0x41, 0x23, 0x41, 0x24, 0x49, 0x86, 0x71, 0x25, 0x79, 0x46, 0x81, 0x25, 0x79, 0x86, 0x81, 0x24, 0x89, 0x83, 0xa0, 0x42, 0xb8, 0x21, 0xc0, 0x00, 0xb0, 0x00, 0x98, 0x20, 0x98, 0x82, 0xb0, 0x20, 0xa8, 0x00, 0xa8, 0x24, 0xd1, 0x08, 0xe2, 0xa7, 0xc9, 0x82, 0x98, 0x43, 0xa1, 0x00, 0x68, 0x81, 0xa8, 0x40, 0xa0, 0x00, 0x98, 0x02, 0xa0, 0x02, 0x80, 0x21, 0x30, 0x04, 0x39, 0x42, 0x28, 0x86, 0x39, 0x9e, 0xff, 0x5c, 0xf7, 0xba, 0xee, 0x9f, 0xff, 0xb8, 0xf5, 0xac, 0xa2, 0x87, 0xa1, 0x26, 0xb1, 0x42, 0xa0, 0x41, 0x98, 0x61, 0x98, 0x00, 0x80, 0x82, 0x80, 0x00, 0x60, 0x25, 0x99, 0x04, 0xb1, 0xa3, 0xa8, 0x41, 0x98, 0x00, 0x90, 0x01, 0x90, 0x21, 0x90, 0x00, 0x88, 0x00, 0x80, 0x62, 0x80, 0xa2, 0x78, 0x40, 0x60, 0x20, 0x50, 0x00, 0x40, 0x02, 0x40, 0x01, 0x38, 0x42, 0x48, 0xc3, 0x78, 0x21, 0x80, 0x61, 0x98, 0x40, 0x90, 0x00, 0x88, 0x41, 0x98, 0xa4, 0xb0, 0x43, 0xa0, 0x01, 0x78, 0x41, 0x78, 0xc7, 0xb9, 0xab, 0xf2, 0xc3, 0xc0, 0x41, 0xb0, 0xc3, 0xb8, 0xe7, 0xc9, 0xc6, 0xb9, 0x60, 0x80, 0x40, 0x80, 0x40, 0x80, 0x82, 0x90, 0x61, 0x88, 0x21, 0x88, 0x02, 0xa0, 0x01, 0x98, 0x22, 0x90, 0x62, 0x80, 0x04, 0x79, 0x00, 0x58, 0x6d, 0xbb, 0x75, 0xfd, 0xae, 0xdb, 0xa7, 0xa9, 0x29, 0xc2, 0xec, 0xea, 0xc4, 0xb0, 0x41, 0x98, 0x41, 0x90, 0xa2, 0x98, 0x49, 0xba, 0x2d, 0xd3, 0xe8, 0xd1, 0x21, 0xb0, 0x21, 0xb0, 0x41, 0xa8, 0x65, 0xb9, 0x08, 0xb2, 0x82, 0x58, 0xa3, 0x38, 0x42, 0x50, 0x84, 0x98, 0xa8, 0xb1, 0x48, 0x8a, 0xc6, 0x51, 0x06, 0x3a, 0x99, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x76, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x20, 0xc8, 0x20, 0xc0, 0xa2, 0xc0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x20, 0x90, 0x20, 0x88, 0x40, 0x80, 0x40, 0x88, 0x20, 0x90, 0x00, 0x98, 0x00, 0x98, 0x00, 0x90, 0x41, 0x78, 0xc2, 0x60, 0xe2, 0x58, 0x03, 0x59, 0x24, 0x69, 0x86, 0x91, 0x25, 0x91, 0x25, 0x91, 0xe4, 0x88, 0x04, 0x89, 0xe4, 0x98, 0x83, 0xa8, 0x21, 0xb0, 0x00, 0xb0, 0x00, 0xa0, 0x00, 0x98, 0x80, 0xa8, 0xa1, 0xb8, 0x20, 0xb0, 0x00, 0xb0, 0x62, 0xc8, 0x25, 0xd1, 0x86, 0xc9, 0x86, 0xb9, 0xea, 0xda, 0x00, 0x80, 0x61, 0x98, 0xa1, 0xa8, 0x00, 0x98, 0x22, 0xa0, 0x22, 0x78, 0x82, 0x28, 0x65, 0x41, 0x00, 0x00, 0x79, 0xd6, 0xbe, 0xff, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xff, 0xfd, 0xfe, 0x1a, 0xfe, 0xf1, 0xd3, 0x09, 0xaa, 0x66, 0xa9, 0xe4, 0xa0, 0x25, 0xa1, 0xa7, 0xa1, 0x66, 0x91, 0x42, 0x70, 0xe8, 0xc9, 0xc7, 0xd9, 0x05, 0xb9, 0x21, 0xa0, 0x00, 0x90, 0x21, 0x90, 0x41, 0x88, 0x00, 0x80, 0x82, 0x80, 0xc3, 0x88, 0xa1, 0x70, 0x20, 0x58, 0x20, 0x50, 0x00, 0x38, 0x21, 0x30, 0x21, 0x40, 0xa4, 0x70, 0x26, 0xa1, 0x22, 0x98, 0x01, 0x88, 0x20, 0x68, 0x40, 0x68, 0x20, 0x70, 0x01, 0x80, 0x01, 0x88, 0x01, 0x78, 0x21, 0x70, 0x81, 0x88, 0xc3, 0xb0, 0xe4, 0xc8, 0x00, 0xb0, 0xab, 0xf2, 0x85, 0xb9, 0xa1, 0x80, 0x80, 0x78, 0x20, 0x70, 0x40, 0x80, 0x20, 0x78, 0x00, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x68, 0x00, 0x58, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x6e, 0xcb, 0x36, 0xfd, 0x2a, 0xd2, 0x03, 0xa8, 0x00, 0x98, 0x00, 0xa0, 0x46, 0xb9, 0xe8, 0xc9, 0x60, 0xa0, 0xeb, 0xe2, 0x72, 0xfc, 0x51, 0xf4, 0x6a, 0xda, 0xe3, 0xb8, 0x20, 0xa8, 0x65, 0xc1, 0x07, 0xc2, 0xe7, 0xa9, 0xa2, 0x60, 0x62, 0x40, 0x63, 0x60, 0x06, 0xa9, 0xa7, 0xa9, 0x07, 0x7a, 0x06, 0x52, 0xc6, 0x39, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x76, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd0, 0x20, 0xc8, 0x20, 0xc0, 0xa2, 0xc0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x88, 0x00, 0x90, 0x20, 0x90, 0x20, 0x90, 0x20, 0x88, 0x20, 0x88, 0x21, 0x88, 0x20, 0x88, 0x00, 0x88, 0x20, 0x98, 0x00, 0x98, 0x20, 0x88, 0x61, 0x80, 0x81, 0x68, 0xe3, 0x68, 0x45, 0x79, 0x45, 0x89, 0xa7, 0xa9, 0x46, 0xa9, 0x45, 0xa1, 0x04, 0x91, 0x03, 0x91, 0xc3, 0x98, 0x83, 0xb0, 0x42, 0xb0, 0x00, 0xb0, 0x20, 0xa8, 0x60, 0xa8, 0xa1, 0xb8, 0x80, 0xc0, 0x20, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x82, 0xc0, 0x45, 0xc9, 0xa6, 0xc9, 0x0b, 0xeb, 0xc1, 0xa8, 0xa2, 0xa0, 0x43, 0xb9, 0x41, 0xa0, 0x01, 0x98, 0x22, 0x70, 0xe3, 0x20, 0x20, 0x18, 0xf0, 0x93, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x1c, 0xdf, 0x5a, 0xd6, 0x3a, 0xde, 0x9c, 0xfe, 0x98, 0xf5, 0x4e, 0xcb, 0x29, 0xba, 0xe4, 0x90, 0x45, 0xa1, 0x29, 0xba, 0x46, 0x99, 0xa3, 0x88, 0x83, 0x98, 0x83, 0xa8, 0x42, 0xa0, 0x00, 0x98, 0x41, 0xa0, 0x82, 0xa0, 0x41, 0x88, 0x00, 0x80, 0xe7, 0xa1, 0x48, 0xb2, 0xa6, 0x99, 0xa2, 0x70, 0x40, 0x60, 0x00, 0x30, 0x23, 0x49, 0x41, 0x40, 0x21, 0x58, 0xe6, 0xa8, 0x22, 0x98, 0x00, 0x78, 0xa1, 0x68, 0xe2, 0x60, 0xc2, 0x68, 0x41, 0x78, 0x01, 0x80, 0x01, 0x80, 0x00, 0x78, 0x00, 0x70, 0xe4, 0xa8, 0x0a, 0xfa, 0xc5, 0xd0, 0xcc, 0xfa, 0xe3, 0xa8, 0x00, 0x68, 0x20, 0x68, 0x00, 0x60, 0x20, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00, 0x58, 0x00, 0x50, 0x20, 0x48, 0x40, 0x48, 0x40, 0x48, 0x61, 0x50, 0x00, 0x50, 0x87, 0xa9, 0x8c, 0xe2, 0xc6, 0xc8, 0xc6, 0xd8, 0xc6, 0xd0, 0x2a, 0xf2, 0x8b, 0xf2, 0x49, 0xe2, 0x00, 0xa8, 0xcf, 0xfb, 0x71, 0xfc, 0x86, 0xd9, 0x69, 0xea, 0x65, 0xc9, 0x20, 0xa0, 0x89, 0xe2, 0xaa, 0xda, 0x48, 0xba, 0x45, 0x89, 0x21, 0x50, 0x42, 0x68, 0x67, 0xb1, 0x29, 0xaa, 0xa5, 0x69, 0xe6, 0x59, 0xe7, 0x51, 0xb7, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x76, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd0, 0x20, 0xc8, 0x20, 0xc0, 0xa2, 0xc0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x88, 0x20, 0x88, 0x20, 0x88, 0x20, 0x88, 0x20, 0x88, 0x00, 0x88, 0x01, 0x88, 0x01, 0x88, 0x00, 0x90, 0x40, 0x98, 0x21, 0x90, 0x41, 0x88, 0x82, 0x78, 0xc2, 0x70, 0x45, 0x79, 0x86, 0x91, 0x26, 0xa1, 0x87, 0xb9, 0x25, 0xa9, 0x85, 0xa1, 0x84, 0x91, 0x23, 0x91, 0xc2, 0x98, 0x82, 0xa8, 0x82, 0xb8, 0x62, 0xb8, 0x60, 0xb0, 0x60, 0xb8, 0x60, 0xc0, 0x20, 0xc8, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xb8, 0x41, 0xb8, 0xc3, 0xb8, 0x04, 0xc1, 0x24, 0xc1, 0xe2, 0xb0, 0x80, 0xa8, 0x23, 0xb9, 0x81, 0xa0, 0x01, 0x98, 0x00, 0x68, 0x20, 0x20, 0x49, 0x5a, 0x7a, 0xee, 0x9e, 0xff, 0xdf, 0xff, 0xbe, 0xf7, 0xdf, 0xff, 0xbf, 0xff, 0x19, 0xd6, 0x76, 0xd5, 0x97, 0xed, 0x29, 0x8a, 0x86, 0x99, 0x65, 0xa1, 0x00, 0x78, 0xa2, 0x90, 0x83, 0x88, 0x22, 0x80, 0x42, 0x98, 0x42, 0xa0, 0x01, 0x98, 0x00, 0x90, 0x00, 0x90, 0x21, 0x90, 0x00, 0x80, 0x00, 0x78, 0x28, 0xaa, 0xa9, 0xc2, 0xc6, 0xa9, 0xa2, 0x80, 0x00, 0x68, 0x40, 0x40, 0xa0, 0x40, 0x00, 0x28, 0x00, 0x58, 0x45, 0xa9, 0x62, 0x90, 0x00, 0x68, 0xa1, 0x58, 0xa1, 0x58, 0xe3, 0x78, 0xe4, 0xa0, 0x22, 0x98, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xc3, 0xb0, 0x46, 0xd9, 0xa4, 0xd0, 0xc4, 0xc8, 0x62, 0xa8, 0x61, 0x90, 0x81, 0x78, 0x00, 0x60, 0x81, 0x70, 0x82, 0x78, 0x21, 0x70, 0x01, 0x60, 0x40, 0x58, 0xc1, 0x60, 0x40, 0x58, 0x00, 0x50, 0x41, 0x78, 0x01, 0x80, 0x43, 0xa8, 0x23, 0xb8, 0x44, 0xc8, 0xa5, 0xd8, 0x63, 0xd0, 0xe8, 0xf9, 0x87, 0xe1, 0xa6, 0xd9, 0x04, 0xc1, 0x04, 0xb1, 0x25, 0xb1, 0x25, 0xc9, 0x24, 0xb9, 0xc2, 0xb0, 0x40, 0xa8, 0x68, 0xe2, 0x48, 0xd2, 0xe7, 0xb9, 0x86, 0xa9, 0x21, 0x68, 0x63, 0x78, 0xa7, 0xb1, 0xe7, 0x99, 0x64, 0x59, 0xe7, 0x61, 0xe8, 0x61, 0x97, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x76, 0xed, 0x00, 0xb0, 0x01, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd0, 0x20, 0xd0, 0x20, 0xc0, 0xa2, 0xc0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x88, 0x00, 0x88, 0x20, 0x88, 0x20, 0x88, 0x00, 0x90, 0x00, 0x90, 0x01, 0x90, 0x01, 0x90, 0x00, 0x90, 0x00, 0x88, 0x01, 0x88, 0x21, 0x78, 0x62, 0x68, 0x04, 0x71, 0x46, 0x81, 0x26, 0x91, 0xa5, 0x98, 0xe5, 0xa8, 0xc3, 0x90, 0x84, 0x89, 0xa4, 0x79, 0x42, 0x81, 0xa1, 0x88, 0x82, 0xa0, 0xa3, 0xb8, 0x62, 0xc0, 0x20, 0xb8, 0x40, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xb8, 0x41, 0xb0, 0x62, 0xb0, 0x62, 0xb8, 0x00, 0xa8, 0x60, 0xb0, 0x81, 0xa8, 0x81, 0xa8, 0x61, 0xa0, 0x01, 0x98, 0x22, 0x70, 0x00, 0x00, 0x14, 0xbd, 0x5e, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x7e, 0xf7, 0x3d, 0xf7, 0x7e, 0xff, 0xfc, 0xfe, 0xf0, 0xab, 0x00, 0x30, 0x44, 0x89, 0x65, 0xa1, 0xa2, 0x98, 0x04, 0xa9, 0x62, 0x98, 0x21, 0x90, 0x83, 0xa0, 0xa3, 0xa0, 0xa3, 0xa8, 0x62, 0xa0, 0x20, 0x90, 0x62, 0x90, 0x04, 0x91, 0x20, 0x78, 0x65, 0x91, 0xa6, 0xa9, 0xe3, 0x90, 0x21, 0x80, 0x20, 0x80, 0x20, 0x60, 0x00, 0x38, 0x20, 0x48, 0xeb, 0xcb, 0x26, 0xa2, 0x00, 0x60, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x42, 0x88, 0xc4, 0xc0, 0x22, 0xb0, 0x00, 0x88, 0x40, 0x90, 0x21, 0x98, 0x83, 0xb0, 0x42, 0xb8, 0xc4, 0xd0, 0x22, 0xb8, 0x00, 0xa8, 0x62, 0xa0, 0x81, 0x88, 0x00, 0x60, 0x40, 0x60, 0x82, 0x70, 0x22, 0x70, 0x00, 0x60, 0x00, 0x60, 0xa1, 0x80, 0x41, 0x80, 0x00, 0x78, 0x00, 0x88, 0x01, 0xa8, 0x42, 0xb8, 0x01, 0xb8, 0x22, 0xc0, 0xc4, 0xd8, 0x21, 0xc8, 0x21, 0xc8, 0x00, 0xc8, 0x20, 0xc8, 0x41, 0xc0, 0x62, 0xc0, 0x01, 0xb0, 0x21, 0xa8, 0x20, 0xa0, 0x20, 0xa0, 0x60, 0xa0, 0x23, 0xb9, 0x02, 0xb1, 0x24, 0xb1, 0x25, 0xa9, 0x01, 0x80, 0xe5, 0xa0, 0xa7, 0xb1, 0xe3, 0x70, 0x43, 0x51, 0xe7, 0x69, 0x46, 0x61, 0xf6, 0xd4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x76, 0xed, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0xd0, 0x20, 0xd0, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x82, 0xc8, 0x00, 0x98, 0x00, 0x90, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x90, 0x01, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0x90, 0x01, 0x88, 0xa3, 0x90, 0xe4, 0x80, 0xa3, 0x68, 0x04, 0x69, 0x87, 0x81, 0x67, 0x99, 0xe6, 0xa0, 0x46, 0xa9, 0x45, 0x99, 0x06, 0x8a, 0x45, 0x7a, 0x42, 0x71, 0xe1, 0x80, 0xc3, 0xa0, 0xc3, 0xb8, 0x21, 0xb8, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xe0, 0x00, 0xd0, 0x00, 0xb8, 0x61, 0xa0, 0x21, 0xa8, 0x22, 0xc0, 0x45, 0xe1, 0xc2, 0xc0, 0x44, 0xc9, 0x60, 0xa8, 0x41, 0xa8, 0x22, 0xa0, 0x00, 0x60, 0x07, 0x42, 0x39, 0xde, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x7d, 0xff, 0x9f, 0xff, 0x3d, 0xf7, 0xbb, 0xee, 0x15, 0xc5, 0x00, 0x40, 0x81, 0x60, 0x61, 0x70, 0x00, 0x78, 0x03, 0xa9, 0x66, 0xc9, 0x21, 0xa0, 0x21, 0xa0, 0xa3, 0xa8, 0x41, 0x98, 0x41, 0x98, 0x41, 0x98, 0x20, 0x88, 0xa6, 0xb1, 0x4c, 0xe3, 0x00, 0x70, 0x60, 0x80, 0x81, 0x88, 0x41, 0x88, 0x00, 0x88, 0x21, 0x98, 0xa0, 0x90, 0xe3, 0x89, 0xc3, 0x9a, 0x52, 0xfe, 0x0e, 0xd5, 0xe0, 0x58, 0x00, 0x38, 0x00, 0x50, 0x00, 0x70, 0x02, 0xb0, 0x43, 0xd8, 0x22, 0xc8, 0x40, 0x98, 0xa1, 0x90, 0x25, 0xc1, 0x67, 0xd1, 0x46, 0xd1, 0xa4, 0xc8, 0xe9, 0xf1, 0x00, 0xb8, 0x42, 0xb0, 0x00, 0x88, 0x00, 0x60, 0x20, 0x58, 0xc3, 0x70, 0xe5, 0x88, 0x23, 0x88, 0x04, 0xb1, 0xc3, 0xb8, 0x83, 0xc0, 0x83, 0xc8, 0x00, 0xb8, 0x01, 0xb8, 0x42, 0xc0, 0x24, 0xc9, 0xc2, 0xb8, 0x81, 0xb8, 0x40, 0xc0, 0x20, 0xc8, 0x00, 0xc0, 0x20, 0xd0, 0x00, 0xc0, 0x01, 0xc0, 0x05, 0xd1, 0x42, 0xa8, 0xa2, 0xb8, 0x82, 0xa0, 0x40, 0xa0, 0x20, 0xa0, 0xa1, 0xa8, 0x45, 0xb9, 0x05, 0xb9, 0x00, 0x88, 0x27, 0xb1, 0x05, 0x91, 0x23, 0x69, 0x84, 0x59, 0xc7, 0x69, 0x67, 0x71, 0x6d, 0xa2, 0xd9, 0xe5, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xde, 0xff, 0xb7, 0xed, 0x00, 0xa8, 0x87, 0xe1, 0xc3, 0xd8, 0x20, 0xd8, 0x00, 0xe0, 0x01, 0xe0, 0x00, 0xd0, 0x01, 0xd0, 0x22, 0xd8, 0x01, 0xd8, 0x00, 0xd0, 0x21, 0xd8, 0x20, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x01, 0xd8, 0x02, 0xe0, 0x01, 0xd0, 0x83, 0xe0, 0xe7, 0xe9, 0xc7, 0xe1, 0xa2, 0xb8, 0x00, 0x90, 0x20, 0x88, 0x20, 0x88, 0x00, 0x88, 0x21, 0x90, 0x41, 0x88, 0x00, 0x80, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x90, 0x21, 0x88, 0x66, 0xa1, 0x86, 0x99, 0xc3, 0x68, 0x45, 0x71, 0xa7, 0x81, 0x46, 0x89, 0x87, 0x99, 0x46, 0x99, 0x65, 0x91, 0xc6, 0x89, 0xe5, 0x81, 0xc4, 0x79, 0xc0, 0x78, 0x82, 0xb0, 0xc3, 0xc0, 0x20, 0xa0, 0x40, 0xb0, 0x61, 0xd0, 0x00, 0xd8, 0x00, 0xf0, 0x00, 0xe0, 0x00, 0xc8, 0x20, 0xb0, 0x40, 0xa8, 0x00, 0xa8, 0xc3, 0xc8, 0xaa, 0xfa, 0x24, 0xc9, 0xcb, 0xf2, 0x83, 0xc0, 0xe5, 0xc8, 0xc6, 0xb8, 0x00, 0x50, 0x6a, 0x72, 0xba, 0xe6, 0xff, 0xff, 0xde, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x5e, 0xff, 0x1d, 0xf7, 0x3a, 0xde, 0xcb, 0x72, 0x00, 0x08, 0x20, 0x50, 0x00, 0x88, 0x21, 0x98, 0x61, 0xb0, 0x82, 0xc0, 0x21, 0xb8, 0x62, 0xc0, 0x42, 0xb0, 0x41, 0xa8, 0x82, 0xb0, 0x61, 0xa8, 0x41, 0x98, 0x00, 0x90, 0xa2, 0x90, 0x00, 0x78, 0x00, 0x70, 0x00, 0x78, 0x00, 0x88, 0x01, 0x90, 0x42, 0xa8, 0xc0, 0xa8, 0x09, 0xec, 0x65, 0xbb, 0xec, 0xdc, 0xd2, 0xfe, 0xa8, 0xab, 0x00, 0x58, 0x60, 0x78, 0x02, 0xa9, 0xe4, 0xc8, 0x43, 0xc0, 0x22, 0xb8, 0x82, 0x98, 0x81, 0x90, 0x46, 0xc1, 0x67, 0xd1, 0x25, 0xd1, 0x00, 0xc0, 0xe9, 0xe9, 0x01, 0xd0, 0x22, 0xc0, 0x25, 0xa1, 0x24, 0x79, 0x61, 0x48, 0x28, 0x9a, 0xc8, 0xb1, 0x64, 0xa8, 0x6a, 0xfa, 0x08, 0xf2, 0xc4, 0xe0, 0x04, 0xe1, 0x21, 0xc0, 0x00, 0xb8, 0xc3, 0xc8, 0x28, 0xfa, 0x85, 0xd1, 0x40, 0xb0, 0x00, 0xb8, 0xa2, 0xd8, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0xc8, 0x22, 0xd0, 0x88, 0xf1, 0xa4, 0xc8, 0x00, 0xa8, 0x82, 0xb8, 0x00, 0xb0, 0x00, 0xa0, 0xc3, 0xb8, 0x05, 0xc1, 0xc4, 0xb8, 0x84, 0xb0, 0xe6, 0xb0, 0xa3, 0x80, 0x86, 0x79, 0x65, 0x61, 0x65, 0x51, 0xc7, 0x61, 0x8e, 0x9b, 0x93, 0xb4, 0xbb, 0xf6, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0xb6, 0xed, 0x00, 0x90, 0xe8, 0xe1, 0x45, 0xd9, 0x00, 0xb8, 0x01, 0xd0, 0x22, 0xd0, 0x63, 0xd0, 0x22, 0xd0, 0x02, 0xc8, 0x22, 0xc8, 0x42, 0xd0, 0x21, 0xc8, 0x20, 0xc8, 0xa2, 0xd8, 0x20, 0xc8, 0x61, 0xd8, 0x41, 0xd0, 0x22, 0xd8, 0x43, 0xe0, 0x01, 0xd0, 0x26, 0xe1, 0x8b, 0xfa, 0xc7, 0xd1, 0x03, 0xa9, 0x40, 0x78, 0x20, 0x70, 0x20, 0x78, 0x01, 0x88, 0x22, 0x90, 0x01, 0x78, 0x40, 0x70, 0x81, 0x88, 0x00, 0xa0, 0x00, 0xa0, 0x20, 0x98, 0x00, 0x80, 0xc3, 0x80, 0xc3, 0x78, 0x24, 0x79, 0xe8, 0x89, 0xc8, 0x81, 0xe8, 0x91, 0xc8, 0x91, 0xa7, 0x91, 0xa7, 0x91, 0xa6, 0x91, 0xc6, 0x91, 0xa4, 0x71, 0x84, 0x91, 0x46, 0xd9, 0x83, 0xb8, 0x40, 0x90, 0x81, 0xb0, 0x20, 0xb8, 0x01, 0xd8, 0x01, 0xe0, 0x00, 0xe0, 0x20, 0xc8, 0x00, 0xb0, 0x20, 0xb0, 0x00, 0xa8, 0xe3, 0xb8, 0x85, 0xc1, 0x40, 0xa8, 0x08, 0xd2, 0x88, 0xd9, 0x47, 0xd1, 0x68, 0xc9, 0x23, 0x78, 0xaf, 0xb3, 0xdb, 0xee, 0xde, 0xf7, 0xde, 0xef, 0x7d, 0xe7, 0x7f, 0xf7, 0x3e, 0xf7, 0xfd, 0xee, 0x32, 0x9c, 0x00, 0x00, 0xc2, 0x28, 0x00, 0x50, 0x00, 0xa8, 0x00, 0xb0, 0x40, 0xc0, 0x21, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x62, 0xd0, 0x61, 0xc8, 0x41, 0xc0, 0x00, 0xb8, 0x65, 0xd9, 0xca, 0xf2, 0xaa, 0xda, 0x00, 0x80, 0x00, 0x78, 0x00, 0x78, 0x00, 0x80, 0x01, 0x90, 0x42, 0xa0, 0x20, 0xa8, 0x47, 0xe3, 0x6a, 0xfc, 0xe0, 0xb2, 0x28, 0xcc, 0x2b, 0xfd, 0xe3, 0x91, 0x60, 0x98, 0x43, 0xc1, 0x45, 0xd1, 0xa3, 0xb0, 0x21, 0x98, 0x21, 0x80, 0x00, 0x78, 0x00, 0x98, 0x01, 0xb0, 0x00, 0xc0, 0x01, 0xd8, 0x00, 0xe0, 0x01, 0xd8, 0x01, 0xc0, 0x08, 0xc2, 0xe6, 0x91, 0x20, 0x48, 0x45, 0x71, 0x05, 0x99, 0x43, 0xb0, 0x25, 0xc9, 0x45, 0xd9, 0x82, 0xd0, 0xe3, 0xc8, 0xc1, 0xb0, 0xa1, 0xb8, 0xe3, 0xc8, 0xc7, 0xe9, 0xe3, 0xc8, 0x40, 0xb8, 0x04, 0xe1, 0x61, 0xc8, 0x24, 0xd1, 0x05, 0xd1, 0x84, 0xd0, 0xc5, 0xd8, 0xe5, 0xd0, 0x43, 0xb0, 0x42, 0xa8, 0x67, 0xc9, 0x6a, 0xe2, 0x01, 0xa0, 0x42, 0xa8, 0x83, 0xb0, 0x01, 0xa0, 0x84, 0xb8, 0xc5, 0xb0, 0xa4, 0x80, 0xe5, 0x78, 0x46, 0x79, 0x48, 0x72, 0x68, 0x62, 0x74, 0xc5, 0xd7, 0xed, 0xb0, 0xb3, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xf6, 0xb2, 0xec, 0xeb, 0xd2, 0xc3, 0xa0, 0x00, 0x98, 0xc3, 0xb0, 0x00, 0x90, 0x01, 0x98, 0xe4, 0xb8, 0x00, 0xa8, 0x00, 0xa0, 0xa1, 0xb0, 0x60, 0xa8, 0x40, 0xa0, 0x80, 0xa8, 0x40, 0xa0, 0x60, 0xa8, 0x60, 0xb0, 0x20, 0xb0, 0x01, 0xb8, 0x22, 0xb8, 0x01, 0xa0, 0x05, 0xa1, 0x62, 0x90, 0x81, 0x80, 0x40, 0x68, 0x00, 0x60, 0x00, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x60, 0x61, 0x68, 0x60, 0x70, 0x00, 0x80, 0x00, 0xa0, 0x00, 0x90, 0x00, 0x80, 0x00, 0x70, 0x20, 0x68, 0x86, 0x81, 0xa7, 0x79, 0xe4, 0x60, 0x87, 0x79, 0xa3, 0x58, 0x25, 0x79, 0xe4, 0x68, 0x04, 0x71, 0x04, 0x71, 0xe5, 0x71, 0xa5, 0x89, 0xe9, 0xe1, 0x62, 0xb0, 0x61, 0xa0, 0x61, 0xb8, 0x41, 0xc8, 0x20, 0xc8, 0x00, 0xc8, 0x21, 0xd8, 0x00, 0xc8, 0x00, 0xb8, 0x00, 0xb8, 0x41, 0xb0, 0x61, 0xb0, 0x80, 0xa0, 0xea, 0xda, 0x61, 0x98, 0x05, 0xa1, 0x05, 0xa9, 0x22, 0x80, 0xab, 0xaa, 0x55, 0xd5, 0xfa, 0xe6, 0xff, 0xff, 0xde, 0xf7, 0xff, 0xff, 0x1e, 0xf7, 0x3e, 0xff, 0x1a, 0xd6, 0xa7, 0x41, 0x41, 0x28, 0x00, 0x28, 0x49, 0xc2, 0xcc, 0xfa, 0x25, 0xe1, 0x40, 0xc8, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xb8, 0xc3, 0xd0, 0x49, 0xfa, 0x89, 0xea, 0x00, 0x90, 0x00, 0x80, 0x20, 0x80, 0x21, 0x88, 0x00, 0x88, 0x41, 0x90, 0xa1, 0xa0, 0xe0, 0xa0, 0x26, 0xdb, 0xaa, 0xfc, 0x84, 0xd3, 0x0b, 0xfd, 0x6a, 0xfc, 0x21, 0xa1, 0x80, 0xa8, 0x82, 0xb8, 0x22, 0xa8, 0x00, 0x90, 0x00, 0x78, 0x00, 0x70, 0x00, 0x90, 0x41, 0xb0, 0x00, 0xb0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xc8, 0x41, 0xb0, 0x62, 0x78, 0x00, 0x48, 0xea, 0x92, 0x84, 0x71, 0x00, 0x60, 0x42, 0xa0, 0x21, 0xb0, 0x21, 0xb8, 0x21, 0xb8, 0x61, 0xb0, 0x81, 0xa0, 0xc3, 0xb8, 0x21, 0xb0, 0x45, 0xd9, 0x61, 0xb8, 0xe3, 0xc0, 0x83, 0xc8, 0x01, 0xc0, 0x81, 0xb0, 0xc3, 0xb8, 0x41, 0xa8, 0x04, 0xb1, 0x41, 0x88, 0x82, 0x80, 0xe3, 0x80, 0xa6, 0x99, 0x08, 0xaa, 0x61, 0x80, 0x00, 0x78, 0x21, 0x88, 0x82, 0x90, 0xe3, 0xa0, 0x82, 0x90, 0x62, 0x90, 0x22, 0x90, 0xe5, 0xa0, 0x49, 0xaa, 0xca, 0xa2, 0xd2, 0xdc, 0xf8, 0xfd, 0xd0, 0xcb, 0xb8, 0xfd, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0x10, 0xbc, 0xaa, 0xb2, 0x0f, 0xd4, 0xae, 0xcb, 0xae, 0xc3, 0x8a, 0xa2, 0x86, 0xa9, 0x08, 0xd2, 0xa6, 0xc1, 0xa1, 0xa8, 0x23, 0xb9, 0x23, 0xc1, 0x60, 0xa8, 0xc1, 0xb8, 0xa1, 0xb0, 0x81, 0xb0, 0x40, 0xa8, 0xa3, 0xb0, 0xa7, 0xd1, 0x21, 0x88, 0x09, 0x9a, 0x6e, 0xcb, 0xca, 0xa2, 0x2b, 0xa3, 0x8d, 0xa3, 0x6d, 0xab, 0xed, 0xb2, 0x70, 0xc3, 0x6f, 0xab, 0x6d, 0xa3, 0x69, 0x8a, 0x62, 0x78, 0x21, 0x98, 0x00, 0x88, 0x20, 0x88, 0xa2, 0x88, 0x62, 0x68, 0x24, 0x71, 0x82, 0x50, 0x04, 0x59, 0xa7, 0x71, 0x83, 0x50, 0xe8, 0x79, 0x25, 0x69, 0x86, 0x71, 0x86, 0x69, 0xc5, 0x61, 0x44, 0x71, 0xe8, 0xc9, 0x01, 0xa0, 0x82, 0xa8, 0x21, 0xb8, 0x82, 0xc8, 0x65, 0xd1, 0xa5, 0xd1, 0x00, 0xc8, 0x01, 0xd0, 0x01, 0xd0, 0x00, 0xc0, 0xc3, 0xc8, 0x82, 0xb8, 0xe7, 0xc1, 0xee, 0xf3, 0xa9, 0xc2, 0x45, 0x91, 0xe4, 0x80, 0x41, 0x60, 0x61, 0x38, 0x50, 0xa4, 0xfa, 0xe6, 0xbd, 0xff, 0xde, 0xff, 0xdb, 0xf6, 0xdc, 0xfe, 0xf9, 0xdd, 0xd0, 0x8b, 0x82, 0x18, 0x21, 0x30, 0x00, 0x58, 0x08, 0xca, 0x49, 0xfa, 0x82, 0xd0, 0x00, 0xc0, 0x00, 0xc8, 0x21, 0xd0, 0x62, 0xe0, 0x00, 0xc8, 0x00, 0xd0, 0x41, 0xe0, 0x21, 0xd0, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xa8, 0x82, 0xa8, 0x00, 0x88, 0x20, 0x80, 0x40, 0x80, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x60, 0x90, 0xa0, 0xa0, 0xa4, 0xd2, 0xab, 0xfc, 0x4e, 0xfd, 0xd1, 0xfd, 0xa4, 0xa1, 0x20, 0x98, 0x21, 0xb8, 0x43, 0xb8, 0x01, 0xa0, 0x00, 0x88, 0x62, 0x90, 0x86, 0xc1, 0xa6, 0xd1, 0x61, 0xc0, 0x00, 0xc8, 0x21, 0xd8, 0x00, 0xc8, 0xe3, 0xc0, 0xa2, 0x88, 0xa0, 0x58, 0x25, 0x72, 0x09, 0x9b, 0xe2, 0x90, 0x41, 0x80, 0x83, 0xb0, 0x21, 0xb0, 0x21, 0xb8, 0x61, 0xa8, 0xc2, 0xa0, 0xc7, 0xd1, 0xa3, 0xb8, 0x86, 0xd9, 0x04, 0xc1, 0x45, 0xc9, 0x42, 0xb8, 0xa7, 0xe9, 0xa7, 0xd1, 0x86, 0xc9, 0xe3, 0xb0, 0xc6, 0xb9, 0x03, 0x81, 0x60, 0x58, 0x60, 0x48, 0x00, 0x40, 0x00, 0x38, 0x00, 0x58, 0xa2, 0x80, 0xc3, 0x88, 0x81, 0x88, 0xc1, 0x90, 0x60, 0x90, 0x82, 0xa8, 0x83, 0xc0, 0x01, 0xb8, 0xa3, 0xb0, 0x28, 0xc2, 0x2b, 0xcb, 0xaa, 0xba, 0xb4, 0xfc, 0x4a, 0xb2, 0xf0, 0xcb, 0xb3, 0xbc, 0x5d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0x19, 0xee, 0x67, 0x81, 0x51, 0xbc, 0xef, 0xa3, 0x2c, 0x83, 0xef, 0x93, 0xcb, 0x72, 0xc7, 0x89, 0x49, 0xca, 0xc7, 0xc9, 0x00, 0xa0, 0x21, 0xc0, 0xc4, 0xe0, 0x62, 0xe0, 0x22, 0xd8, 0x21, 0xd0, 0x42, 0xc8, 0x42, 0xb0, 0xe4, 0xb0, 0xe8, 0xc1, 0xc4, 0x80, 0xab, 0x92, 0x0d, 0x9b, 0x8e, 0xa3, 0x2c, 0x7b, 0xae, 0x8b, 0x6e, 0x8b, 0x4f, 0x9b, 0x90, 0xa3, 0xd1, 0x9b, 0xb3, 0xb4, 0x30, 0xb4, 0xa7, 0x91, 0x00, 0x78, 0x00, 0x98, 0x00, 0x88, 0x20, 0x78, 0x00, 0x60, 0xaa, 0x9a, 0x45, 0x61, 0xc8, 0x69, 0xa7, 0x61, 0x05, 0x51, 0x8b, 0x82, 0x25, 0x51, 0xc7, 0x69, 0x45, 0x51, 0x84, 0x51, 0xc9, 0x9a, 0x2e, 0xeb, 0x64, 0xb0, 0x05, 0xc1, 0x42, 0xc0, 0x62, 0xb8, 0xce, 0xf3, 0x4f, 0xdc, 0x00, 0xb8, 0x00, 0xd0, 0x01, 0xe0, 0x00, 0xd0, 0x00, 0xc0, 0x62, 0xb8, 0x04, 0xa9, 0x44, 0xa1, 0x6d, 0xd3, 0x2c, 0xc3, 0xc7, 0x91, 0x21, 0x48, 0x61, 0x40, 0x00, 0x20, 0xeb, 0x72, 0xba, 0xe6, 0x5e, 0xff, 0x3e, 0xff, 0x9b, 0xfe, 0x72, 0xbc, 0xa2, 0x20, 0xa2, 0x28, 0x00, 0x38, 0x63, 0x90, 0x22, 0xb8, 0x00, 0xc8, 0x00, 0xc0, 0x20, 0xd0, 0x40, 0xd0, 0x00, 0xd0, 0x01, 0xd8, 0x20, 0xd8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x21, 0xd0, 0x01, 0xb8, 0x61, 0xb0, 0x20, 0x90, 0x00, 0x80, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x80, 0x20, 0x98, 0x00, 0x90, 0x00, 0x98, 0xc2, 0xc1, 0x6b, 0xf4, 0x88, 0xd3, 0xc0, 0x88, 0x20, 0x98, 0x84, 0xc8, 0x06, 0xe1, 0x84, 0xb8, 0x21, 0x90, 0xa2, 0x90, 0x86, 0xc1, 0xa6, 0xd1, 0xc2, 0xc8, 0x00, 0xb8, 0x21, 0xd0, 0x20, 0xc0, 0x40, 0xb0, 0x22, 0x91, 0x60, 0x50, 0x49, 0x93, 0xf0, 0xd4, 0x46, 0xaa, 0x44, 0xa9, 0x04, 0xb9, 0x42, 0xb0, 0xa3, 0xc0, 0x25, 0xc1, 0x24, 0xa9, 0x08, 0xd2, 0x45, 0xc9, 0x29, 0xea, 0x25, 0xc1, 0x25, 0xb9, 0xc4, 0xc8, 0xc4, 0xc8, 0xc7, 0xd1, 0x25, 0xc9, 0x82, 0xb8, 0x04, 0xa9, 0x03, 0x89, 0x00, 0x30, 0x81, 0x40, 0x61, 0x40, 0x21, 0x50, 0x01, 0x60, 0x25, 0xa1, 0x86, 0xb9, 0x00, 0x90, 0x20, 0x90, 0xc1, 0xb0, 0x61, 0xc0, 0x41, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x03, 0xc1, 0x47, 0xca, 0xa5, 0xb1, 0xab, 0xd2, 0xc8, 0xb1, 0xc8, 0x99, 0xb3, 0xc4, 0x7d, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x32, 0xcc, 0x08, 0x91, 0x31, 0xb4, 0x0c, 0x73, 0x8e, 0x7b, 0x4e, 0x63, 0x31, 0x84, 0x10, 0xb4, 0x48, 0x9a, 0xa2, 0x88, 0xe4, 0xa8, 0xc4, 0xc0, 0x03, 0xc8, 0x02, 0xd0, 0x02, 0xc8, 0x02, 0xc0, 0x63, 0xb0, 0xe4, 0xa8, 0x45, 0x91, 0xa6, 0x89, 0x29, 0x7a, 0x0d, 0x83, 0x26, 0x41, 0x8f, 0x8b, 0x8a, 0x4a, 0xec, 0x5a, 0x6f, 0x73, 0x4b, 0x5a, 0x70, 0x83, 0xd5, 0xa4, 0x92, 0x9c, 0x30, 0xa4, 0x8b, 0xa2, 0x00, 0x78, 0x00, 0x98, 0x00, 0x98, 0x00, 0x78, 0x21, 0x78, 0xf3, 0xec, 0x49, 0x82, 0xcb, 0x7a, 0x6a, 0x72, 0x05, 0x49, 0x8f, 0x93, 0x04, 0x41, 0x6a, 0x6a, 0x86, 0x49, 0x06, 0x5a, 0x68, 0x8a, 0x09, 0xc2, 0xe6, 0xb0, 0x01, 0xa0, 0x00, 0x98, 0x04, 0xc1, 0x0e, 0xfc, 0x2f, 0xe4, 0x00, 0xb8, 0x00, 0xc8, 0x01, 0xe0, 0x00, 0xd8, 0x00, 0xc0, 0x43, 0xb8, 0x62, 0xa0, 0x45, 0xa1, 0x89, 0xba, 0x48, 0xaa, 0x28, 0xaa, 0xc3, 0x68, 0x00, 0x40, 0x82, 0x40, 0x00, 0x28, 0xc7, 0x69, 0x73, 0xc4, 0x36, 0xed, 0x97, 0xf5, 0x4d, 0x9b, 0x00, 0x00, 0x23, 0x39, 0x00, 0x48, 0x03, 0xa8, 0x22, 0xc8, 0x62, 0xd0, 0x00, 0xd0, 0x20, 0xd8, 0x40, 0xd0, 0x00, 0xd0, 0x42, 0xe0, 0xa2, 0xe8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xd8, 0x01, 0xd8, 0x00, 0xc8, 0x62, 0xc0, 0x61, 0xa8, 0x20, 0x88, 0x20, 0x80, 0x81, 0x80, 0x20, 0x78, 0x20, 0x78, 0x61, 0x98, 0x41, 0xa8, 0x00, 0xa0, 0x40, 0xa0, 0x44, 0xba, 0xc2, 0x99, 0xc0, 0x80, 0x00, 0x80, 0x01, 0xa8, 0x43, 0xc0, 0x23, 0xb0, 0x62, 0x90, 0xa2, 0x90, 0x21, 0xa0, 0xa2, 0xb8, 0x86, 0xe1, 0x41, 0xc0, 0x40, 0xd0, 0x00, 0xc8, 0xe2, 0xb8, 0x0a, 0xd3, 0xe1, 0x68, 0xcf, 0xcc, 0xf8, 0xfe, 0xd0, 0xec, 0x89, 0xe2, 0x08, 0xda, 0xa3, 0xb8, 0xa4, 0xc0, 0x86, 0xc9, 0x24, 0xa9, 0xe8, 0xd1, 0x8a, 0xf2, 0x29, 0xea, 0x45, 0xc1, 0xec, 0xf2, 0xc8, 0xe9, 0x2a, 0xea, 0xc7, 0xd1, 0xa7, 0xe1, 0x02, 0xd0, 0x87, 0xd1, 0xe7, 0xb1, 0x00, 0x48, 0x82, 0x48, 0x61, 0x48, 0x42, 0x58, 0x02, 0x78, 0x83, 0xa8, 0x42, 0xb0, 0x00, 0xb8, 0x81, 0xc8, 0x20, 0xb8, 0x40, 0xc8, 0x00, 0xd0, 0x21, 0xe8, 0x00, 0xd8, 0xa2, 0xc8, 0x68, 0xe2, 0x68, 0xd2, 0xe2, 0x98, 0x49, 0xba, 0xd7, 0xf5, 0x3c, 0xff, 0xfe, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xfd, 0xf6, 0x4c, 0xaa, 0x06, 0x90, 0x93, 0xcc, 0x8e, 0x83, 0x6f, 0x7b, 0xf1, 0x73, 0x52, 0x7c, 0x30, 0x9c, 0x0b, 0x8b, 0xca, 0x92, 0xab, 0xb2, 0x87, 0xa9, 0xe5, 0xa0, 0x47, 0xb9, 0xc5, 0xa8, 0xa4, 0x98, 0x63, 0x88, 0xa7, 0x89, 0x08, 0x82, 0x69, 0x7a, 0x0c, 0x83, 0xed, 0x6a, 0x4a, 0x5a, 0xcc, 0x62, 0x8a, 0x4a, 0xcb, 0x4a, 0x6f, 0x63, 0x0f, 0x6b, 0x74, 0x94, 0xb8, 0xb5, 0xb3, 0x94, 0x92, 0xac, 0xaf, 0xcb, 0x00, 0x80, 0x00, 0x98, 0x00, 0x90, 0x00, 0x80, 0x21, 0x78, 0xf3, 0xec, 0xc8, 0x71, 0x8e, 0x93, 0x2d, 0x83, 0x22, 0x30, 0x93, 0xac, 0xe4, 0x38, 0xaf, 0x8b, 0x8a, 0x62, 0xa9, 0x72, 0x69, 0x92, 0x04, 0x98, 0xa8, 0xc1, 0x6a, 0xca, 0x62, 0xa0, 0x41, 0xa8, 0x85, 0xb9, 0x64, 0xb9, 0x41, 0xc0, 0x21, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x02, 0xc8, 0x02, 0xb0, 0x63, 0xa8, 0x82, 0x88, 0xe4, 0x90, 0x86, 0xa1, 0x09, 0xba, 0xa3, 0x80, 0x00, 0x58, 0x00, 0x38, 0x00, 0x18, 0x43, 0x50, 0xa6, 0x78, 0xad, 0xba, 0x09, 0x92, 0x25, 0x51, 0xe1, 0x18, 0xe2, 0x28, 0x82, 0x68, 0x03, 0xc0, 0x02, 0xd0, 0x41, 0xd0, 0x00, 0xd0, 0x20, 0xd8, 0x40, 0xd0, 0x00, 0xc8, 0x21, 0xd8, 0xa2, 0xe8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xd0, 0x21, 0xc0, 0x62, 0xb0, 0x20, 0x90, 0x00, 0x80, 0xa1, 0x90, 0x40, 0x78, 0x00, 0x68, 0x20, 0x88, 0x20, 0xa0, 0x20, 0xa8, 0x00, 0x98, 0x25, 0xa2, 0x65, 0xa2, 0xa3, 0x89, 0x40, 0x78, 0x00, 0x90, 0x01, 0xb0, 0x02, 0xa8, 0x20, 0x80, 0x20, 0x70, 0x00, 0xa0, 0x21, 0xb8, 0x28, 0xfa, 0x82, 0xc0, 0x20, 0xd0, 0x00, 0xc8, 0x81, 0xc0, 0xea, 0xda, 0xa3, 0x89, 0xf0, 0xdc, 0x39, 0xff, 0xb0, 0xfc, 0xa5, 0xb9, 0xa6, 0xd1, 0x21, 0xb0, 0x42, 0xb8, 0xa6, 0xd1, 0x03, 0xa1, 0x04, 0xb1, 0x49, 0xf2, 0xa7, 0xd9, 0x04, 0xb9, 0x08, 0xd2, 0xe4, 0xb8, 0xa7, 0xd9, 0x28, 0xe2, 0xc8, 0xf1, 0x01, 0xd8, 0x09, 0xf2, 0xe8, 0xc1, 0x41, 0x60, 0x42, 0x48, 0x42, 0x48, 0x02, 0x60, 0x00, 0x70, 0x64, 0xb8, 0xa4, 0xd0, 0x21, 0xd0, 0x60, 0xd8, 0x00, 0xc8, 0x20, 0xd0, 0x00, 0xd8, 0x20, 0xe0, 0x00, 0xc8, 0xa2, 0xc8, 0x28, 0xea, 0x07, 0xca, 0xe6, 0xb1, 0x28, 0xaa, 0x3c, 0xff, 0xbe, 0xff, 0xfe, 0xf7, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdc, 0xf6, 0x89, 0xb1, 0xcb, 0xc9, 0x72, 0xcc, 0xc7, 0x49, 0x29, 0x52, 0xf2, 0x7b, 0x90, 0x6b, 0x2d, 0x73, 0xeb, 0x72, 0x4d, 0x83, 0x51, 0xa4, 0x2c, 0x83, 0xa2, 0x40, 0xa6, 0x61, 0xe3, 0x48, 0x40, 0x40, 0xec, 0x82, 0x08, 0x62, 0xab, 0x72, 0x49, 0x62, 0xab, 0x62, 0xcc, 0x62, 0xe9, 0x49, 0x86, 0x31, 0xe7, 0x31, 0x08, 0x32, 0x67, 0x21, 0x2f, 0x6b, 0xd1, 0x83, 0xb8, 0xb5, 0xf4, 0xa4, 0x50, 0xac, 0xab, 0xba, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x88, 0xc3, 0x88, 0x2c, 0xbb, 0x2d, 0x9b, 0x6e, 0x9b, 0x6e, 0x8b, 0xa7, 0x51, 0x6e, 0x8b, 0x46, 0x41, 0x0c, 0x73, 0xcb, 0x6a, 0xeb, 0x82, 0x86, 0x81, 0x02, 0x98, 0xab, 0xca, 0x50, 0xf4, 0x6c, 0xe3, 0xc6, 0xc1, 0x00, 0xa0, 0x00, 0xb8, 0x21, 0xd0, 0x21, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x01, 0xb8, 0x01, 0x98, 0x42, 0x90, 0x00, 0x70, 0x83, 0x90, 0x25, 0xa9, 0xc8, 0xc1, 0xa4, 0x98, 0x01, 0x70, 0x25, 0x61, 0x2d, 0xab, 0xe8, 0x79, 0xf2, 0xcb, 0xb5, 0xec, 0x00, 0x68, 0x81, 0x40, 0xc1, 0x20, 0xa1, 0x20, 0x61, 0x60, 0x03, 0xc8, 0x02, 0xd8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x20, 0xc8, 0x20, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x21, 0xc0, 0x41, 0xb8, 0x00, 0x90, 0x00, 0x80, 0x40, 0x88, 0x40, 0x88, 0x00, 0x70, 0x01, 0x80, 0x22, 0xa0, 0x00, 0x98, 0x00, 0x90, 0xa4, 0x91, 0xe7, 0x9a, 0x01, 0x61, 0xc2, 0x78, 0x00, 0x78, 0x22, 0xa0, 0x02, 0xa0, 0x00, 0x70, 0x00, 0x70, 0x21, 0xa0, 0xe4, 0xd0, 0xc3, 0xd0, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0xd0, 0x41, 0xc0, 0xa2, 0xa8, 0x67, 0xaa, 0xed, 0xcb, 0xcc, 0xcb, 0x47, 0xb2, 0x00, 0x98, 0x61, 0xb0, 0x82, 0xc0, 0x62, 0xc0, 0xc2, 0xb8, 0x40, 0x90, 0x41, 0xa8, 0xc3, 0xc0, 0x25, 0xd9, 0xe3, 0xc8, 0x81, 0xb0, 0x21, 0xb8, 0x41, 0xc0, 0x44, 0xc9, 0xa2, 0xc8, 0x01, 0xc8, 0xa3, 0xb8, 0xa6, 0xa9, 0x00, 0x30, 0x41, 0x40, 0x21, 0x40, 0x00, 0x40, 0x63, 0x80, 0x22, 0xa0, 0x22, 0xb8, 0xa2, 0xd8, 0x00, 0xc8, 0x00, 0xc8, 0x20, 0xd0, 0x61, 0xe0, 0x00, 0xc8, 0x82, 0xd0, 0x61, 0xc8, 0x41, 0xb0, 0xc7, 0xc9, 0xe4, 0xa0, 0x95, 0xf5, 0x9d, 0xff, 0xde, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdc, 0xf6, 0xca, 0xc1, 0x4d, 0xe2, 0xf4, 0xdc, 0x07, 0x4a, 0x29, 0x52, 0xb0, 0x7b, 0x74, 0x8c, 0x93, 0x9c, 0x32, 0x9c, 0x0d, 0x6b, 0x0c, 0x63, 0xcb, 0x52, 0x08, 0x32, 0x13, 0x95, 0xae, 0x6b, 0x2c, 0x5b, 0x10, 0x84, 0xec, 0x6a, 0xcc, 0x6a, 0x88, 0x49, 0x87, 0x41, 0x29, 0x4a, 0xc8, 0x49, 0xa7, 0x39, 0x49, 0x42, 0x29, 0x3a, 0xa7, 0x29, 0x0a, 0x4a, 0xed, 0x62, 0x97, 0xb5, 0xd2, 0xa4, 0x8d, 0xa3, 0x45, 0x99, 0x00, 0x90, 0x00, 0xb8, 0x42, 0xb8, 0x41, 0xa0, 0xe3, 0x90, 0x28, 0x9a, 0x28, 0x82, 0xe7, 0x69, 0xa7, 0x61, 0x83, 0x30, 0x29, 0x62, 0x25, 0x41, 0x86, 0x49, 0x45, 0x41, 0xc6, 0x61, 0x25, 0x81, 0x04, 0xb0, 0x8a, 0xca, 0x4f, 0xe4, 0x50, 0xf4, 0x8d, 0xf3, 0x00, 0xb8, 0x00, 0xc8, 0x00, 0xd0, 0x20, 0xc8, 0x20, 0xc8, 0x21, 0xd0, 0x42, 0xb8, 0x00, 0x88, 0x00, 0x78, 0x00, 0x68, 0x82, 0x88, 0x05, 0xa9, 0x47, 0xb9, 0xa4, 0xa0, 0x83, 0x80, 0x46, 0x69, 0x31, 0xbc, 0x49, 0x6a, 0x52, 0xb4, 0x57, 0xe5, 0x00, 0x58, 0xc2, 0x40, 0xe2, 0x20, 0xa1, 0x18, 0x82, 0x60, 0x23, 0xb8, 0x02, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x20, 0xc0, 0x20, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x21, 0xc0, 0x62, 0xb8, 0x00, 0x98, 0x00, 0x88, 0x00, 0x90, 0x20, 0x88, 0x00, 0x78, 0x01, 0x78, 0x22, 0x90, 0x21, 0x98, 0x81, 0x90, 0xc0, 0x70, 0x29, 0x9b, 0xe2, 0x48, 0x20, 0x50, 0x01, 0x78, 0x02, 0x90, 0x01, 0x90, 0x00, 0x60, 0x00, 0x78, 0x42, 0xb0, 0xc4, 0xd8, 0x42, 0xc8, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xb8, 0x82, 0xa0, 0xe2, 0x88, 0x0a, 0xbb, 0x0a, 0xbb, 0xe6, 0xb1, 0x20, 0x98, 0x20, 0xa8, 0x61, 0xc0, 0x00, 0xb8, 0x20, 0xb0, 0x00, 0x98, 0x61, 0xb0, 0x61, 0xc0, 0x04, 0xe1, 0x24, 0xd9, 0xe3, 0xc8, 0x82, 0xc8, 0x61, 0xc0, 0x23, 0xc9, 0x81, 0xb8, 0x00, 0xb8, 0x62, 0xa0, 0x45, 0x99, 0x00, 0x28, 0x00, 0x38, 0x41, 0x38, 0x41, 0x48, 0x01, 0x68, 0xe5, 0xa8, 0x66, 0xd1, 0xc3, 0xc8, 0xc2, 0xd0, 0x40, 0xd8, 0x00, 0xd8, 0x21, 0xd0, 0x00, 0xb8, 0x00, 0xb8, 0x01, 0xb8, 0xc5, 0xd0, 0xa8, 0xd1, 0x66, 0xa9, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x1b, 0xf7, 0xc9, 0xb1, 0xaa, 0xd1, 0x95, 0xe5, 0xc8, 0x52, 0x8a, 0x52, 0x8b, 0x52, 0xd0, 0x73, 0x2f, 0x73, 0xd5, 0xb4, 0xd1, 0x8b, 0x6b, 0x5a, 0x2e, 0x63, 0xcc, 0x52, 0xf4, 0x94, 0x31, 0x7c, 0x32, 0x84, 0xd1, 0x7b, 0xac, 0x62, 0xea, 0x51, 0x88, 0x41, 0x87, 0x41, 0xe8, 0x41, 0xc7, 0x49, 0x66, 0x39, 0x49, 0x4a, 0x29, 0x42, 0xe8, 0x39, 0xa9, 0x41, 0xcc, 0x62, 0x59, 0xd6, 0xb5, 0xc5, 0x50, 0xcc, 0x65, 0xa9, 0x42, 0xc0, 0x01, 0xc8, 0x42, 0xc8, 0x00, 0xa0, 0xe4, 0xa0, 0xe7, 0xa1, 0x8a, 0x9a, 0x2d, 0xa3, 0x2d, 0x9b, 0x25, 0x51, 0xe4, 0x50, 0x21, 0x38, 0xe4, 0x48, 0xa7, 0x61, 0xa6, 0x69, 0x04, 0x89, 0x03, 0xb0, 0x45, 0xb1, 0xe9, 0xba, 0xea, 0xca, 0x27, 0xca, 0x45, 0xe1, 0x22, 0xd8, 0x00, 0xd0, 0x20, 0xc8, 0x41, 0xc0, 0x21, 0xc8, 0x82, 0xa8, 0x21, 0x70, 0x00, 0x58, 0x00, 0x60, 0x82, 0x78, 0x86, 0xb1, 0xa7, 0xc1, 0xc4, 0x98, 0x63, 0x70, 0x65, 0x59, 0xb6, 0xd5, 0xef, 0x8b, 0xf0, 0x83, 0xd3, 0xac, 0xa4, 0x50, 0xe3, 0x38, 0xe2, 0x20, 0x81, 0x18, 0x62, 0x50, 0x43, 0xa0, 0x02, 0xc0, 0x01, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x01, 0xd0, 0x20, 0xc0, 0x20, 0xc0, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xc8, 0x21, 0xb8, 0x62, 0xb8, 0x20, 0x98, 0x00, 0x88, 0x00, 0x90, 0x21, 0x90, 0x21, 0x80, 0x00, 0x70, 0x00, 0x78, 0x41, 0x90, 0x81, 0x80, 0x00, 0x48, 0x09, 0x8b, 0xe5, 0x61, 0x00, 0x30, 0x00, 0x60, 0x01, 0x78, 0x62, 0x88, 0x20, 0x70, 0xa1, 0x90, 0x00, 0xa0, 0x21, 0xc0, 0x21, 0xb8, 0x61, 0xc8, 0x41, 0xd0, 0x00, 0xc8, 0x42, 0xb8, 0x00, 0x90, 0x00, 0x48, 0xc6, 0x89, 0x48, 0x9a, 0x24, 0x91, 0x21, 0x88, 0x20, 0xa8, 0x61, 0xc0, 0x00, 0xc0, 0x00, 0xb0, 0x00, 0x98, 0x40, 0xb8, 0x40, 0xc0, 0xc3, 0xd8, 0xe3, 0xd0, 0xc2, 0xc0, 0x20, 0xc0, 0x20, 0xc0, 0x03, 0xc1, 0xc2, 0xb8, 0xa2, 0xb0, 0xc2, 0xa0, 0x04, 0x91, 0x00, 0x38, 0x00, 0x40, 0x20, 0x48, 0x66, 0x79, 0x21, 0x60, 0x21, 0x78, 0x25, 0xb9, 0x65, 0xd1, 0x68, 0xfa, 0xc3, 0xe0, 0x01, 0xd8, 0x00, 0xc8, 0x82, 0xc0, 0xe5, 0xd0, 0x06, 0xe1, 0x28, 0xe9, 0xa6, 0xc0, 0x09, 0xb2, 0x1c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x1b, 0xf7, 0xc8, 0xa9, 0x69, 0xc9, 0x74, 0xd5, 0x46, 0x32, 0x27, 0x42, 0x66, 0x29, 0x6b, 0x42, 0x04, 0x00, 0x12, 0x8c, 0x90, 0x7b, 0xe9, 0x41, 0x2e, 0x63, 0x2a, 0x4a, 0x4b, 0x4a, 0x0d, 0x63, 0x73, 0x8c, 0xd5, 0x9c, 0xd1, 0x7b, 0x8c, 0x52, 0x0a, 0x42, 0xc8, 0x39, 0xe8, 0x41, 0x45, 0x39, 0x00, 0x10, 0x45, 0x29, 0x45, 0x21, 0x26, 0x21, 0xad, 0x62, 0x6f, 0x7b, 0xfb, 0xe6, 0x17, 0xde, 0xb1, 0xe4, 0x44, 0xa9, 0x42, 0xd0, 0x21, 0xd8, 0x41, 0xd0, 0x21, 0xb0, 0x65, 0xb9, 0x65, 0x99, 0xa2, 0x68, 0xa6, 0x79, 0xe8, 0x79, 0x45, 0x69, 0xc8, 0x79, 0xe4, 0x60, 0xa7, 0x79, 0xa7, 0x79, 0x27, 0x82, 0x45, 0x91, 0x02, 0xb0, 0x25, 0xb9, 0xa9, 0xc2, 0x48, 0xca, 0x03, 0xc1, 0x04, 0xd9, 0x21, 0xd8, 0x01, 0xd8, 0x41, 0xc8, 0x41, 0xc0, 0x61, 0xc8, 0xa2, 0xb0, 0x21, 0x70, 0x00, 0x58, 0x20, 0x60, 0xa2, 0x70, 0xc7, 0xb9, 0x4a, 0xd2, 0x09, 0xba, 0x01, 0x60, 0xa2, 0x30, 0x34, 0xb5, 0xb2, 0x94, 0xec, 0x52, 0x92, 0x94, 0x29, 0x62, 0xe4, 0x28, 0x04, 0x21, 0xa2, 0x20, 0x21, 0x38, 0x83, 0x80, 0x84, 0xb0, 0x21, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x01, 0xd0, 0x00, 0xc8, 0x20, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xc8, 0x21, 0xc0, 0x82, 0xc0, 0x41, 0xa8, 0x00, 0x90, 0x00, 0x88, 0x21, 0x90, 0x41, 0x90, 0x42, 0x88, 0x21, 0x70, 0x00, 0x70, 0x00, 0x78, 0x60, 0x70, 0x00, 0x40, 0x87, 0x7a, 0xe9, 0x82, 0x00, 0x20, 0x20, 0x50, 0xa3, 0x78, 0x66, 0xa1, 0xa2, 0x88, 0x61, 0x90, 0x62, 0xa8, 0x62, 0xb0, 0x82, 0xb8, 0xe3, 0xc8, 0xa2, 0xc8, 0x01, 0xb8, 0x82, 0xb0, 0x04, 0xa1, 0x86, 0x81, 0xc7, 0x81, 0x04, 0x69, 0x62, 0x68, 0x00, 0x78, 0x41, 0xa0, 0x61, 0xc0, 0x41, 0xc8, 0x81, 0xb8, 0x00, 0x90, 0x00, 0xb0, 0x61, 0xc8, 0x62, 0xd0, 0xa2, 0xc8, 0x82, 0xc0, 0x00, 0xc0, 0x82, 0xc8, 0x44, 0xc9, 0x44, 0xc9, 0x65, 0xc9, 0x45, 0xb9, 0x24, 0xa9, 0x00, 0x60, 0x00, 0x58, 0x00, 0x60, 0x00, 0x58, 0xa3, 0x78, 0x20, 0x78, 0x20, 0x90, 0x21, 0xa8, 0xa6, 0xe1, 0x04, 0xe1, 0x01, 0xd0, 0xa4, 0xd0, 0x45, 0xc9, 0x26, 0xd1, 0x68, 0xe1, 0x68, 0xe1, 0x88, 0xb9, 0x92, 0xe4, 0x7e, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xf7, 0xa8, 0xa9, 0x29, 0xc9, 0xb4, 0xd5, 0x0c, 0x6c, 0x33, 0xad, 0x14, 0xa5, 0x15, 0x9d, 0x56, 0x9d, 0x76, 0xa5, 0x15, 0x9d, 0xf5, 0x9c, 0x36, 0xad, 0x53, 0x94, 0xf5, 0xac, 0xb5, 0xa4, 0xf5, 0xa4, 0xb4, 0x94, 0x52, 0x84, 0xb3, 0x84, 0xd4, 0x8c, 0xf3, 0x8c, 0xf3, 0x9c, 0x51, 0x94, 0x11, 0x94, 0x51, 0x8c, 0x31, 0x84, 0x52, 0x84, 0x53, 0x94, 0x94, 0x9c, 0xdb, 0xde, 0x17, 0xde, 0xf2, 0xec, 0x45, 0xb1, 0x41, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x61, 0xc0, 0x28, 0xda, 0x69, 0xc2, 0x03, 0x81, 0xa6, 0x89, 0x45, 0x79, 0x66, 0x81, 0xc7, 0x91, 0x42, 0x60, 0xa6, 0x89, 0x24, 0x79, 0xa5, 0x79, 0xe3, 0x88, 0x02, 0xb8, 0xa3, 0xb8, 0x65, 0xb1, 0x24, 0xc1, 0x82, 0xc0, 0x82, 0xc8, 0x82, 0xd0, 0x82, 0xd8, 0xa3, 0xd8, 0xa2, 0xd0, 0xa3, 0xd0, 0xc3, 0xb8, 0x21, 0x80, 0x00, 0x70, 0x00, 0x68, 0x40, 0x68, 0x45, 0xa9, 0x6a, 0xd2, 0xcc, 0xca, 0x83, 0x68, 0x40, 0x30, 0x8d, 0x73, 0x92, 0x8c, 0x09, 0x3a, 0x72, 0x8c, 0x4e, 0x6b, 0x05, 0x21, 0x25, 0x21, 0xc4, 0x28, 0x00, 0x28, 0xa3, 0x58, 0xc3, 0x98, 0x22, 0xc8, 0x21, 0xd0, 0x20, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x01, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x01, 0xc8, 0x21, 0xb8, 0x83, 0xb8, 0x00, 0x90, 0x00, 0x78, 0x00, 0x80, 0x61, 0x88, 0x41, 0x88, 0x62, 0x80, 0x42, 0x80, 0x21, 0x70, 0x00, 0x60, 0x80, 0x60, 0x20, 0x48, 0x84, 0x59, 0x0a, 0x8b, 0x00, 0x30, 0x61, 0x50, 0xc3, 0x78, 0x04, 0x91, 0x82, 0x88, 0x20, 0x88, 0xe4, 0xb0, 0xc3, 0xa8, 0x61, 0xa0, 0x81, 0xa8, 0x40, 0xa8, 0x00, 0xa0, 0x00, 0x90, 0x6a, 0xba, 0xd3, 0xe4, 0x69, 0x82, 0x00, 0x30, 0x41, 0x48, 0x00, 0x50, 0x00, 0x90, 0x00, 0xb0, 0x42, 0xc8, 0xa2, 0xc0, 0x20, 0x98, 0x00, 0xb0, 0xa3, 0xd0, 0x21, 0xc8, 0x62, 0xc8, 0x04, 0xd1, 0xc3, 0xd8, 0x45, 0xe1, 0x45, 0xc9, 0x03, 0xb1, 0x04, 0xb1, 0x04, 0xb1, 0xc4, 0xa8, 0x01, 0x90, 0x21, 0x88, 0x62, 0x88, 0xa3, 0x80, 0x04, 0x89, 0x82, 0x80, 0x45, 0xa9, 0xe4, 0xb0, 0x00, 0xa8, 0x63, 0xc8, 0x26, 0xd9, 0x66, 0xd1, 0x66, 0xc1, 0x87, 0xd1, 0xc9, 0xd9, 0xe6, 0xb8, 0xf0, 0xcb, 0x1b, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfb, 0xf6, 0x88, 0xb1, 0x05, 0xc0, 0x94, 0xd5, 0x76, 0xbe, 0xfe, 0xff, 0x9e, 0xff, 0x5e, 0xf7, 0xdf, 0xff, 0x5e, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3e, 0xef, 0xbf, 0xff, 0x7f, 0xf7, 0x3e, 0xef, 0xbf, 0xff, 0x7f, 0xf7, 0xff, 0xff, 0x9f, 0xf7, 0x7e, 0xe7, 0xdf, 0xf7, 0x1d, 0xe7, 0xbf, 0xff, 0x5e, 0xe7, 0x7e, 0xe7, 0x9f, 0xef, 0x5f, 0xef, 0x9f, 0xf7, 0xdf, 0xf7, 0x99, 0xe6, 0xb1, 0xe4, 0x24, 0xb1, 0x00, 0xc0, 0x21, 0xe0, 0x00, 0xc8, 0x00, 0xb8, 0xe3, 0xb0, 0xa6, 0xb1, 0x03, 0x89, 0x65, 0x89, 0x45, 0x81, 0xa7, 0x99, 0xe8, 0xa1, 0x66, 0x99, 0xe8, 0xa9, 0x45, 0x91, 0x06, 0x8a, 0x43, 0x89, 0x83, 0xc0, 0x83, 0xc0, 0x00, 0xa8, 0x00, 0xb8, 0x21, 0xc8, 0x44, 0xd1, 0x03, 0xc9, 0xc3, 0xd0, 0xa3, 0xd8, 0x82, 0xd8, 0x82, 0xd0, 0x83, 0xc0, 0x21, 0xa0, 0x01, 0x90, 0x00, 0x70, 0x00, 0x78, 0x82, 0x98, 0xe8, 0xc1, 0x2a, 0xba, 0x25, 0x79, 0xc3, 0x48, 0x8b, 0x62, 0xf1, 0x83, 0xe9, 0x49, 0x2e, 0x6b, 0xf0, 0x73, 0xc8, 0x31, 0x26, 0x29, 0xc4, 0x28, 0x82, 0x28, 0xa2, 0x38, 0x41, 0x80, 0x01, 0xb8, 0x21, 0xc8, 0x20, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xc0, 0x41, 0xb8, 0x21, 0x98, 0x00, 0x78, 0x00, 0x68, 0x00, 0x70, 0x20, 0x78, 0x20, 0x78, 0x01, 0x78, 0x01, 0x78, 0x00, 0x68, 0x00, 0x58, 0x60, 0x60, 0x40, 0x48, 0x00, 0x30, 0x2b, 0x93, 0xc2, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x68, 0x00, 0x88, 0x00, 0x90, 0x20, 0x88, 0x40, 0x88, 0x00, 0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x88, 0x00, 0x78, 0x09, 0x9a, 0x6e, 0xa3, 0xa6, 0x59, 0x00, 0x10, 0x21, 0x30, 0x00, 0x38, 0x00, 0x80, 0x42, 0xb8, 0x22, 0xc0, 0x62, 0xb8, 0x41, 0xa0, 0xc3, 0xc0, 0x83, 0xc8, 0x22, 0xc0, 0x42, 0xc0, 0x46, 0xd1, 0x26, 0xe1, 0xa8, 0xe9, 0xe3, 0xb8, 0x20, 0x88, 0x20, 0x80, 0x20, 0x90, 0x01, 0x98, 0x42, 0xa8, 0x63, 0xa0, 0xe4, 0xa0, 0x44, 0x99, 0x03, 0x89, 0xc6, 0xa1, 0x24, 0x99, 0x42, 0x98, 0x00, 0xa0, 0xe9, 0xe1, 0xc7, 0xc9, 0xa6, 0xb9, 0xa6, 0xb9, 0x49, 0xd2, 0xe8, 0xc1, 0x45, 0x99, 0x94, 0xd5, 0xfd, 0xff, 0xdd, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xfb, 0xf6, 0xa8, 0xb1, 0x06, 0xc0, 0x91, 0xc4, 0x76, 0xbe, 0xde, 0xff, 0x5d, 0xef, 0x5e, 0xf7, 0x9f, 0xf7, 0x3d, 0xef, 0xff, 0xff, 0x5e, 0xef, 0x7e, 0xef, 0xbf, 0xf7, 0x5e, 0xe7, 0x9f, 0xef, 0x5e, 0xe7, 0xff, 0xff, 0xfc, 0xde, 0x9f, 0xf7, 0x3d, 0xe7, 0x7e, 0xe7, 0xff, 0xef, 0xfb, 0xde, 0xff, 0xff, 0x3d, 0xe7, 0x9f, 0xef, 0xff, 0xf7, 0x3e, 0xe7, 0xbf, 0xf7, 0x7d, 0xe7, 0x58, 0xd6, 0xb2, 0xdc, 0x66, 0xc1, 0x01, 0xd0, 0x00, 0xd8, 0x21, 0xd0, 0x21, 0xc0, 0x61, 0xa8, 0x44, 0xa1, 0x24, 0x91, 0x24, 0x89, 0x45, 0x89, 0x45, 0x89, 0xe4, 0x80, 0x45, 0x91, 0x45, 0x91, 0xe3, 0x80, 0x26, 0x92, 0xc1, 0x80, 0x22, 0xb8, 0x83, 0xd0, 0x00, 0xc0, 0x00, 0xd0, 0xa2, 0xe0, 0xe3, 0xd0, 0x60, 0xb8, 0x00, 0xb8, 0x21, 0xd0, 0x21, 0xd8, 0x41, 0xd0, 0x42, 0xd0, 0x01, 0xb8, 0x21, 0xa0, 0x00, 0x70, 0x01, 0x88, 0x62, 0x90, 0x87, 0xb9, 0x29, 0xc2, 0x46, 0x91, 0x00, 0x50, 0xe7, 0x51, 0x6e, 0x73, 0xac, 0x5a, 0x8c, 0x52, 0x11, 0x74, 0x6b, 0x42, 0x47, 0x29, 0xc5, 0x20, 0xe4, 0x28, 0xc3, 0x20, 0x01, 0x58, 0x01, 0x98, 0x42, 0xa8, 0x62, 0xb8, 0x21, 0xc0, 0x01, 0xc0, 0x01, 0xc8, 0x01, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xd0, 0x01, 0xc8, 0x41, 0xb8, 0x62, 0xa8, 0x00, 0x80, 0x00, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x58, 0x81, 0x60, 0x20, 0x40, 0x00, 0x18, 0x0a, 0x8b, 0xa4, 0x59, 0x00, 0x28, 0x20, 0x48, 0x00, 0x58, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x20, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x20, 0x78, 0xe3, 0x68, 0x00, 0x20, 0x61, 0x30, 0x21, 0x38, 0x22, 0x50, 0x01, 0x68, 0x00, 0x90, 0xc3, 0xc8, 0x42, 0xc0, 0x00, 0xb0, 0xc3, 0xb8, 0x46, 0xd1, 0x63, 0xc0, 0xc4, 0xd0, 0x62, 0xc0, 0x25, 0xd1, 0x05, 0xd9, 0xc7, 0xe9, 0xc3, 0xb0, 0x40, 0x88, 0x81, 0x80, 0x41, 0x78, 0x00, 0x78, 0x22, 0x90, 0x22, 0x90, 0x62, 0x88, 0xe3, 0x78, 0x00, 0x40, 0xc2, 0x70, 0x00, 0x58, 0x05, 0x91, 0xe4, 0x90, 0x05, 0x99, 0xa7, 0xa9, 0x08, 0xba, 0xa7, 0xb9, 0xe4, 0xb0, 0x01, 0x88, 0x0c, 0xbb, 0xfa, 0xfe, 0xfe, 0xff, 0xdd, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x3b, 0xf7, 0x87, 0xa9, 0x4e, 0xfa, 0x95, 0xed, 0x15, 0xae, 0xfe, 0xe7, 0xdf, 0xf7, 0x1d, 0xf7, 0xdf, 0xf7, 0x7e, 0xe7, 0xdf, 0xef, 0x7e, 0xe7, 0xbf, 0xe7, 0x7e, 0xe7, 0x9e, 0xe7, 0xbe, 0xe7, 0x9e, 0xe7, 0x9e, 0xe7, 0x3d, 0xdf, 0xdf, 0xef, 0x5d, 0xdf, 0x9d, 0xdf, 0xfe, 0xe7, 0x3c, 0xe7, 0xbf, 0xff, 0x5d, 0xef, 0x7e, 0xef, 0x7f, 0xe7, 0x3f, 0xe7, 0x9f, 0xe7, 0x9e, 0xe7, 0x58, 0xce, 0xb1, 0xd4, 0x45, 0xb1, 0x02, 0xc8, 0x00, 0xd0, 0x01, 0xd0, 0x21, 0xc8, 0xe3, 0xa8, 0x45, 0x99, 0x66, 0x99, 0x87, 0x99, 0xa7, 0x91, 0xa7, 0x89, 0xa7, 0x89, 0x86, 0x91, 0x86, 0x89, 0x85, 0x81, 0xe6, 0x89, 0x03, 0x91, 0x63, 0xc8, 0x21, 0xd0, 0x00, 0xc0, 0x20, 0xc8, 0x40, 0xd0, 0x40, 0xd8, 0x20, 0xc8, 0x41, 0xc8, 0x41, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x22, 0xe8, 0x01, 0xd0, 0x00, 0x90, 0x00, 0x60, 0x00, 0x70, 0x62, 0x80, 0x45, 0xa9, 0x08, 0xca, 0xc7, 0xb9, 0x41, 0x78, 0xa0, 0x40, 0x27, 0x32, 0x6e, 0x63, 0xed, 0x52, 0x4e, 0x63, 0xed, 0x5a, 0xe9, 0x39, 0x26, 0x29, 0xc5, 0x20, 0xa4, 0x28, 0x42, 0x30, 0x01, 0x48, 0x42, 0x70, 0xa3, 0x90, 0xa3, 0xa8, 0x82, 0xb0, 0x41, 0xb8, 0x02, 0xd0, 0x02, 0xd0, 0x22, 0xd8, 0x21, 0xc0, 0x20, 0xb0, 0xa2, 0xa8, 0xc3, 0x90, 0x24, 0x91, 0x00, 0x58, 0x41, 0x70, 0x62, 0x80, 0x41, 0x90, 0x83, 0xa0, 0xa3, 0x90, 0x00, 0x78, 0x00, 0x68, 0x00, 0x68, 0x20, 0x58, 0x40, 0x48, 0x00, 0x20, 0x05, 0x52, 0x6a, 0x73, 0x00, 0x00, 0xa0, 0x38, 0x20, 0x50, 0x81, 0x80, 0x60, 0x88, 0x20, 0x88, 0x20, 0x90, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xb8, 0xa3, 0xc0, 0xc3, 0x90, 0x4b, 0xbb, 0x67, 0x82, 0x00, 0x28, 0xa2, 0x68, 0x04, 0xa1, 0x84, 0xc0, 0x45, 0xd9, 0x81, 0xc0, 0x42, 0xd0, 0x01, 0xc8, 0xc3, 0xd0, 0x61, 0xb8, 0x86, 0xd1, 0x24, 0xc9, 0xc3, 0xc8, 0x66, 0xe9, 0x20, 0xb8, 0x20, 0xb0, 0xa6, 0xd1, 0x24, 0xa1, 0x82, 0x70, 0x20, 0x40, 0x40, 0x40, 0x42, 0x60, 0xa4, 0x78, 0x22, 0x60, 0xe4, 0x60, 0x00, 0x30, 0x42, 0x50, 0x62, 0x58, 0x66, 0x69, 0xc7, 0x71, 0xc2, 0x48, 0x29, 0xa2, 0xa7, 0x99, 0x00, 0x90, 0x01, 0xa0, 0x06, 0xb9, 0xec, 0xba, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0x5b, 0xf7, 0x29, 0xaa, 0x2a, 0xd9, 0xd3, 0xd4, 0x78, 0xc6, 0xff, 0xef, 0x9e, 0xef, 0x1e, 0xff, 0x9f, 0xff, 0x3d, 0xe7, 0x9f, 0xf7, 0x3d, 0xef, 0x7e, 0xef, 0x5e, 0xef, 0x5e, 0xef, 0x5e, 0xef, 0x3d, 0xef, 0x5e, 0xef, 0xfc, 0xe6, 0x9f, 0xf7, 0x3d, 0xe7, 0x7d, 0xe7, 0xde, 0xef, 0x1b, 0xe7, 0x9e, 0xff, 0x1c, 0xe7, 0x5e, 0xef, 0x7f, 0xef, 0x1e, 0xe7, 0x9f, 0xef, 0x9e, 0xe7, 0x58, 0xd6, 0x91, 0xdc, 0x45, 0xb9, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x21, 0xc8, 0xc3, 0xa8, 0x24, 0x99, 0x25, 0x99, 0x25, 0x91, 0x25, 0x89, 0x45, 0x81, 0x45, 0x81, 0x05, 0x91, 0x25, 0x89, 0x44, 0x79, 0xa5, 0x81, 0xe3, 0x90, 0x22, 0xc8, 0x21, 0xd8, 0x00, 0xc0, 0x20, 0xc8, 0x40, 0xd0, 0x41, 0xd8, 0x20, 0xc8, 0x20, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xe0, 0x01, 0xc8, 0x41, 0x90, 0x00, 0x58, 0x00, 0x70, 0xa3, 0x88, 0xa3, 0x90, 0xe8, 0xc9, 0x08, 0xd2, 0x24, 0xa1, 0x03, 0x59, 0x85, 0x29, 0x8b, 0x42, 0xac, 0x4a, 0xcc, 0x5a, 0x6f, 0x6b, 0x6b, 0x4a, 0x06, 0x21, 0x06, 0x21, 0xe5, 0x28, 0x63, 0x28, 0x42, 0x38, 0x21, 0x48, 0x42, 0x60, 0x82, 0x80, 0x82, 0x90, 0x61, 0xa0, 0x62, 0xa8, 0x21, 0xa8, 0x62, 0xb0, 0x41, 0xa8, 0x20, 0x98, 0x40, 0x88, 0x20, 0x70, 0x04, 0x81, 0xa3, 0x70, 0x25, 0x89, 0x04, 0x91, 0x21, 0x88, 0x25, 0xb9, 0x49, 0xca, 0xe7, 0x99, 0x82, 0x70, 0x00, 0x58, 0x41, 0x60, 0x21, 0x48, 0x00, 0x28, 0x42, 0x41, 0x4a, 0x83, 0x00, 0x20, 0x00, 0x40, 0x00, 0x60, 0x20, 0x90, 0x41, 0xa0, 0x04, 0xa9, 0xa2, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x21, 0xc0, 0xc3, 0xc0, 0xc6, 0xb1, 0x2c, 0xcb, 0xc5, 0x81, 0x00, 0x40, 0x44, 0x89, 0xe8, 0xc1, 0x25, 0xc1, 0x86, 0xd9, 0x82, 0xc0, 0x62, 0xc8, 0x83, 0xd0, 0x83, 0xc8, 0x22, 0xb8, 0x86, 0xd9, 0xc3, 0xc0, 0x62, 0xb8, 0xe4, 0xd0, 0x62, 0xc0, 0xe4, 0xc8, 0xc7, 0xd9, 0x66, 0xb9, 0x21, 0x68, 0x62, 0x50, 0xa2, 0x48, 0x42, 0x40, 0x00, 0x40, 0x67, 0x69, 0x04, 0x49, 0x41, 0x28, 0xc3, 0x40, 0x83, 0x50, 0xe5, 0x60, 0x24, 0x49, 0x03, 0x39, 0x85, 0x51, 0xe4, 0x60, 0x25, 0x89, 0xe4, 0x98, 0x45, 0x91, 0x14, 0xed, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x5c, 0xf7, 0xab, 0xb2, 0x06, 0xb8, 0x32, 0xcc, 0x99, 0xce, 0xde, 0xef, 0x5e, 0xef, 0xfe, 0xf6, 0x7f, 0xff, 0xfd, 0xee, 0x5e, 0xff, 0x1d, 0xef, 0x3e, 0xf7, 0x1d, 0xf7, 0x3e, 0xf7, 0x1d, 0xf7, 0x1d, 0xf7, 0x3e, 0xf7, 0xdc, 0xee, 0x7f, 0xff, 0x1d, 0xef, 0x5d, 0xef, 0x9e, 0xef, 0xdb, 0xe6, 0x5e, 0xff, 0xfc, 0xe6, 0x5e, 0xef, 0x7f, 0xef, 0xfd, 0xe6, 0x7f, 0xef, 0x7e, 0xef, 0x38, 0xde, 0x71, 0xe4, 0x25, 0xc1, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x21, 0xc8, 0xc2, 0xb0, 0x24, 0xa1, 0x25, 0xa1, 0x25, 0xa1, 0x25, 0x99, 0x45, 0x91, 0x45, 0x91, 0x25, 0xa9, 0x25, 0xa1, 0x65, 0x91, 0xe6, 0x91, 0x04, 0x91, 0x43, 0xc8, 0x22, 0xd0, 0x00, 0xc0, 0x40, 0xc8, 0x60, 0xd0, 0x61, 0xd8, 0x20, 0xc8, 0x20, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x41, 0xc0, 0xa1, 0x88, 0x00, 0x48, 0x61, 0x70, 0x25, 0x91, 0xa3, 0x90, 0xa7, 0xc1, 0x08, 0xd2, 0x65, 0xb1, 0x04, 0x69, 0xc2, 0x20, 0xa8, 0x39, 0x2b, 0x4a, 0xac, 0x5a, 0x2d, 0x6b, 0x0d, 0x63, 0x29, 0x42, 0x46, 0x29, 0xe5, 0x20, 0x05, 0x29, 0xa3, 0x30, 0x41, 0x30, 0x00, 0x40, 0x00, 0x50, 0x00, 0x58, 0x00, 0x60, 0x60, 0x70, 0x00, 0x68, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x40, 0x88, 0x82, 0x80, 0x21, 0x68, 0x82, 0x68, 0xc3, 0x70, 0xc3, 0x80, 0x00, 0x80, 0x41, 0x90, 0x28, 0xba, 0x28, 0xaa, 0x62, 0x60, 0x00, 0x50, 0xe4, 0x78, 0xa3, 0x60, 0x00, 0x38, 0x00, 0x28, 0xc9, 0x8a, 0xc1, 0x58, 0x00, 0x60, 0x01, 0x88, 0x01, 0xa8, 0x41, 0xb0, 0xa6, 0xc9, 0x24, 0xb1, 0xa1, 0xa8, 0x61, 0xa0, 0x81, 0xa8, 0x82, 0xa8, 0x41, 0x90, 0x04, 0xa1, 0x04, 0x99, 0x20, 0x68, 0x20, 0x58, 0xe3, 0x70, 0xe2, 0x80, 0x82, 0xa0, 0xa3, 0xb8, 0xa3, 0xb0, 0x62, 0xa8, 0xc4, 0xb0, 0x63, 0xb0, 0x63, 0xb0, 0xa4, 0xb8, 0xc4, 0xb8, 0xe4, 0xb8, 0x04, 0xb1, 0xe4, 0xb8, 0xe5, 0xc0, 0xc5, 0xa8, 0x00, 0x68, 0x21, 0x60, 0x41, 0x48, 0x00, 0x18, 0x62, 0x40, 0x8f, 0xa3, 0x66, 0x49, 0xc2, 0x28, 0x03, 0x31, 0xa4, 0x58, 0xc5, 0x70, 0xc4, 0x50, 0x85, 0x41, 0x84, 0x21, 0x23, 0x31, 0xe6, 0x71, 0xe3, 0x60, 0xa6, 0x71, 0x57, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x5c, 0xff, 0x0d, 0xbb, 0x09, 0xc8, 0xb4, 0xdc, 0x59, 0xce, 0xbe, 0xef, 0x7e, 0xf7, 0xdd, 0xee, 0x9f, 0xf7, 0x3d, 0xe7, 0x9e, 0xef, 0x5d, 0xe7, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x5d, 0xe7, 0x9e, 0xef, 0x1d, 0xdf, 0xdf, 0xf7, 0x7e, 0xe7, 0x5d, 0xe7, 0x5e, 0xef, 0x9b, 0xe6, 0x3d, 0xf7, 0xdc, 0xde, 0x1d, 0xe7, 0x5e, 0xe7, 0xfd, 0xde, 0x5e, 0xef, 0x5d, 0xef, 0x18, 0xe6, 0x51, 0xec, 0x05, 0xc1, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x20, 0xc8, 0xc1, 0xa8, 0x23, 0xa1, 0x24, 0xa1, 0x25, 0xa1, 0x25, 0xa1, 0x45, 0x91, 0x25, 0x99, 0x05, 0xb1, 0x25, 0xa9, 0x45, 0x99, 0xe7, 0x91, 0xe4, 0x88, 0x02, 0xc0, 0x01, 0xc8, 0x00, 0xc0, 0x60, 0xc8, 0x81, 0xd0, 0x61, 0xd0, 0x41, 0xc8, 0x40, 0xb8, 0x00, 0xc0, 0x00, 0xd0, 0x20, 0xc8, 0x20, 0xc0, 0xa1, 0xb0, 0xe1, 0x88, 0x00, 0x38, 0x41, 0x60, 0x25, 0x89, 0x82, 0x88, 0x86, 0xc1, 0xa7, 0xd1, 0x05, 0xb1, 0xe3, 0x78, 0x62, 0x30, 0x26, 0x31, 0xa8, 0x39, 0x4a, 0x52, 0x6a, 0x52, 0xec, 0x5a, 0xcc, 0x5a, 0xc8, 0x31, 0x25, 0x19, 0x05, 0x21, 0x04, 0x29, 0xe3, 0x28, 0xc2, 0x30, 0x60, 0x30, 0x00, 0x30, 0x20, 0x40, 0x00, 0x48, 0x00, 0x58, 0xc3, 0x88, 0xc3, 0xa0, 0x00, 0x98, 0x01, 0x90, 0x62, 0x88, 0x86, 0x91, 0x04, 0x71, 0x00, 0x40, 0x20, 0x58, 0x81, 0x70, 0xa1, 0x88, 0xc2, 0x90, 0x83, 0x88, 0x00, 0x70, 0x00, 0x68, 0x63, 0x80, 0x21, 0x68, 0x61, 0x58, 0x00, 0x28, 0x68, 0x82, 0xe6, 0x79, 0x00, 0x60, 0x21, 0x88, 0x01, 0xa0, 0x00, 0xa0, 0xa2, 0xb0, 0xe3, 0xb0, 0x44, 0xb9, 0x65, 0xc1, 0xe3, 0xb0, 0x00, 0x98, 0x22, 0xa0, 0x63, 0xa8, 0x05, 0xb9, 0x05, 0xa1, 0x00, 0x60, 0x00, 0x40, 0x00, 0x30, 0x41, 0x70, 0xa2, 0x80, 0x00, 0x58, 0x00, 0x48, 0x20, 0x68, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x78, 0x20, 0x68, 0x20, 0x60, 0x00, 0x60, 0x00, 0x68, 0x01, 0x78, 0x01, 0x78, 0x00, 0x40, 0x00, 0x38, 0x00, 0x30, 0xcb, 0x82, 0xaf, 0xa3, 0xe4, 0x30, 0xa3, 0x28, 0xa3, 0x30, 0x26, 0x59, 0x88, 0x79, 0xc4, 0x50, 0x86, 0x49, 0xc6, 0x31, 0xa6, 0x41, 0x66, 0x61, 0x25, 0x69, 0x86, 0x69, 0x38, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbe, 0xff, 0x5c, 0xff, 0x8f, 0xbb, 0xa9, 0xb8, 0x94, 0xd4, 0xd7, 0xc5, 0xbf, 0xef, 0xbf, 0xf7, 0x1e, 0xef, 0xbf, 0xf7, 0x5d, 0xdf, 0xbf, 0xef, 0x7d, 0xe7, 0xbe, 0xe7, 0x9e, 0xe7, 0xbe, 0xe7, 0x9e, 0xe7, 0x9e, 0xe7, 0xbe, 0xef, 0x5d, 0xdf, 0xff, 0xf7, 0x7e, 0xe7, 0x7e, 0xe7, 0x7f, 0xef, 0xdc, 0xe6, 0x7f, 0xff, 0x3d, 0xe7, 0x7e, 0xe7, 0x9f, 0xe7, 0xfd, 0xde, 0x5e, 0xef, 0x5d, 0xef, 0x18, 0xde, 0x51, 0xec, 0x05, 0xc1, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x20, 0xc8, 0xc1, 0xa8, 0x02, 0x99, 0x03, 0x99, 0xe4, 0x98, 0xe4, 0x90, 0x04, 0x89, 0x04, 0x91, 0xc4, 0xa0, 0xe4, 0xa0, 0xe4, 0x90, 0xc6, 0x89, 0xc3, 0x88, 0x02, 0xb8, 0x01, 0xc8, 0x20, 0xc0, 0xa1, 0xc8, 0xc2, 0xd0, 0x24, 0xe1, 0x04, 0xd1, 0xc3, 0xc8, 0x82, 0xc8, 0x82, 0xd0, 0x81, 0xd0, 0x81, 0xc0, 0x03, 0xb1, 0x23, 0x89, 0x00, 0x48, 0x20, 0x58, 0xc3, 0x80, 0x62, 0x80, 0x66, 0xc1, 0xe8, 0xd9, 0x46, 0xb9, 0xc4, 0x80, 0x62, 0x38, 0x05, 0x39, 0x26, 0x31, 0xe9, 0x49, 0x6a, 0x5a, 0x8b, 0x52, 0xcc, 0x52, 0xec, 0x52, 0x09, 0x32, 0x25, 0x19, 0xe4, 0x10, 0x04, 0x21, 0x24, 0x29, 0xe2, 0x28, 0xa1, 0x28, 0xe2, 0x38, 0x81, 0x48, 0x20, 0x58, 0xa3, 0x88, 0xa3, 0xa0, 0x00, 0x90, 0x00, 0x88, 0x01, 0x88, 0x00, 0x60, 0x41, 0x50, 0x00, 0x40, 0x00, 0x48, 0x00, 0x60, 0x00, 0x68, 0x20, 0x78, 0x62, 0x80, 0x01, 0x78, 0x01, 0x78, 0x83, 0x90, 0x42, 0x80, 0x21, 0x70, 0x00, 0x58, 0xa5, 0x89, 0x27, 0x9a, 0x00, 0x60, 0x00, 0x78, 0x00, 0x90, 0x00, 0x98, 0x40, 0xb0, 0x61, 0xb0, 0x82, 0xb0, 0x82, 0xa8, 0x21, 0xa0, 0x00, 0x90, 0x43, 0xb0, 0x64, 0xc0, 0xc5, 0xc8, 0xc5, 0xb0, 0x00, 0x70, 0x00, 0x40, 0x00, 0x28, 0xe3, 0x70, 0x61, 0x60, 0x00, 0x30, 0x20, 0x48, 0x00, 0x40, 0x00, 0x58, 0x00, 0x70, 0x01, 0x80, 0x41, 0x70, 0x00, 0x58, 0x00, 0x50, 0x00, 0x58, 0x01, 0x70, 0x01, 0x78, 0xa3, 0x88, 0x21, 0x60, 0xc3, 0x60, 0x01, 0x58, 0xec, 0x9a, 0xab, 0x8a, 0x41, 0x28, 0xe4, 0x40, 0xa4, 0x50, 0x87, 0x69, 0x6a, 0x82, 0x25, 0x51, 0x45, 0x49, 0xc7, 0x41, 0x09, 0x62, 0x05, 0x59, 0xab, 0xa2, 0xe8, 0x79, 0xbb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xde, 0xff, 0x9d, 0xff, 0x32, 0xc4, 0xec, 0xc1, 0x16, 0xdd, 0x19, 0xce, 0xff, 0xf7, 0xbf, 0xef, 0x3e, 0xe7, 0x9f, 0xf7, 0x3d, 0xe7, 0x9f, 0xef, 0x5e, 0xe7, 0x9e, 0xef, 0x7e, 0xef, 0x9e, 0xef, 0x9f, 0xef, 0x7e, 0xef, 0xbf, 0xef, 0x3d, 0xe7, 0xff, 0xf7, 0x5e, 0xe7, 0x7e, 0xe7, 0x9f, 0xef, 0xfd, 0xe6, 0xbf, 0xf7, 0x7e, 0xdf, 0xbf, 0xdf, 0xdf, 0xdf, 0x1e, 0xd7, 0x5e, 0xe7, 0x3d, 0xe7, 0xf8, 0xd5, 0x51, 0xe4, 0x26, 0xb9, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x20, 0xc0, 0xc2, 0xa8, 0x23, 0x91, 0x24, 0x91, 0x45, 0x91, 0x66, 0x91, 0x86, 0x89, 0x66, 0x89, 0x46, 0xa1, 0x46, 0x99, 0x86, 0x91, 0xe7, 0x81, 0xe4, 0x88, 0x23, 0xc0, 0x22, 0xc8, 0x21, 0xc0, 0x61, 0xc0, 0x81, 0xc0, 0xa2, 0xc8, 0xc3, 0xc0, 0xa2, 0xb8, 0x62, 0xc0, 0x62, 0xc8, 0x61, 0xc8, 0x61, 0xb8, 0xa1, 0xa0, 0xe2, 0x88, 0x00, 0x50, 0x00, 0x50, 0x62, 0x68, 0x82, 0x88, 0xa3, 0xa8, 0x08, 0xda, 0xe8, 0xc9, 0xe4, 0x88, 0x21, 0x40, 0x05, 0x31, 0x05, 0x29, 0xa7, 0x39, 0x08, 0x4a, 0x49, 0x4a, 0x6a, 0x4a, 0xab, 0x4a, 0xab, 0x42, 0x49, 0x3a, 0x86, 0x21, 0x24, 0x19, 0x45, 0x21, 0x24, 0x29, 0x03, 0x29, 0x44, 0x39, 0xc3, 0x50, 0x00, 0x50, 0x43, 0x78, 0xc5, 0xa8, 0xa4, 0xa8, 0xc5, 0xa8, 0x47, 0xa9, 0x01, 0x60, 0x00, 0x40, 0x40, 0x48, 0x00, 0x50, 0x00, 0x68, 0x40, 0x88, 0xa1, 0x80, 0x40, 0x50, 0x00, 0x50, 0x00, 0x60, 0x41, 0x88, 0x62, 0x98, 0x01, 0x90, 0x00, 0x90, 0xa2, 0x98, 0x28, 0xc2, 0x00, 0x80, 0x20, 0x80, 0x60, 0x90, 0x20, 0x98, 0x82, 0xc0, 0x82, 0xc8, 0x41, 0xb8, 0x00, 0xa0, 0x00, 0x88, 0x21, 0x88, 0x63, 0xb8, 0x27, 0xd1, 0x48, 0xe1, 0x44, 0xb0, 0x63, 0x90, 0x25, 0x81, 0x24, 0x69, 0x66, 0x79, 0xe4, 0x70, 0x41, 0x50, 0xe3, 0x68, 0x61, 0x68, 0x21, 0x78, 0x00, 0x80, 0x01, 0x88, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x21, 0x70, 0x01, 0x78, 0x21, 0x78, 0x41, 0x78, 0xe3, 0x70, 0xe7, 0x89, 0x00, 0x60, 0xc4, 0x70, 0xa4, 0x68, 0x01, 0x50, 0x87, 0x81, 0xe5, 0x70, 0xe4, 0x58, 0x6a, 0x7a, 0x45, 0x51, 0x86, 0x51, 0xa8, 0x49, 0xc9, 0x61, 0x26, 0x69, 0x4b, 0x9a, 0xac, 0x92, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xf4, 0xc4, 0xa8, 0x90, 0x93, 0xc4, 0x18, 0xce, 0xdf, 0xf7, 0x7e, 0xe7, 0x7e, 0xe7, 0x9f, 0xef, 0x5e, 0xe7, 0x7e, 0xef, 0x5e, 0xe7, 0x7f, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0xbf, 0xf7, 0x1d, 0xdf, 0xbf, 0xf7, 0x3d, 0xe7, 0x5e, 0xe7, 0x7f, 0xe7, 0xdd, 0xde, 0xbf, 0xf7, 0x5d, 0xd7, 0x9e, 0xd7, 0x7e, 0xd7, 0x1e, 0xd7, 0x9f, 0xef, 0x1d, 0xdf, 0x18, 0xd6, 0xb3, 0xdc, 0x25, 0xa1, 0x22, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x41, 0xc0, 0x03, 0xa1, 0x64, 0x91, 0x65, 0x89, 0x86, 0x89, 0x65, 0x79, 0xa6, 0x71, 0xa7, 0x79, 0x46, 0x81, 0xa7, 0x89, 0x86, 0x71, 0xe7, 0x79, 0xe4, 0x88, 0x03, 0xb8, 0x02, 0xc8, 0x00, 0xb0, 0x00, 0xb0, 0x40, 0xb8, 0x00, 0xb0, 0x00, 0xa0, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0x98, 0x20, 0x88, 0x82, 0x78, 0x82, 0x68, 0x00, 0x58, 0xc4, 0x88, 0xc3, 0xa0, 0xe8, 0xd1, 0xe8, 0xc9, 0x45, 0x91, 0x21, 0x48, 0x04, 0x31, 0x05, 0x21, 0x45, 0x31, 0x65, 0x31, 0xe7, 0x39, 0x08, 0x3a, 0xe8, 0x31, 0x49, 0x3a, 0xab, 0x4a, 0x6a, 0x42, 0xe8, 0x39, 0xa7, 0x31, 0x45, 0x29, 0x24, 0x29, 0x65, 0x39, 0xe4, 0x38, 0x82, 0x40, 0xc4, 0x68, 0x47, 0x99, 0x47, 0xa9, 0x67, 0xa1, 0xa8, 0x99, 0x00, 0x48, 0x00, 0x30, 0x21, 0x50, 0x00, 0x70, 0x00, 0x88, 0x00, 0xa8, 0x81, 0x98, 0xa1, 0x78, 0x20, 0x70, 0x00, 0x78, 0x00, 0x80, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0xa2, 0xa8, 0xe7, 0xd1, 0xc2, 0xb0, 0x61, 0x98, 0x60, 0x98, 0x20, 0xa8, 0x21, 0xc0, 0xa3, 0xd0, 0x83, 0xc8, 0x42, 0xa8, 0x00, 0x88, 0x41, 0x80, 0x83, 0xa0, 0x47, 0xc9, 0xa8, 0xe9, 0x03, 0xb0, 0xc5, 0xa0, 0x88, 0x99, 0xc4, 0x60, 0x62, 0x58, 0x62, 0x58, 0x00, 0x48, 0x00, 0x60, 0x21, 0x78, 0x41, 0x88, 0x00, 0x88, 0x01, 0x90, 0x01, 0x88, 0x21, 0x88, 0x21, 0x88, 0x42, 0x80, 0x00, 0x70, 0x81, 0x80, 0x40, 0x78, 0x81, 0x78, 0xa6, 0x91, 0x41, 0x68, 0x21, 0x68, 0x21, 0x60, 0x22, 0x68, 0x88, 0x99, 0x05, 0x79, 0x83, 0x60, 0x65, 0x69, 0xa6, 0x61, 0xa6, 0x51, 0xe8, 0x41, 0xc8, 0x49, 0xa8, 0x61, 0xcc, 0x8a, 0x4e, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xf8, 0xdd, 0xeb, 0x91, 0xb4, 0xc4, 0xd7, 0xc5, 0xff, 0xff, 0xdf, 0xf7, 0x7d, 0xef, 0xdf, 0xf7, 0xbf, 0xf7, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xff, 0xff, 0x1d, 0xe7, 0xdf, 0xf7, 0x5e, 0xef, 0x7e, 0xef, 0x5f, 0xef, 0xdd, 0xde, 0xdf, 0xf7, 0x5d, 0xd7, 0xbf, 0xdf, 0x9f, 0xdf, 0x7b, 0xce, 0xdf, 0xff, 0x3d, 0xe7, 0xf7, 0xcd, 0xd3, 0xdc, 0x46, 0x99, 0x84, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x22, 0xb8, 0x04, 0x99, 0x64, 0x81, 0x24, 0x71, 0x66, 0x71, 0x45, 0x61, 0xa6, 0x59, 0xe7, 0x61, 0x25, 0x61, 0xe8, 0x71, 0x65, 0x51, 0xa6, 0x69, 0xe4, 0x80, 0x03, 0xb8, 0x22, 0xc8, 0x00, 0xb0, 0x00, 0xa8, 0x40, 0xb8, 0xa2, 0xc8, 0x62, 0xb8, 0x82, 0xb0, 0x62, 0xb8, 0x21, 0xb8, 0x41, 0xc0, 0x61, 0xb8, 0x41, 0xb0, 0x41, 0xa0, 0xc3, 0x98, 0xc3, 0x78, 0x00, 0x50, 0x04, 0x89, 0xe8, 0xc1, 0x28, 0xd2, 0xc7, 0xc1, 0x66, 0xa1, 0x62, 0x50, 0xe4, 0x30, 0xe4, 0x18, 0x44, 0x29, 0x85, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x86, 0x29, 0xe8, 0x39, 0x6a, 0x4a, 0xab, 0x52, 0x8b, 0x52, 0x09, 0x4a, 0x67, 0x39, 0x45, 0x31, 0x45, 0x29, 0x24, 0x29, 0xc3, 0x38, 0xc3, 0x50, 0xe4, 0x60, 0x04, 0x61, 0x25, 0x59, 0x04, 0x51, 0x82, 0x40, 0x63, 0x58, 0x63, 0x80, 0x03, 0xa0, 0x01, 0xb8, 0x01, 0xb0, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa0, 0x21, 0xa8, 0x00, 0xa0, 0x00, 0x98, 0x20, 0xa0, 0x81, 0xa8, 0xc2, 0xb0, 0xc2, 0xb0, 0xa1, 0xb0, 0x20, 0xa8, 0x00, 0xa8, 0x00, 0xb8, 0x42, 0xc0, 0x63, 0xb0, 0xa4, 0x98, 0x41, 0x70, 0x20, 0x58, 0x81, 0x70, 0x24, 0xa9, 0x26, 0xd1, 0x03, 0xb8, 0x67, 0xb1, 0x8b, 0xba, 0x28, 0x7a, 0xc6, 0x69, 0xe2, 0x58, 0x00, 0x60, 0x00, 0x70, 0x00, 0x80, 0x20, 0x80, 0x20, 0x80, 0x00, 0x88, 0x00, 0x80, 0x42, 0xa0, 0x00, 0x88, 0x00, 0x88, 0x20, 0x70, 0x00, 0x68, 0x81, 0x78, 0xc3, 0x98, 0x20, 0x80, 0x20, 0x58, 0xa2, 0x68, 0x00, 0x60, 0x22, 0x78, 0x05, 0x89, 0xa3, 0x68, 0x45, 0x79, 0xa7, 0x89, 0x07, 0x82, 0xe2, 0x38, 0xc7, 0x29, 0xc8, 0x39, 0x8b, 0x6a, 0x92, 0xb4, 0x55, 0xbd, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x52, 0xbc, 0x15, 0xcd, 0xd7, 0xd5, 0xfb, 0xf6, 0xda, 0xee, 0xba, 0xe6, 0xfb, 0xe6, 0xdb, 0xde, 0x9a, 0xde, 0x9a, 0xde, 0x9a, 0xde, 0x9a, 0xde, 0x9a, 0xd6, 0xba, 0xde, 0x9a, 0xde, 0xfb, 0xe6, 0x59, 0xd6, 0xfb, 0xe6, 0xba, 0xde, 0xbb, 0xe6, 0x9c, 0xee, 0x3a, 0xe6, 0xfc, 0xf6, 0xba, 0xde, 0x1c, 0xdf, 0xfc, 0xe6, 0xdc, 0xf6, 0x5f, 0xff, 0xdc, 0xee, 0xf7, 0xdd, 0x13, 0xe5, 0x46, 0x99, 0x01, 0xb0, 0x63, 0xd8, 0x02, 0xd0, 0x42, 0xb8, 0xe4, 0x90, 0xe3, 0x68, 0x20, 0x48, 0x82, 0x40, 0x62, 0x30, 0xa2, 0x28, 0xc3, 0x28, 0x21, 0x28, 0xc3, 0x38, 0x21, 0x18, 0x44, 0x51, 0xa3, 0x78, 0x23, 0xb8, 0x42, 0xc8, 0x00, 0xb8, 0x00, 0xa8, 0x00, 0xb0, 0xa2, 0xc8, 0xa2, 0xc0, 0xc3, 0xb8, 0xa3, 0xc8, 0x82, 0xc8, 0x82, 0xd0, 0xa2, 0xd0, 0x81, 0xc8, 0x62, 0xb8, 0x83, 0xa0, 0x41, 0x68, 0x00, 0x48, 0x25, 0x89, 0xc7, 0xb1, 0xc7, 0xc1, 0x85, 0xb1, 0x86, 0xa9, 0x82, 0x60, 0xc3, 0x30, 0xe3, 0x18, 0x24, 0x29, 0x65, 0x31, 0x86, 0x31, 0x45, 0x29, 0x24, 0x29, 0x25, 0x29, 0x25, 0x29, 0x87, 0x39, 0x2a, 0x52, 0xac, 0x62, 0xac, 0x62, 0x4a, 0x5a, 0x09, 0x52, 0x08, 0x3a, 0xc6, 0x29, 0x04, 0x29, 0xe2, 0x28, 0x03, 0x31, 0x24, 0x31, 0x44, 0x31, 0xe7, 0x49, 0x45, 0x39, 0x25, 0x51, 0x67, 0x81, 0x06, 0x99, 0x43, 0xa0, 0x03, 0xb8, 0x03, 0xc8, 0x01, 0xc0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x81, 0xa8, 0xa2, 0xa8, 0xa1, 0xa8, 0x40, 0x98, 0x41, 0xa0, 0xa2, 0xb0, 0x61, 0xb0, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xa8, 0x21, 0x88, 0x44, 0x71, 0x84, 0x59, 0xa0, 0x28, 0xc1, 0x50, 0xa5, 0xa1, 0x82, 0xb0, 0x22, 0xb8, 0xe9, 0xc1, 0x30, 0xcc, 0xf2, 0xac, 0x8c, 0x8b, 0xa5, 0x69, 0x00, 0x60, 0x20, 0x78, 0x41, 0x80, 0x40, 0x80, 0x60, 0x80, 0x20, 0x80, 0x20, 0x88, 0x00, 0x98, 0x00, 0x88, 0x41, 0x88, 0x00, 0x60, 0x00, 0x68, 0x40, 0x80, 0x46, 0xa9, 0x61, 0x78, 0x00, 0x40, 0x00, 0x38, 0x03, 0x61, 0x65, 0x81, 0x82, 0x68, 0x20, 0x58, 0x86, 0x81, 0x65, 0x81, 0x45, 0x89, 0x86, 0x79, 0xe9, 0x59, 0xc8, 0x51, 0x26, 0x51, 0x4a, 0x7a, 0x59, 0xee, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x96, 0xdd, 0xb3, 0xcc, 0x96, 0xed, 0x75, 0xed, 0x54, 0xe5, 0x37, 0xfe, 0x14, 0xd5, 0xd3, 0xcc, 0xb2, 0xcc, 0x92, 0xc4, 0xb2, 0xcc, 0xb2, 0xcc, 0xb2, 0xcc, 0x92, 0xc4, 0x92, 0xc4, 0xd3, 0xcc, 0x92, 0xc4, 0x34, 0xdd, 0x14, 0xd5, 0xf4, 0xd4, 0xb4, 0xd4, 0x52, 0xcc, 0xb3, 0xd4, 0x71, 0xbc, 0x92, 0xbc, 0x72, 0xbc, 0x93, 0xd4, 0xd1, 0xc3, 0x72, 0xc4, 0x54, 0xe5, 0x50, 0xdc, 0x04, 0xa9, 0x62, 0xc0, 0x00, 0xc8, 0x01, 0xc8, 0x22, 0xb8, 0x04, 0x99, 0x85, 0x81, 0x24, 0x61, 0xa7, 0x61, 0xc7, 0x59, 0x28, 0x52, 0x49, 0x52, 0x66, 0x51, 0x29, 0x62, 0xc6, 0x49, 0x85, 0x59, 0xe4, 0x80, 0x03, 0xb8, 0x01, 0xc0, 0x20, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb8, 0x21, 0xb8, 0x61, 0xb0, 0x41, 0xc0, 0x01, 0xc0, 0x20, 0xc8, 0x20, 0xc8, 0x00, 0xc0, 0x02, 0xc0, 0x22, 0xa8, 0x00, 0x60, 0x00, 0x48, 0x45, 0x81, 0x89, 0xc2, 0x48, 0xca, 0x86, 0xb9, 0xa7, 0xb9, 0x62, 0x70, 0x82, 0x38, 0xc3, 0x20, 0xe3, 0x28, 0x04, 0x29, 0x24, 0x31, 0x45, 0x31, 0x45, 0x31, 0x25, 0x31, 0x05, 0x31, 0x25, 0x31, 0x66, 0x39, 0xa8, 0x41, 0xe9, 0x49, 0x4a, 0x5a, 0xac, 0x62, 0x8b, 0x52, 0x6a, 0x4a, 0x28, 0x42, 0x07, 0x3a, 0xc6, 0x31, 0x85, 0x21, 0x44, 0x19, 0x86, 0x21, 0x25, 0x21, 0x25, 0x31, 0x46, 0x51, 0x45, 0x69, 0xe4, 0x70, 0x42, 0x80, 0x23, 0xa0, 0xc5, 0xb8, 0xc5, 0xb8, 0x83, 0xb0, 0x22, 0xa8, 0x21, 0xa0, 0xa3, 0xb8, 0xa6, 0xd1, 0x45, 0xc1, 0x20, 0xa0, 0x20, 0x90, 0x20, 0x90, 0x00, 0x90, 0x40, 0xa8, 0x41, 0x98, 0x00, 0x60, 0xe3, 0x48, 0xe6, 0x49, 0x62, 0x21, 0x01, 0x49, 0x48, 0xb2, 0xa2, 0xb8, 0xa4, 0xc8, 0x87, 0xb9, 0x8d, 0xab, 0x90, 0x94, 0xa9, 0x6a, 0xe2, 0x50, 0x00, 0x58, 0x62, 0x80, 0x41, 0x88, 0x00, 0x80, 0x20, 0x80, 0x20, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x00, 0x90, 0x41, 0x88, 0x00, 0x60, 0x41, 0x68, 0x20, 0x70, 0xa3, 0x80, 0x61, 0x68, 0x24, 0x61, 0xe3, 0x40, 0x23, 0x41, 0x49, 0x82, 0xa3, 0x60, 0x21, 0x50, 0xc6, 0x81, 0xc6, 0x81, 0x04, 0x81, 0x67, 0x89, 0xe5, 0x58, 0x27, 0x61, 0x03, 0x58, 0x2e, 0xab, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0x1c, 0xff, 0xf4, 0xe4, 0x29, 0xaa, 0xab, 0xc2, 0x69, 0xba, 0x28, 0xb2, 0xab, 0xca, 0x8a, 0xca, 0x6a, 0xc2, 0x6a, 0xc2, 0x8a, 0xca, 0x8a, 0xca, 0x8a, 0xca, 0x8a, 0xca, 0x6a, 0xc2, 0x8b, 0xca, 0x6a, 0xc2, 0xcb, 0xd2, 0xab, 0xca, 0x0d, 0xcb, 0x6e, 0xcb, 0x0c, 0xcb, 0x2c, 0xcb, 0x0b, 0xbb, 0x0b, 0xbb, 0xec, 0xba, 0xed, 0xca, 0xac, 0xca, 0x2d, 0xc3, 0x0b, 0xbb, 0x64, 0xa1, 0x00, 0x98, 0x00, 0xc8, 0x00, 0xc8, 0x01, 0xc8, 0x21, 0xb8, 0xe3, 0x90, 0x85, 0x81, 0xa6, 0x79, 0x66, 0x61, 0x04, 0x49, 0xa6, 0x49, 0xa6, 0x49, 0xa3, 0x40, 0x86, 0x59, 0x65, 0x49, 0x64, 0x59, 0x04, 0x81, 0x23, 0xb8, 0x01, 0xc0, 0x20, 0xc0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xc0, 0x41, 0xc0, 0x61, 0xb8, 0x01, 0xc0, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc0, 0x02, 0xc8, 0x43, 0xa8, 0x00, 0x58, 0x00, 0x48, 0x61, 0x68, 0x4c, 0xd3, 0xca, 0xd2, 0x65, 0xb9, 0x66, 0xc1, 0x21, 0x80, 0x21, 0x48, 0x82, 0x30, 0xa3, 0x30, 0xa3, 0x28, 0xc3, 0x30, 0x24, 0x39, 0x45, 0x39, 0x25, 0x39, 0x25, 0x31, 0x25, 0x31, 0x45, 0x31, 0x46, 0x31, 0x66, 0x31, 0x87, 0x31, 0xa7, 0x39, 0x0a, 0x52, 0x2a, 0x5a, 0x8b, 0x5a, 0xaa, 0x52, 0x89, 0x4a, 0x49, 0x3a, 0x08, 0x32, 0x87, 0x29, 0xa7, 0x31, 0x67, 0x29, 0x25, 0x21, 0x23, 0x21, 0x02, 0x21, 0xe2, 0x28, 0x03, 0x41, 0x45, 0x61, 0x25, 0x71, 0xc4, 0x80, 0xc4, 0x98, 0x26, 0xb9, 0x84, 0xb8, 0xc9, 0xe1, 0xa8, 0xd1, 0x83, 0xa0, 0x01, 0x80, 0x00, 0x68, 0x00, 0x68, 0x81, 0x88, 0x82, 0x88, 0x00, 0x58, 0x61, 0x38, 0x44, 0x39, 0x43, 0x29, 0xe5, 0x71, 0x2b, 0xdb, 0xc3, 0xc0, 0x83, 0xc8, 0x66, 0xb9, 0x48, 0x82, 0x27, 0x42, 0x65, 0x51, 0x62, 0x58, 0x22, 0x68, 0x63, 0x88, 0x22, 0x90, 0x00, 0x90, 0x00, 0x98, 0x01, 0xa0, 0x62, 0xb0, 0x42, 0xb0, 0xc4, 0xb0, 0x05, 0xa9, 0x25, 0x91, 0xa7, 0x89, 0xa3, 0x60, 0x42, 0x48, 0x62, 0x40, 0xaa, 0x82, 0xea, 0x72, 0xc1, 0x08, 0x40, 0x28, 0xc4, 0x50, 0x05, 0x69, 0x24, 0x61, 0xc2, 0x48, 0x00, 0x58, 0x24, 0x80, 0xe7, 0x78, 0x04, 0x68, 0x2b, 0xa2, 0x98, 0xfd, 0x7f, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xd7, 0xfd, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0x90, 0x00, 0x90, 0x80, 0xa0, 0x40, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x21, 0xd0, 0x41, 0xb8, 0xe2, 0x90, 0x84, 0x81, 0x44, 0x71, 0x44, 0x69, 0x04, 0x51, 0x65, 0x51, 0x86, 0x59, 0xa4, 0x58, 0x87, 0x69, 0x65, 0x59, 0x23, 0x59, 0x03, 0x81, 0x23, 0xb8, 0x21, 0xc8, 0x61, 0xc8, 0x20, 0xb8, 0x00, 0xa8, 0x00, 0xc0, 0x41, 0xc0, 0x41, 0xc0, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x40, 0xd0, 0x20, 0xc8, 0x01, 0xc8, 0x02, 0xa8, 0x00, 0x50, 0x00, 0x38, 0x00, 0x40, 0xa2, 0x78, 0x23, 0x99, 0xe3, 0xa8, 0x46, 0xc9, 0x23, 0xa0, 0x22, 0x60, 0x42, 0x30, 0x82, 0x30, 0x82, 0x30, 0x83, 0x30, 0xa3, 0x30, 0xe4, 0x38, 0x04, 0x39, 0xe4, 0x28, 0xe3, 0x28, 0x45, 0x29, 0x86, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x45, 0x21, 0x67, 0x39, 0x88, 0x41, 0xc9, 0x41, 0x29, 0x42, 0x69, 0x42, 0x8a, 0x4a, 0x6b, 0x52, 0x4b, 0x5a, 0x6d, 0x62, 0x4c, 0x5a, 0x29, 0x4a, 0x07, 0x32, 0x06, 0x22, 0x84, 0x21, 0x23, 0x21, 0x03, 0x29, 0xe2, 0x28, 0xe3, 0x38, 0x24, 0x61, 0xa6, 0x89, 0x04, 0x81, 0x86, 0x99, 0xe5, 0x88, 0xa4, 0x78, 0xa3, 0x70, 0x21, 0x58, 0x20, 0x58, 0x00, 0x60, 0x61, 0x78, 0x01, 0x68, 0x02, 0x58, 0xc5, 0x58, 0x04, 0x51, 0x68, 0x9a, 0x6d, 0xf3, 0xe3, 0xc8, 0x21, 0xc0, 0x87, 0xc9, 0x08, 0x92, 0x03, 0x31, 0x04, 0x49, 0xa3, 0x58, 0x83, 0x58, 0x83, 0x70, 0x83, 0x88, 0x42, 0xa0, 0x01, 0xa8, 0xa3, 0xb0, 0x87, 0xd1, 0x00, 0x98, 0xaa, 0xd2, 0x08, 0xba, 0xcc, 0xba, 0x31, 0xd4, 0xa7, 0x51, 0xa3, 0x38, 0xc4, 0x38, 0xa7, 0x41, 0xc6, 0x39, 0x86, 0x31, 0x82, 0x30, 0x00, 0x00, 0x00, 0x20, 0x82, 0x38, 0x0b, 0x73, 0x6d, 0x93, 0x71, 0xbc, 0xf3, 0xb4, 0xf3, 0xc4, 0x7a, 0xfe, 0x9e, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x31, 0xe4, 0x26, 0xc1, 0x42, 0xb8, 0xc3, 0xd0, 0xa2, 0xc8, 0xc2, 0xd0, 0xa2, 0xc8, 0xa2, 0xd0, 0xc2, 0xd0, 0xa2, 0xd0, 0x61, 0xc8, 0x41, 0xc0, 0x61, 0xc8, 0x61, 0xc8, 0x81, 0xc8, 0xc2, 0xd0, 0xa2, 0xd0, 0x61, 0xc8, 0x61, 0xc0, 0x61, 0xc0, 0xa2, 0xc8, 0xa2, 0xc8, 0xe2, 0xc8, 0xc2, 0xc8, 0xa2, 0xd0, 0x42, 0xd0, 0x83, 0xd8, 0xc3, 0xc8, 0x04, 0xc9, 0xa1, 0xc0, 0x20, 0xd0, 0x40, 0xe0, 0x40, 0xd8, 0x82, 0xd8, 0xa2, 0xc8, 0x43, 0xa9, 0x84, 0x91, 0xc2, 0x68, 0x03, 0x61, 0xe3, 0x50, 0xe3, 0x48, 0xe4, 0x50, 0x63, 0x58, 0x45, 0x71, 0xc3, 0x50, 0x44, 0x61, 0x24, 0x89, 0x02, 0xb8, 0x00, 0xc0, 0x81, 0xc8, 0xa1, 0xc8, 0x20, 0xb8, 0x41, 0xc8, 0xa2, 0xd0, 0xa2, 0xc8, 0x41, 0xd0, 0x42, 0xd8, 0x82, 0xe0, 0xa2, 0xe0, 0x41, 0xc8, 0x01, 0xb8, 0x22, 0xa0, 0x00, 0x58, 0x20, 0x50, 0x00, 0x48, 0xc3, 0x88, 0x86, 0xb1, 0x04, 0xb1, 0x46, 0xd1, 0x03, 0xa8, 0x63, 0x80, 0x63, 0x58, 0x01, 0x38, 0x62, 0x38, 0x82, 0x38, 0x62, 0x28, 0x82, 0x30, 0x25, 0x41, 0x45, 0x49, 0x05, 0x41, 0x04, 0x31, 0x04, 0x21, 0x44, 0x21, 0x85, 0x21, 0x86, 0x21, 0x46, 0x29, 0x27, 0x31, 0x66, 0x31, 0x86, 0x29, 0xa7, 0x31, 0xa8, 0x41, 0xa9, 0x49, 0xcb, 0x61, 0x4d, 0x72, 0xae, 0x7a, 0x0e, 0x73, 0x4d, 0x63, 0x2b, 0x4b, 0x8a, 0x42, 0x09, 0x4a, 0x86, 0x31, 0x44, 0x21, 0x23, 0x19, 0x22, 0x19, 0x22, 0x19, 0x23, 0x29, 0x44, 0x39, 0x81, 0x30, 0xa3, 0x40, 0xe4, 0x50, 0x83, 0x48, 0x04, 0x59, 0x43, 0x61, 0x45, 0x71, 0x83, 0x68, 0x04, 0x68, 0x44, 0x68, 0x05, 0x71, 0xc7, 0x91, 0x0b, 0xe3, 0x45, 0xd1, 0x42, 0xc8, 0x87, 0xd1, 0xc8, 0xa1, 0x03, 0x49, 0xe4, 0x48, 0x05, 0x49, 0xe3, 0x40, 0xa3, 0x50, 0xe4, 0x70, 0x83, 0x80, 0x00, 0x80, 0x01, 0x90, 0x6a, 0xc2, 0x0c, 0xcb, 0x08, 0xa2, 0x24, 0x81, 0xc7, 0x89, 0x0d, 0x93, 0x28, 0x4a, 0xc4, 0x30, 0xe4, 0x30, 0x04, 0x19, 0x65, 0x31, 0xe4, 0x28, 0xc9, 0x69, 0x94, 0xc4, 0x11, 0xa4, 0xe2, 0x48, 0x58, 0xe6, 0x5c, 0xff, 0x7c, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0x5b, 0xef, 0xfe, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x35, 0xd5, 0xec, 0xba, 0x4a, 0xd2, 0xa3, 0xc0, 0x45, 0xd9, 0x64, 0xd9, 0x64, 0xd1, 0x45, 0xd1, 0x45, 0xd1, 0x45, 0xd1, 0x45, 0xd9, 0x25, 0xd9, 0x25, 0xd9, 0x46, 0xd9, 0x45, 0xd9, 0x66, 0xe1, 0x45, 0xd9, 0x03, 0xd1, 0x65, 0xd9, 0xa2, 0xd0, 0x41, 0xd0, 0xa2, 0xc8, 0x81, 0xc0, 0xa1, 0xc0, 0xc2, 0xd0, 0xa2, 0xd0, 0xc3, 0xd0, 0x82, 0xc8, 0x62, 0xc8, 0xa3, 0xd8, 0x21, 0xc8, 0x41, 0xd0, 0x00, 0xc0, 0xc2, 0xd8, 0xc3, 0xd8, 0x25, 0xd9, 0x66, 0xc1, 0x65, 0xa1, 0xc3, 0x70, 0xa6, 0x71, 0x86, 0x69, 0x45, 0x69, 0x87, 0x79, 0x25, 0x71, 0xc7, 0x81, 0x65, 0x61, 0xa5, 0x69, 0x85, 0x91, 0x84, 0xc0, 0x01, 0xc0, 0x41, 0xb8, 0xc2, 0xc0, 0xc2, 0xc0, 0x62, 0xc0, 0xe4, 0xc8, 0xc3, 0xc0, 0x42, 0xc8, 0x62, 0xd8, 0x62, 0xe0, 0xa3, 0xd8, 0x62, 0xb8, 0xc2, 0xa8, 0x61, 0x80, 0x20, 0x60, 0x00, 0x58, 0x00, 0x78, 0x21, 0xa8, 0x05, 0xd1, 0x62, 0xb0, 0x82, 0xb0, 0xc3, 0xb0, 0xc3, 0xa0, 0x00, 0x78, 0x00, 0x68, 0x21, 0x50, 0x61, 0x30, 0xa1, 0x28, 0xa1, 0x30, 0x82, 0x48, 0x83, 0x68, 0x84, 0x78, 0xc5, 0x78, 0x05, 0x69, 0x25, 0x49, 0x44, 0x31, 0x44, 0x29, 0x24, 0x29, 0x25, 0x29, 0x45, 0x29, 0x65, 0x31, 0x86, 0x31, 0xa6, 0x39, 0x86, 0x41, 0x66, 0x39, 0x87, 0x41, 0xc8, 0x49, 0x2a, 0x4a, 0xcb, 0x52, 0x4d, 0x5b, 0x6e, 0x6b, 0x8f, 0x7b, 0xaf, 0x73, 0x6e, 0x6b, 0xec, 0x5a, 0x28, 0x3a, 0x65, 0x29, 0xc2, 0x10, 0xe3, 0x20, 0x24, 0x29, 0x44, 0x31, 0x45, 0x31, 0x45, 0x31, 0x65, 0x39, 0x44, 0x31, 0x03, 0x39, 0x62, 0x28, 0xa3, 0x40, 0x25, 0x51, 0x04, 0x51, 0x23, 0x61, 0xaa, 0xb2, 0x25, 0xb1, 0x02, 0xa8, 0xc4, 0xb0, 0x28, 0xb2, 0x48, 0x82, 0x44, 0x41, 0x86, 0x39, 0x45, 0x31, 0xc3, 0x28, 0xc3, 0x38, 0xe4, 0x40, 0xc4, 0x48, 0x00, 0x38, 0x92, 0xc4, 0xba, 0xfe, 0xb2, 0xdc, 0x00, 0x48, 0xa3, 0x78, 0x46, 0x69, 0x87, 0x59, 0x62, 0x18, 0x20, 0x10, 0x61, 0x28, 0x82, 0x40, 0x00, 0x40, 0x66, 0x71, 0x95, 0xe5, 0x38, 0xee, 0xae, 0xa3, 0xae, 0xbb, 0x13, 0xf5, 0xfb, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xfb, 0xfe, 0x4d, 0xb3, 0x6a, 0xca, 0x86, 0xd1, 0x85, 0xd9, 0x44, 0xc9, 0x44, 0xc9, 0x45, 0xc9, 0x45, 0xc9, 0x45, 0xc9, 0x25, 0xc9, 0x26, 0xd1, 0x26, 0xd1, 0x25, 0xd1, 0xe4, 0xc8, 0x04, 0xd1, 0x04, 0xc9, 0x44, 0xd1, 0x08, 0xf2, 0x45, 0xe1, 0x83, 0xd8, 0xa2, 0xc0, 0x61, 0xb0, 0x40, 0xb8, 0x20, 0xc0, 0x00, 0xc0, 0x20, 0xb8, 0x40, 0xb8, 0x41, 0xc8, 0xe5, 0xf0, 0xa4, 0xe8, 0x46, 0xe9, 0x04, 0xd1, 0x82, 0xc0, 0xa2, 0xc8, 0xa3, 0xc8, 0xe4, 0xb8, 0x05, 0xa1, 0x24, 0x79, 0x86, 0x71, 0x24, 0x61, 0xe4, 0x60, 0x25, 0x79, 0xe4, 0x70, 0x66, 0x71, 0xe3, 0x58, 0xe6, 0x71, 0x07, 0xa2, 0x26, 0xd9, 0x63, 0xd0, 0x82, 0xc0, 0x61, 0xb8, 0x20, 0xa8, 0x00, 0xa8, 0x41, 0xa8, 0x61, 0xa8, 0x00, 0xb8, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xc0, 0x21, 0xb0, 0x81, 0x90, 0x81, 0x70, 0x40, 0x68, 0x81, 0x90, 0xc3, 0xb8, 0x01, 0xb8, 0x84, 0xd0, 0x21, 0xb0, 0x61, 0xa8, 0x03, 0xb9, 0x85, 0xc9, 0x04, 0xb9, 0x02, 0x88, 0x42, 0x70, 0x41, 0x50, 0x60, 0x38, 0x60, 0x38, 0x20, 0x40, 0x01, 0x58, 0x02, 0x68, 0x43, 0x70, 0xa4, 0x68, 0xe4, 0x58, 0x44, 0x41, 0x85, 0x39, 0x65, 0x31, 0x65, 0x31, 0x65, 0x39, 0x65, 0x39, 0x65, 0x39, 0x65, 0x39, 0x65, 0x39, 0x86, 0x39, 0x86, 0x39, 0x86, 0x31, 0x87, 0x31, 0xa7, 0x31, 0xc8, 0x39, 0x2a, 0x42, 0x8c, 0x52, 0x0d, 0x63, 0x8f, 0x73, 0xf0, 0x7b, 0x11, 0x84, 0x31, 0x84, 0xaf, 0x73, 0x4d, 0x63, 0x8b, 0x52, 0xe8, 0x39, 0x86, 0x29, 0x25, 0x21, 0x04, 0x19, 0x04, 0x19, 0x65, 0x21, 0x65, 0x21, 0x24, 0x21, 0x81, 0x20, 0xc2, 0x30, 0xc1, 0x38, 0x07, 0x82, 0x4e, 0xe3, 0x06, 0xc1, 0xa9, 0xd9, 0x08, 0xc2, 0x0a, 0x9b, 0x27, 0x52, 0xc7, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0x46, 0x29, 0x05, 0x21, 0x25, 0x29, 0xe4, 0x20, 0xec, 0x6a, 0x14, 0xcd, 0xab, 0x92, 0xc4, 0x68, 0x66, 0x81, 0x67, 0x79, 0x68, 0x69, 0x65, 0x51, 0xe7, 0x69, 0x65, 0x71, 0x86, 0x91, 0x45, 0x91, 0xc2, 0x68, 0xca, 0x9a, 0x54, 0xed, 0x30, 0xd4, 0x66, 0xa9, 0x83, 0xa0, 0x25, 0x71, 0x3d, 0xff, 0xbf, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x7a, 0xfe, 0x29, 0xc2, 0x01, 0xb0, 0xe4, 0xc8, 0x85, 0xd1, 0x44, 0xc9, 0x24, 0xc9, 0x25, 0xc9, 0x25, 0xc9, 0x25, 0xc9, 0x25, 0xd1, 0x25, 0xd1, 0x25, 0xd1, 0x05, 0xd1, 0x04, 0xd1, 0xe3, 0xc8, 0x03, 0xd1, 0xa6, 0xe9, 0x04, 0xd9, 0x21, 0xc0, 0x20, 0xb0, 0x00, 0xa8, 0x00, 0xb8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc8, 0xa4, 0xe8, 0x63, 0xe0, 0xe4, 0xd0, 0x82, 0xb8, 0x40, 0xb8, 0x21, 0xb8, 0x21, 0xb8, 0x62, 0xa8, 0xe4, 0x98, 0x65, 0x89, 0xe7, 0x81, 0x86, 0x71, 0x66, 0x79, 0xa8, 0x89, 0x66, 0x81, 0xc7, 0x81, 0x65, 0x69, 0xa5, 0x71, 0xa6, 0x99, 0xe5, 0xd0, 0x83, 0xd0, 0xa2, 0xc8, 0xa2, 0xc0, 0x81, 0xb8, 0x00, 0xb0, 0x21, 0xa8, 0x82, 0xb0, 0x62, 0xc0, 0x00, 0xc8, 0x20, 0xd0, 0x41, 0xd0, 0x21, 0xb8, 0x40, 0xa0, 0xad, 0xdb, 0x68, 0xaa, 0x00, 0x78, 0x83, 0xa8, 0x01, 0xa8, 0x43, 0xb8, 0x01, 0xa0, 0x21, 0xa0, 0x21, 0xa0, 0xe4, 0xb8, 0xc3, 0xa8, 0x42, 0x88, 0x22, 0x80, 0x01, 0x78, 0x01, 0x68, 0x21, 0x58, 0x81, 0x40, 0xa1, 0x38, 0x81, 0x30, 0x61, 0x40, 0x42, 0x48, 0x22, 0x40, 0x61, 0x30, 0xa2, 0x20, 0xe4, 0x28, 0x04, 0x31, 0x05, 0x31, 0x25, 0x39, 0x45, 0x39, 0x65, 0x39, 0x65, 0x39, 0x45, 0x39, 0x65, 0x31, 0x66, 0x31, 0x66, 0x31, 0x66, 0x29, 0x87, 0x31, 0x87, 0x29, 0x66, 0x29, 0xa7, 0x31, 0xe8, 0x39, 0x6a, 0x4a, 0xcb, 0x52, 0xec, 0x5a, 0x4e, 0x6b, 0xf0, 0x7b, 0xb3, 0x94, 0x14, 0x9d, 0xd3, 0x94, 0x72, 0x8c, 0x11, 0x84, 0x4d, 0x6b, 0x66, 0x29, 0x04, 0x11, 0xa6, 0x31, 0x24, 0x31, 0x24, 0x39, 0x24, 0x49, 0x00, 0x40, 0x36, 0xfd, 0xcd, 0xf2, 0xa5, 0xc0, 0x66, 0xb1, 0xe6, 0x89, 0xe7, 0x51, 0x65, 0x21, 0x45, 0x29, 0xc7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0x29, 0x4a, 0xe8, 0x41, 0xe4, 0x28, 0x00, 0x00, 0xa3, 0x48, 0xa7, 0x71, 0xe9, 0x81, 0x0d, 0x9b, 0xcc, 0x92, 0x09, 0x82, 0x8a, 0x9a, 0x49, 0xb2, 0x8a, 0xca, 0xc7, 0xb1, 0x49, 0xb2, 0x6a, 0xba, 0xcc, 0xca, 0xc8, 0xb9, 0x64, 0xb0, 0x63, 0xb0, 0x8a, 0xb2, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x96, 0xfd, 0xab, 0xd2, 0x01, 0xb8, 0x86, 0xe1, 0x03, 0xc9, 0x24, 0xc9, 0x24, 0xc9, 0x24, 0xc9, 0x25, 0xc9, 0x25, 0xc9, 0x25, 0xc9, 0x05, 0xd1, 0xe4, 0xc8, 0x04, 0xd1, 0x45, 0xd9, 0x04, 0xd1, 0xe3, 0xc8, 0x24, 0xd9, 0x61, 0xc0, 0x00, 0xb8, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xb8, 0x01, 0xc8, 0x01, 0xd0, 0x01, 0xc8, 0x00, 0xc0, 0x00, 0xc0, 0x22, 0xd8, 0x01, 0xc8, 0x41, 0xc0, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x22, 0xb0, 0x63, 0xa8, 0xc4, 0x98, 0x45, 0x81, 0x86, 0x79, 0x45, 0x69, 0x46, 0x79, 0x66, 0x89, 0x45, 0x81, 0x45, 0x79, 0x03, 0x69, 0xa5, 0x71, 0x44, 0x99, 0x43, 0xc0, 0x01, 0xc8, 0x40, 0xc0, 0x81, 0xc0, 0x81, 0xc0, 0x21, 0xb8, 0x20, 0xa8, 0x62, 0xb0, 0x62, 0xc8, 0x21, 0xc8, 0x21, 0xc8, 0x41, 0xd0, 0x01, 0xc0, 0x00, 0xb0, 0x54, 0xfd, 0x6c, 0xdb, 0x00, 0x70, 0x00, 0x90, 0x00, 0x98, 0x01, 0xa8, 0x01, 0xa0, 0x01, 0xa0, 0x00, 0x98, 0x01, 0xa8, 0x00, 0x90, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x68, 0x20, 0x58, 0x61, 0x40, 0xa1, 0x38, 0xa1, 0x38, 0x61, 0x40, 0x41, 0x48, 0x21, 0x48, 0x22, 0x40, 0x42, 0x40, 0x21, 0x28, 0x42, 0x28, 0x63, 0x30, 0xa3, 0x30, 0xc4, 0x38, 0x04, 0x41, 0x24, 0x41, 0x24, 0x39, 0x45, 0x41, 0x66, 0x39, 0x66, 0x39, 0x67, 0x39, 0x87, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x86, 0x29, 0x86, 0x29, 0x86, 0x31, 0x86, 0x31, 0xa7, 0x31, 0xc8, 0x39, 0xe8, 0x41, 0x49, 0x4a, 0xcc, 0x5a, 0x6e, 0x73, 0x11, 0x84, 0x72, 0x94, 0x92, 0x9c, 0x08, 0x42, 0x04, 0x11, 0x66, 0x29, 0xe4, 0x20, 0xa7, 0x41, 0x2d, 0x7b, 0xc7, 0x59, 0xf5, 0xfc, 0x53, 0xfc, 0x00, 0xa8, 0x08, 0xd2, 0xc5, 0x99, 0x86, 0x49, 0x86, 0x29, 0x25, 0x21, 0x45, 0x29, 0x86, 0x31, 0xe8, 0x41, 0x6a, 0x52, 0x49, 0x52, 0xe8, 0x49, 0xe4, 0x30, 0x25, 0x41, 0x66, 0x49, 0xab, 0x7a, 0x36, 0xd5, 0x39, 0xf6, 0x2e, 0xbb, 0x00, 0x78, 0x02, 0x98, 0x21, 0x98, 0x00, 0x80, 0x82, 0x90, 0xa8, 0xc1, 0xe6, 0xc0, 0xc5, 0xc8, 0x47, 0xd9, 0x63, 0xc8, 0x8e, 0xf3, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xd7, 0xdd, 0x10, 0xcc, 0xcc, 0xd2, 0x22, 0xb8, 0x25, 0xd1, 0x65, 0xd9, 0x44, 0xd1, 0x44, 0xc9, 0x45, 0xc9, 0x25, 0xc9, 0x25, 0xc9, 0x25, 0xd1, 0x25, 0xd1, 0x04, 0xc9, 0x25, 0xd1, 0x24, 0xd1, 0xc3, 0xc8, 0xe3, 0xd0, 0x44, 0xd9, 0x82, 0xc8, 0x21, 0xb8, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xc0, 0x01, 0xc8, 0x21, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x22, 0xd0, 0x01, 0xc8, 0x82, 0xc0, 0x20, 0xa8, 0x00, 0x98, 0x00, 0xa8, 0x22, 0xb0, 0x83, 0xa8, 0xc4, 0x90, 0x24, 0x79, 0x45, 0x71, 0x65, 0x71, 0x45, 0x79, 0x45, 0x81, 0x25, 0x81, 0x04, 0x79, 0xe2, 0x68, 0xa4, 0x79, 0x24, 0x91, 0x22, 0xc0, 0x00, 0xc8, 0x00, 0xb8, 0x20, 0xb8, 0x20, 0xb8, 0x00, 0xb8, 0x00, 0xa0, 0x00, 0xa0, 0x01, 0xb8, 0x00, 0xc0, 0x00, 0xb8, 0x01, 0xc0, 0x00, 0xb8, 0x00, 0xa0, 0xf3, 0xfc, 0x4c, 0xdb, 0x83, 0x98, 0xc5, 0xa8, 0x27, 0xb9, 0x07, 0xb9, 0x68, 0xb9, 0x68, 0xb9, 0xe6, 0xb0, 0x68, 0xc9, 0x02, 0x98, 0x00, 0x68, 0x20, 0x70, 0x40, 0x68, 0x40, 0x60, 0x20, 0x50, 0x00, 0x40, 0x00, 0x40, 0x20, 0x48, 0x20, 0x48, 0x01, 0x48, 0x02, 0x50, 0x22, 0x50, 0x22, 0x50, 0x22, 0x40, 0x22, 0x38, 0x01, 0x38, 0x01, 0x38, 0x21, 0x38, 0x21, 0x38, 0x41, 0x38, 0x62, 0x38, 0xa3, 0x38, 0xc3, 0x38, 0xc4, 0x38, 0xe4, 0x38, 0x05, 0x39, 0x25, 0x31, 0x24, 0x29, 0x45, 0x31, 0x65, 0x31, 0x66, 0x31, 0x86, 0x39, 0x87, 0x39, 0x87, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0x67, 0x31, 0x47, 0x31, 0x67, 0x31, 0x87, 0x39, 0x08, 0x52, 0x45, 0x29, 0x65, 0x19, 0x45, 0x19, 0x05, 0x19, 0x6a, 0x52, 0x31, 0x94, 0xf0, 0x9b, 0x6f, 0xcb, 0x70, 0xeb, 0x00, 0xb0, 0x86, 0xc9, 0x84, 0xa1, 0x45, 0x49, 0xe8, 0x39, 0xa7, 0x31, 0x25, 0x29, 0x24, 0x29, 0x65, 0x31, 0x65, 0x31, 0x6a, 0x5a, 0x0c, 0x6b, 0x4e, 0x73, 0x09, 0x4a, 0xab, 0x62, 0xe9, 0x51, 0xb7, 0xd5, 0xbe, 0xff, 0xf0, 0xe3, 0x00, 0x88, 0x42, 0xa0, 0x21, 0x90, 0x41, 0x90, 0x00, 0x90, 0x83, 0xa0, 0x64, 0xb8, 0x64, 0xb8, 0xe6, 0xd0, 0xc4, 0xd0, 0x29, 0xca, 0x39, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x79, 0xee, 0x69, 0x8a, 0x8b, 0xc2, 0x66, 0xc9, 0x25, 0xd9, 0xc3, 0xc8, 0x24, 0xd1, 0x44, 0xc9, 0x44, 0xc9, 0x45, 0xc9, 0x45, 0xc9, 0x25, 0xc9, 0x25, 0xd1, 0x66, 0xd9, 0x45, 0xd9, 0xe3, 0xd0, 0x61, 0xc0, 0x82, 0xc8, 0x03, 0xd9, 0x41, 0xc8, 0x00, 0xb8, 0x00, 0x98, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xa8, 0x21, 0xb8, 0x41, 0xb0, 0x00, 0xa8, 0x00, 0xb0, 0x42, 0xc8, 0x21, 0xc8, 0x41, 0xc0, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x01, 0xa0, 0x63, 0xa0, 0xc4, 0x90, 0x04, 0x79, 0x04, 0x61, 0x24, 0x69, 0x04, 0x71, 0xe4, 0x78, 0xc4, 0x80, 0xa2, 0x70, 0xa1, 0x60, 0x43, 0x71, 0xe3, 0x88, 0x22, 0xc0, 0x21, 0xc8, 0x40, 0xc0, 0x20, 0xb8, 0x20, 0xb8, 0x20, 0xc0, 0x00, 0xb0, 0x00, 0xa0, 0x00, 0xb0, 0x21, 0xc0, 0x40, 0xb8, 0x21, 0xb0, 0x00, 0xa0, 0x00, 0x88, 0x74, 0xfd, 0x73, 0xf5, 0x77, 0xfe, 0x3b, 0xff, 0x5c, 0xff, 0x1b, 0xff, 0xfb, 0xfe, 0xdb, 0xfe, 0xba, 0xfe, 0xdb, 0xfe, 0x91, 0xdc, 0x00, 0x58, 0x60, 0x70, 0x61, 0x78, 0x61, 0x70, 0x40, 0x70, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x58, 0x01, 0x58, 0x01, 0x50, 0x00, 0x40, 0x22, 0x58, 0x01, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x01, 0x48, 0x21, 0x48, 0x21, 0x40, 0x42, 0x40, 0x62, 0x40, 0xa3, 0x40, 0xc3, 0x38, 0xe3, 0x38, 0xe4, 0x38, 0x04, 0x39, 0x04, 0x39, 0x05, 0x39, 0x05, 0x31, 0x25, 0x31, 0x46, 0x31, 0x66, 0x31, 0x67, 0x31, 0xa8, 0x39, 0xc8, 0x41, 0x45, 0x41, 0x65, 0x31, 0xa6, 0x21, 0xc7, 0x29, 0x67, 0x21, 0x67, 0x29, 0x09, 0x42, 0x4a, 0x62, 0x46, 0x71, 0x67, 0xa9, 0xa4, 0xb8, 0x03, 0xc1, 0x47, 0xc2, 0x24, 0x59, 0x87, 0x31, 0x87, 0x39, 0x86, 0x39, 0x65, 0x31, 0x45, 0x31, 0x45, 0x31, 0x65, 0x39, 0xab, 0x62, 0x31, 0x8c, 0x01, 0x08, 0xb0, 0x73, 0x36, 0xa5, 0xcf, 0x83, 0x6d, 0x93, 0x45, 0x89, 0x00, 0x78, 0x00, 0x90, 0x00, 0x80, 0x00, 0x80, 0x00, 0x98, 0x00, 0x90, 0x22, 0xb0, 0x63, 0xb0, 0x04, 0xb9, 0xa2, 0xb8, 0x04, 0xa1, 0x34, 0xe5, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xf8, 0xfd, 0xcb, 0xc2, 0xa4, 0xb8, 0x05, 0xd1, 0x45, 0xd9, 0x24, 0xd1, 0x44, 0xc9, 0x44, 0xc9, 0x45, 0xc9, 0x45, 0xc9, 0x25, 0xc9, 0x25, 0xc9, 0x04, 0xc9, 0x04, 0xc9, 0xc3, 0xc8, 0x41, 0xb8, 0x81, 0xc8, 0xe3, 0xd8, 0x21, 0xc8, 0x00, 0xb8, 0x00, 0x98, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x21, 0x98, 0x41, 0x90, 0x00, 0x90, 0x00, 0xa0, 0x42, 0xc8, 0x22, 0xc8, 0x41, 0xc0, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x90, 0x22, 0x90, 0xc4, 0x88, 0x45, 0x71, 0x45, 0x61, 0x65, 0x69, 0x45, 0x79, 0x04, 0x79, 0x04, 0x79, 0xc3, 0x70, 0xe2, 0x68, 0x84, 0x71, 0xe3, 0x88, 0x01, 0xb8, 0x21, 0xc0, 0x40, 0xb8, 0x20, 0xb8, 0x20, 0xb8, 0x00, 0xc0, 0x00, 0xb0, 0x00, 0xa0, 0x00, 0xa8, 0x21, 0xb8, 0x20, 0xb0, 0x41, 0xb0, 0xc3, 0xb8, 0x61, 0x98, 0xea, 0xc2, 0x4f, 0xc4, 0x5b, 0xff, 0x9c, 0xff, 0xbd, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xd2, 0xcc, 0x00, 0x58, 0x00, 0x78, 0x00, 0x80, 0x00, 0x88, 0x01, 0x98, 0x02, 0x98, 0x02, 0x90, 0xa3, 0x88, 0x24, 0x71, 0x08, 0x7a, 0xe7, 0x71, 0x45, 0x69, 0x83, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x78, 0x41, 0x80, 0xa3, 0x88, 0x82, 0x80, 0x61, 0x70, 0x00, 0x60, 0x00, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x40, 0x00, 0x40, 0x41, 0x40, 0x82, 0x40, 0xc3, 0x48, 0xe4, 0x40, 0xe4, 0x40, 0x05, 0x39, 0x26, 0x39, 0x25, 0x31, 0x05, 0x29, 0x26, 0x29, 0x25, 0x31, 0x25, 0x41, 0x65, 0x39, 0x44, 0x19, 0x86, 0x21, 0xc8, 0x29, 0x67, 0x29, 0xc8, 0x39, 0x86, 0x39, 0xc8, 0x79, 0x87, 0xa1, 0x45, 0xb9, 0x23, 0xc1, 0xe6, 0xc1, 0x66, 0x71, 0x05, 0x31, 0x45, 0x39, 0xa7, 0x41, 0x86, 0x39, 0x65, 0x31, 0xa6, 0x41, 0xa7, 0x41, 0xe8, 0x49, 0x00, 0x00, 0x56, 0xad, 0xff, 0xff, 0x36, 0x9d, 0xf3, 0xac, 0x2b, 0x9b, 0x40, 0x70, 0x20, 0x98, 0x81, 0xa8, 0x02, 0xb1, 0xe2, 0xb0, 0xa3, 0xb8, 0x25, 0xd1, 0x66, 0xc9, 0x07, 0xca, 0x27, 0xca, 0xc2, 0xb0, 0x07, 0xd2, 0x10, 0xcc, 0x5c, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xbe, 0xff, 0x75, 0xfd, 0x00, 0x98, 0x66, 0xd9, 0x25, 0xd1, 0x45, 0xd1, 0x65, 0xc9, 0x65, 0xc9, 0x65, 0xc9, 0x45, 0xc9, 0x25, 0xc9, 0x25, 0xc9, 0x45, 0xc9, 0xa3, 0xc0, 0x61, 0xb8, 0x40, 0xb8, 0xa2, 0xc8, 0xc2, 0xd0, 0x42, 0xc8, 0x00, 0xb0, 0x61, 0xa8, 0x20, 0x80, 0x20, 0x78, 0x60, 0x80, 0x00, 0x68, 0x00, 0x68, 0x40, 0x78, 0x00, 0x88, 0x41, 0xb8, 0x42, 0xd0, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0x90, 0x00, 0x88, 0x00, 0x88, 0x01, 0x80, 0xa3, 0x78, 0x45, 0x69, 0x65, 0x61, 0x65, 0x59, 0x45, 0x69, 0x04, 0x71, 0xa3, 0x68, 0xc3, 0x68, 0x23, 0x61, 0x85, 0x69, 0xc3, 0x78, 0x02, 0xb0, 0x45, 0xe1, 0x85, 0xe1, 0x80, 0xb8, 0x00, 0xb8, 0x21, 0xc8, 0x62, 0xc0, 0x83, 0xc0, 0x21, 0xb8, 0xe3, 0xb8, 0x04, 0xb1, 0x41, 0xb0, 0x42, 0xc8, 0x63, 0xb8, 0x00, 0x90, 0x8e, 0xbb, 0x3c, 0xff, 0x7d, 0xff, 0x5d, 0xff, 0xde, 0xff, 0xbe, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0x14, 0xdd, 0x00, 0x88, 0x00, 0xa0, 0x01, 0xa8, 0x02, 0xb8, 0x03, 0xc8, 0x03, 0xd0, 0x00, 0xb8, 0x31, 0xec, 0x94, 0xe5, 0x5a, 0xff, 0xb9, 0xfe, 0x55, 0xe5, 0xab, 0xba, 0x63, 0x98, 0x01, 0x98, 0x21, 0x98, 0x00, 0x98, 0x21, 0xa0, 0x00, 0x98, 0x00, 0xa0, 0x00, 0x98, 0x20, 0x98, 0x41, 0x98, 0x61, 0x90, 0x41, 0x88, 0x41, 0x88, 0x21, 0x78, 0x20, 0x68, 0x00, 0x60, 0x00, 0x50, 0x00, 0x50, 0x00, 0x48, 0x00, 0x40, 0x41, 0x40, 0x62, 0x38, 0xa3, 0x38, 0xe4, 0x30, 0x05, 0x31, 0x25, 0x31, 0x25, 0x39, 0x82, 0x40, 0x03, 0x39, 0x24, 0x19, 0x24, 0x19, 0x46, 0x21, 0x06, 0x29, 0xc4, 0x28, 0x86, 0x49, 0x41, 0x40, 0x04, 0x89, 0xcf, 0xfb, 0x4c, 0xe3, 0xe6, 0xc9, 0xe8, 0x91, 0x63, 0x38, 0x66, 0x49, 0x24, 0x39, 0x65, 0x31, 0xc7, 0x39, 0x65, 0x31, 0xc7, 0x41, 0xc8, 0x49, 0x4a, 0x5a, 0xf9, 0xcd, 0x1a, 0xce, 0x9b, 0xd6, 0x96, 0xdd, 0xe7, 0x91, 0xa3, 0xa0, 0x81, 0xa8, 0x23, 0xc1, 0x85, 0xd1, 0xa1, 0xb8, 0xc3, 0xd0, 0x82, 0xc0, 0x48, 0xda, 0x0e, 0xfc, 0x8c, 0xe3, 0x27, 0xda, 0x07, 0xda, 0xc7, 0xa1, 0x75, 0xdd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x17, 0xfe, 0x00, 0x98, 0x46, 0xd1, 0x45, 0xd1, 0x45, 0xc9, 0x65, 0xc9, 0x65, 0xc9, 0x65, 0xc9, 0x65, 0xc1, 0x45, 0xc1, 0x25, 0xc1, 0x04, 0xc1, 0xa3, 0xb8, 0x62, 0xb8, 0x20, 0xb8, 0x61, 0xc0, 0x82, 0xc8, 0x63, 0xd8, 0x21, 0xb0, 0x00, 0x88, 0x81, 0x90, 0x00, 0x68, 0x60, 0x70, 0x20, 0x58, 0x20, 0x58, 0x20, 0x60, 0x20, 0x80, 0x41, 0xb0, 0x21, 0xc8, 0x00, 0xc0, 0x00, 0xa8, 0x00, 0x88, 0x00, 0x80, 0x00, 0x80, 0x01, 0x78, 0x62, 0x68, 0xe3, 0x50, 0x65, 0x51, 0xa6, 0x59, 0x66, 0x61, 0x05, 0x61, 0xe4, 0x60, 0x04, 0x59, 0x64, 0x59, 0xc6, 0x61, 0xc3, 0x68, 0x01, 0x98, 0x25, 0xc9, 0x85, 0xd1, 0xa1, 0xb8, 0x00, 0xb0, 0x62, 0xd0, 0x25, 0xe1, 0x83, 0xc0, 0x62, 0xc0, 0x08, 0xf2, 0x48, 0xe2, 0x65, 0xd9, 0x46, 0xe1, 0xc4, 0xc8, 0x22, 0xa0, 0x8e, 0xbb, 0x1c, 0xff, 0x3c, 0xff, 0x3c, 0xef, 0x9d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x9d, 0xf7, 0xfe, 0xff, 0x34, 0xd5, 0x00, 0x88, 0x01, 0xc0, 0x02, 0xd0, 0x03, 0xd8, 0x24, 0xd8, 0x24, 0xc8, 0x0c, 0xdb, 0x58, 0xfe, 0x37, 0xfe, 0xd1, 0xcc, 0xb1, 0xcc, 0xb7, 0xfd, 0xd4, 0xfc, 0xa7, 0xc1, 0x00, 0xa8, 0x21, 0xb0, 0x21, 0xb0, 0x21, 0xb8, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0x98, 0x21, 0x98, 0x42, 0x98, 0x22, 0x90, 0x01, 0x80, 0x01, 0x78, 0x00, 0x68, 0x00, 0x58, 0x00, 0x48, 0x00, 0x40, 0x00, 0x38, 0x20, 0x30, 0x41, 0x28, 0x82, 0x30, 0xa2, 0x38, 0xa3, 0x50, 0xa2, 0x38, 0x03, 0x29, 0xe3, 0x28, 0x83, 0x20, 0x63, 0x30, 0xe4, 0x40, 0xa3, 0x40, 0x41, 0x48, 0x65, 0x99, 0x0b, 0xcb, 0x70, 0xfc, 0x23, 0xc9, 0x49, 0xb2, 0x05, 0x69, 0x41, 0x30, 0x24, 0x41, 0xc6, 0x41, 0xc2, 0x18, 0xa7, 0x39, 0x66, 0x39, 0xab, 0x6a, 0xb4, 0xb4, 0x8f, 0x93, 0x11, 0xa4, 0x39, 0xe6, 0xf0, 0xbb, 0x00, 0xa0, 0x66, 0xd1, 0xa2, 0xc0, 0xa2, 0xc8, 0x81, 0xc8, 0x00, 0xc8, 0x42, 0xd8, 0x21, 0xb8, 0xaa, 0xe2, 0x2e, 0xfc, 0x87, 0xca, 0xe2, 0xc0, 0xc7, 0xd9, 0xcb, 0xe2, 0x92, 0xcc, 0x9d, 0xff, 0xde, 0xf7, 0xff, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xda, 0xfe, 0x00, 0xa0, 0x25, 0xc1, 0x86, 0xd1, 0x45, 0xc9, 0x65, 0xc9, 0x65, 0xc1, 0x45, 0xc1, 0x45, 0xc1, 0x25, 0xb9, 0x25, 0xb9, 0xe4, 0xb8, 0xc3, 0xb8, 0x82, 0xb8, 0x20, 0xb0, 0x41, 0xc0, 0x62, 0xc8, 0x01, 0xc0, 0xa4, 0xc8, 0x41, 0x98, 0x24, 0x99, 0x44, 0x89, 0x00, 0x58, 0x20, 0x60, 0x00, 0x50, 0x00, 0x58, 0xa2, 0x90, 0xe3, 0xc0, 0x62, 0xc8, 0x00, 0xc0, 0x00, 0x98, 0x20, 0x88, 0x20, 0x80, 0x01, 0x78, 0x21, 0x70, 0x62, 0x58, 0xa2, 0x40, 0x24, 0x39, 0x65, 0x41, 0x25, 0x49, 0xe4, 0x48, 0xc3, 0x48, 0xe3, 0x48, 0x44, 0x49, 0xa5, 0x49, 0x04, 0x61, 0x01, 0x88, 0x20, 0x98, 0x41, 0x98, 0x20, 0xa0, 0x61, 0xb8, 0x21, 0xc0, 0x83, 0xd0, 0x00, 0xb0, 0x22, 0xb8, 0x25, 0xc1, 0x24, 0xb1, 0xe3, 0xb8, 0xe4, 0xc0, 0x42, 0xb0, 0x00, 0x90, 0x6e, 0xbb, 0x1d, 0xff, 0x9e, 0xff, 0x9e, 0xef, 0xbe, 0xef, 0x7e, 0xef, 0x5d, 0xef, 0xbe, 0xff, 0xff, 0xff, 0x95, 0xd5, 0x00, 0x88, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xd0, 0x63, 0xc8, 0xc7, 0xc1, 0xb1, 0xec, 0x70, 0xe4, 0xe7, 0xa1, 0x00, 0x90, 0x01, 0xa0, 0xa7, 0xb1, 0xf0, 0xfb, 0x6a, 0xe2, 0x00, 0xa8, 0x41, 0xb8, 0x41, 0xc0, 0x21, 0xc0, 0x20, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa0, 0x01, 0xa0, 0x21, 0x98, 0x42, 0x90, 0x42, 0x88, 0x21, 0x70, 0x20, 0x60, 0x00, 0x58, 0x00, 0x48, 0x00, 0x40, 0x20, 0x40, 0x21, 0x48, 0x41, 0x58, 0x00, 0x38, 0x60, 0x20, 0x40, 0x28, 0x00, 0x30, 0x00, 0x40, 0x21, 0x48, 0x20, 0x40, 0xa1, 0x68, 0xa2, 0x78, 0x44, 0xa9, 0x28, 0xda, 0x60, 0xb0, 0x29, 0xca, 0x87, 0x99, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x38, 0xed, 0x8a, 0xd0, 0xb3, 0x52, 0xc4, 0xaf, 0xb3, 0x09, 0xba, 0xe6, 0xd8, 0x05, 0xe1, 0x01, 0xc8, 0x21, 0xd0, 0x20, 0xd8, 0x00, 0xe0, 0x21, 0xd8, 0x21, 0xc0, 0x48, 0xea, 0xeb, 0xea, 0x64, 0xc1, 0x40, 0xc0, 0x21, 0xc0, 0x29, 0xd2, 0xf0, 0xeb, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdd, 0xff, 0x5c, 0xff, 0x05, 0xb1, 0xe4, 0xb0, 0x86, 0xc9, 0x45, 0xc1, 0x45, 0xc1, 0x65, 0xc1, 0x45, 0xb9, 0x45, 0xb9, 0x25, 0xb9, 0x25, 0xb9, 0xe4, 0xb8, 0xe4, 0xb8, 0xc3, 0xc0, 0x41, 0xb8, 0x62, 0xc0, 0x62, 0xc8, 0x00, 0xb8, 0xc8, 0xe1, 0x65, 0xb9, 0x65, 0xa1, 0x86, 0xa1, 0x00, 0x68, 0x00, 0x60, 0x20, 0x68, 0x00, 0x68, 0xa2, 0x98, 0xe4, 0xc8, 0x62, 0xc8, 0x20, 0xb8, 0x00, 0x90, 0x40, 0x80, 0x20, 0x78, 0x00, 0x70, 0x21, 0x60, 0x62, 0x50, 0x82, 0x30, 0xc3, 0x20, 0x04, 0x29, 0xe4, 0x30, 0xc4, 0x38, 0xc3, 0x38, 0xc3, 0x30, 0x03, 0x29, 0xe3, 0x20, 0xe4, 0x50, 0x43, 0x80, 0x21, 0x88, 0x00, 0x80, 0x00, 0x88, 0x40, 0xb0, 0x22, 0xc8, 0x01, 0xc0, 0x00, 0xb0, 0x42, 0xb8, 0x00, 0x90, 0x00, 0x70, 0x82, 0xa0, 0x04, 0xc1, 0xc4, 0xc0, 0x02, 0xa0, 0x4e, 0xbb, 0xfd, 0xfe, 0x7e, 0xff, 0x9e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x5e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x75, 0xe5, 0x00, 0x80, 0x00, 0xa0, 0x62, 0xb0, 0x62, 0xa0, 0x20, 0x88, 0x44, 0xa1, 0xaa, 0xca, 0xa6, 0xb1, 0x62, 0xa8, 0x83, 0xc0, 0x26, 0xd1, 0x63, 0xb0, 0x87, 0xc9, 0x49, 0xe2, 0x00, 0x98, 0x00, 0xa8, 0x20, 0xb0, 0x20, 0xb8, 0x21, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x01, 0xa0, 0x21, 0x98, 0x41, 0x98, 0x41, 0x88, 0x41, 0x80, 0x41, 0x78, 0x20, 0x70, 0x20, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x50, 0x00, 0x30, 0x00, 0x48, 0x82, 0x70, 0x22, 0x80, 0x20, 0x78, 0x41, 0x78, 0x00, 0x70, 0x00, 0x70, 0xe3, 0xb8, 0x61, 0xb8, 0x41, 0xb8, 0x82, 0xb0, 0x8a, 0xd2, 0x96, 0xfd, 0xd6, 0xed, 0x34, 0xb5, 0xda, 0xd6, 0x9a, 0xce, 0xfd, 0xee, 0x52, 0xac, 0x00, 0x30, 0x4a, 0x92, 0x0c, 0xc3, 0x69, 0xb2, 0x2d, 0xfb, 0x67, 0xe9, 0x02, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xe8, 0x00, 0xe8, 0x01, 0xd8, 0x00, 0xb8, 0x62, 0xc0, 0x82, 0xc0, 0x20, 0xc0, 0x62, 0xd8, 0x62, 0xd8, 0x00, 0xb0, 0xef, 0xe3, 0xba, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xfe, 0xff, 0x9d, 0xff, 0xec, 0xca, 0xa3, 0xa8, 0x86, 0xc9, 0x66, 0xc1, 0x66, 0xc1, 0x66, 0xc1, 0x66, 0xb9, 0x66, 0xb9, 0x45, 0xb1, 0x25, 0xb1, 0x25, 0xb9, 0x05, 0xb9, 0xe4, 0xc0, 0x83, 0xb8, 0x83, 0xc8, 0x83, 0xc8, 0x42, 0xb8, 0x21, 0xa0, 0x82, 0x90, 0xe3, 0x90, 0x04, 0x99, 0xe9, 0xc1, 0x05, 0xa1, 0x62, 0x90, 0x00, 0x80, 0x00, 0x98, 0x42, 0xb8, 0x21, 0xb8, 0x20, 0xa8, 0x20, 0x90, 0x40, 0x78, 0x20, 0x70, 0x00, 0x68, 0x21, 0x60, 0x62, 0x48, 0xa2, 0x28, 0xe3, 0x18, 0x04, 0x19, 0xe4, 0x28, 0xe4, 0x30, 0x04, 0x29, 0x04, 0x21, 0x03, 0x19, 0x04, 0x19, 0xc4, 0x38, 0x01, 0x60, 0x00, 0x78, 0x40, 0x80, 0x60, 0x98, 0xa2, 0xb8, 0x21, 0xc8, 0x02, 0xc8, 0x01, 0xb8, 0x22, 0xb8, 0x00, 0xa0, 0x00, 0x78, 0xa1, 0x88, 0x44, 0xa9, 0x25, 0xb9, 0x23, 0x98, 0x4e, 0xbb, 0xfd, 0xfe, 0x7e, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x5f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0x75, 0xe5, 0x00, 0x70, 0x00, 0x88, 0x40, 0x88, 0x40, 0x80, 0x00, 0x70, 0xa2, 0x90, 0x45, 0xb9, 0x04, 0xc1, 0xc8, 0xe1, 0xe4, 0xc8, 0x05, 0xd1, 0xa3, 0xc0, 0xa3, 0xb8, 0x66, 0xc1, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x01, 0xc0, 0x01, 0xc0, 0x21, 0xc8, 0x21, 0xc8, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x20, 0x98, 0x20, 0x90, 0x00, 0x90, 0x01, 0x88, 0x00, 0x80, 0x21, 0x70, 0x00, 0x50, 0x40, 0x70, 0x25, 0xa9, 0xa4, 0xb8, 0x83, 0xb0, 0x04, 0xb1, 0x40, 0x88, 0x81, 0xa0, 0xc3, 0xb8, 0x45, 0xe1, 0x82, 0xc8, 0x00, 0xb0, 0x04, 0xb9, 0xf3, 0xf4, 0x9d, 0xff, 0xde, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x90, 0x83, 0x0e, 0x8b, 0x84, 0x60, 0x83, 0x78, 0x00, 0x80, 0x24, 0xa9, 0xc8, 0xe1, 0xa4, 0xc8, 0x00, 0xc0, 0x82, 0xe0, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xd8, 0x82, 0xd0, 0x41, 0xc0, 0x21, 0xc0, 0x22, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x62, 0xd8, 0x42, 0xc8, 0x02, 0xa8, 0x58, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xfe, 0xff, 0x9d, 0xff, 0x30, 0xe4, 0x83, 0xa0, 0xa7, 0xc9, 0xa7, 0xc1, 0xa7, 0xc1, 0xa7, 0xc1, 0x87, 0xc1, 0x86, 0xb9, 0x66, 0xb9, 0x46, 0xb9, 0x46, 0xb9, 0x05, 0xb9, 0x05, 0xc1, 0xa3, 0xb8, 0xc4, 0xc8, 0x83, 0xc8, 0x41, 0xb0, 0x00, 0x88, 0x41, 0x88, 0x41, 0x80, 0xe4, 0x98, 0x4b, 0xda, 0x88, 0xc9, 0x22, 0xa0, 0x00, 0x90, 0x00, 0x90, 0x42, 0xb8, 0x61, 0xb8, 0x00, 0x98, 0x60, 0x88, 0x81, 0x80, 0x41, 0x70, 0x21, 0x68, 0x82, 0x60, 0xc3, 0x48, 0x24, 0x29, 0x44, 0x19, 0x45, 0x19, 0x25, 0x21, 0x25, 0x29, 0x25, 0x29, 0x45, 0x21, 0x65, 0x19, 0x65, 0x19, 0x26, 0x41, 0x23, 0x60, 0x01, 0x68, 0x61, 0x80, 0x03, 0xa1, 0xa6, 0xd1, 0x42, 0xc8, 0x02, 0xc0, 0x42, 0xb8, 0x21, 0xb0, 0x62, 0xb0, 0x81, 0x90, 0x00, 0x60, 0x40, 0x50, 0x20, 0x68, 0x00, 0x58, 0x6e, 0xa3, 0x5d, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xdf, 0xef, 0x5e, 0xff, 0x5e, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xd6, 0xdd, 0x00, 0x68, 0x81, 0x88, 0x41, 0x80, 0x00, 0x80, 0x00, 0x90, 0x21, 0xa8, 0x63, 0xb0, 0x82, 0xb8, 0xc7, 0xd1, 0x48, 0xda, 0x49, 0xda, 0x20, 0xa0, 0x41, 0xa0, 0x82, 0x90, 0x00, 0x80, 0x20, 0x88, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xb8, 0x00, 0xb8, 0x01, 0xc0, 0x21, 0xc0, 0x21, 0xc0, 0x21, 0xc0, 0x21, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x20, 0xc8, 0x41, 0xc8, 0x41, 0xc0, 0x21, 0xc0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x21, 0xa8, 0x22, 0xa0, 0x62, 0x88, 0x60, 0x70, 0x20, 0x80, 0x62, 0xa8, 0x22, 0xc0, 0x01, 0xb8, 0x41, 0xb0, 0x40, 0xa0, 0x81, 0xa8, 0x82, 0xb8, 0x83, 0xd0, 0x62, 0xd0, 0x82, 0xd8, 0x00, 0xb0, 0x69, 0xba, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xe7, 0x35, 0xad, 0xe6, 0x40, 0x00, 0x58, 0xa3, 0x90, 0x65, 0xc1, 0x27, 0xe2, 0x00, 0xb0, 0x21, 0xb8, 0x21, 0xb8, 0x41, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xc8, 0x00, 0xa0, 0xc6, 0xd1, 0x05, 0xd9, 0x01, 0xd8, 0x01, 0xe0, 0x00, 0xc8, 0x42, 0xd0, 0x83, 0xd0, 0x00, 0xa0, 0x13, 0xe5, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xfe, 0xff, 0xbe, 0xff, 0x35, 0xed, 0x44, 0x98, 0xe9, 0xc1, 0xe8, 0xc1, 0xe8, 0xc1, 0xc8, 0xc1, 0xc8, 0xc1, 0xc7, 0xb1, 0xc7, 0xb1, 0xa7, 0xb1, 0x66, 0xb9, 0x65, 0xa9, 0x64, 0xa9, 0xa5, 0xb1, 0xc3, 0xb8, 0x22, 0xc8, 0x20, 0xb8, 0x00, 0x90, 0x20, 0x88, 0x00, 0x68, 0x82, 0x88, 0x44, 0xb1, 0x24, 0xb1, 0x04, 0xb1, 0x00, 0x90, 0x00, 0x98, 0xa2, 0xb8, 0x82, 0xb0, 0x20, 0x90, 0x20, 0x80, 0xa1, 0x80, 0xe3, 0x78, 0xc3, 0x68, 0x03, 0x59, 0x86, 0x49, 0x85, 0x29, 0x85, 0x19, 0xa6, 0x19, 0x04, 0x11, 0x45, 0x21, 0x05, 0x29, 0x25, 0x31, 0x45, 0x39, 0xe4, 0x30, 0x46, 0x49, 0x26, 0x69, 0x05, 0x71, 0x25, 0x79, 0x45, 0x99, 0xa7, 0xb9, 0x46, 0xc1, 0xa4, 0xa8, 0xa3, 0xa8, 0x83, 0xa8, 0x83, 0xa8, 0x62, 0xa8, 0x61, 0x88, 0xc2, 0x80, 0xa2, 0x90, 0x00, 0x80, 0x8d, 0xab, 0x5b, 0xff, 0x9c, 0xff, 0xde, 0xff, 0xfb, 0xf6, 0x3d, 0xff, 0x1c, 0xff, 0x7d, 0xff, 0xfe, 0xff, 0x95, 0xdd, 0x00, 0x58, 0x65, 0x91, 0x45, 0x91, 0xe4, 0x90, 0x05, 0xa9, 0xa4, 0xa8, 0x83, 0xa8, 0x83, 0xb0, 0xc4, 0xb0, 0x86, 0xc1, 0xe7, 0xc9, 0x62, 0xa8, 0x62, 0xa0, 0x00, 0x80, 0x00, 0x80, 0x01, 0x90, 0x01, 0x98, 0x22, 0xa0, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x21, 0xa8, 0x20, 0xa8, 0x61, 0xb0, 0x21, 0xb0, 0x21, 0xb0, 0x20, 0xb8, 0x40, 0xc0, 0x82, 0xc8, 0xa2, 0xd0, 0xa3, 0xd0, 0x82, 0xc8, 0x41, 0xc0, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb8, 0x20, 0xb8, 0x42, 0xa8, 0x42, 0x98, 0x21, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x41, 0xb8, 0x00, 0xb0, 0xc3, 0xd0, 0x62, 0xd0, 0xe4, 0xe8, 0x00, 0xc8, 0x21, 0xc8, 0x00, 0xa0, 0xf3, 0xe4, 0x9d, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xbf, 0xf7, 0x33, 0xac, 0x24, 0x70, 0x21, 0x90, 0x03, 0xc1, 0x07, 0xea, 0x20, 0xc0, 0x42, 0xc8, 0x21, 0xc8, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x41, 0xc8, 0x61, 0xb8, 0xeb, 0xfa, 0xc7, 0xe9, 0x00, 0xc0, 0x01, 0xd8, 0x00, 0xc8, 0x21, 0xd0, 0x42, 0xd0, 0x00, 0xa8, 0x4d, 0xd3, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xdf, 0xff, 0x19, 0xee, 0x69, 0xa1, 0x2b, 0xc2, 0x4a, 0xba, 0x49, 0xc2, 0x09, 0xc2, 0x29, 0xba, 0x29, 0xb2, 0x29, 0xb2, 0x09, 0xb2, 0xc7, 0xb1, 0xc6, 0xa1, 0x83, 0x81, 0xe4, 0x99, 0x63, 0xb1, 0x83, 0xe0, 0x42, 0xd0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x88, 0xe2, 0xa0, 0xc6, 0xc9, 0xc6, 0xd1, 0xe3, 0xb0, 0x00, 0x90, 0x00, 0xa0, 0x61, 0xb0, 0x82, 0xa8, 0x81, 0xa8, 0x20, 0x80, 0x65, 0x99, 0x04, 0x79, 0x82, 0x50, 0x24, 0x49, 0x08, 0x52, 0xa6, 0x29, 0x24, 0x09, 0xe7, 0x21, 0x65, 0x19, 0xe8, 0x39, 0x65, 0x31, 0x04, 0x39, 0x25, 0x41, 0xe4, 0x40, 0x46, 0x51, 0xa8, 0x61, 0xa7, 0x69, 0xa7, 0x71, 0x67, 0x89, 0x46, 0x91, 0x46, 0x99, 0xc4, 0x88, 0x62, 0x78, 0x62, 0x88, 0x42, 0x98, 0x02, 0xa0, 0x22, 0x90, 0x22, 0x88, 0x42, 0xa0, 0x42, 0xa8, 0x0b, 0xc3, 0xb4, 0xfd, 0x73, 0xdd, 0x74, 0xdd, 0xd3, 0xe4, 0x77, 0xf5, 0x76, 0xed, 0x96, 0xe5, 0xd6, 0xe5, 0x2f, 0xbc, 0x00, 0x50, 0x45, 0x81, 0x46, 0x89, 0x25, 0x91, 0x67, 0xa1, 0x46, 0xa9, 0x05, 0xb1, 0x05, 0xb1, 0xa4, 0xb0, 0x84, 0xa8, 0x83, 0xb0, 0xa3, 0xa8, 0x83, 0xa8, 0xa3, 0xa0, 0xa4, 0xa0, 0xc5, 0xa8, 0xe5, 0xb0, 0xc4, 0xb0, 0x83, 0xa8, 0x62, 0x98, 0x21, 0x90, 0x61, 0x98, 0x81, 0xa0, 0x40, 0xa0, 0x00, 0xa0, 0x61, 0xb0, 0x61, 0xb8, 0xc2, 0xc0, 0x04, 0xd1, 0x25, 0xd9, 0x25, 0xd9, 0xe4, 0xd0, 0x82, 0xc0, 0x41, 0xb8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xb0, 0x20, 0xb8, 0x61, 0xc0, 0x01, 0xa0, 0x01, 0x98, 0x00, 0x90, 0x00, 0x88, 0x21, 0x98, 0x82, 0xa8, 0x62, 0xa8, 0xa3, 0xc0, 0x62, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x83, 0xd0, 0xc4, 0xe0, 0xc3, 0xc0, 0x0d, 0xeb, 0xe8, 0xc1, 0xdb, 0xfe, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xf7, 0x7b, 0xee, 0x2a, 0x9a, 0x00, 0x90, 0xe3, 0xc8, 0x00, 0xb8, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd0, 0x21, 0xd0, 0x63, 0xd0, 0xe4, 0xd8, 0xc3, 0xc8, 0xa7, 0xe1, 0xc3, 0xc0, 0x00, 0xb0, 0x20, 0xc8, 0x00, 0xc8, 0x20, 0xd8, 0x61, 0xd8, 0x00, 0xb8, 0xeb, 0xd2, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0x2f, 0xbb, 0x6c, 0xba, 0xcc, 0xba, 0xcc, 0xba, 0x8c, 0xc2, 0xac, 0xba, 0xcc, 0xb2, 0xcc, 0xaa, 0xac, 0xb2, 0x8b, 0xba, 0xcb, 0xb2, 0x68, 0x9a, 0x47, 0x9a, 0x27, 0xc2, 0x84, 0xe0, 0x01, 0xd0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x20, 0xb0, 0x41, 0xb8, 0x62, 0xc0, 0x63, 0xc8, 0x42, 0xc8, 0x83, 0xd0, 0x63, 0xd0, 0xa4, 0xd0, 0x63, 0xc0, 0x00, 0x90, 0x86, 0x91, 0xe7, 0x91, 0xc7, 0x81, 0xc8, 0x79, 0xa7, 0x69, 0xe8, 0x61, 0x05, 0x39, 0x87, 0x41, 0xa3, 0x18, 0x04, 0x21, 0x65, 0x29, 0x64, 0x21, 0xc5, 0x31, 0x84, 0x21, 0xe7, 0x39, 0x29, 0x5a, 0x08, 0x6a, 0xc8, 0x71, 0xc8, 0x79, 0xc7, 0x79, 0xa6, 0x79, 0x65, 0x79, 0x24, 0x79, 0x25, 0x89, 0x45, 0x89, 0x85, 0x91, 0x85, 0x89, 0x65, 0x89, 0x25, 0xa1, 0x62, 0x98, 0x61, 0x70, 0x24, 0x81, 0x44, 0x81, 0x05, 0x81, 0x68, 0x99, 0x05, 0x79, 0x25, 0x71, 0x46, 0x79, 0x04, 0x59, 0xe3, 0x58, 0xa2, 0x60, 0xc2, 0x70, 0x03, 0x79, 0x24, 0x89, 0x45, 0x99, 0x45, 0xa1, 0x66, 0xb1, 0x46, 0xb9, 0x25, 0xb9, 0x04, 0xb1, 0x04, 0xb1, 0x24, 0xb1, 0x24, 0xb1, 0x24, 0xa9, 0x25, 0xa9, 0x25, 0xb1, 0x04, 0xb1, 0xc3, 0xa8, 0xa3, 0xa0, 0xa3, 0xa0, 0xa2, 0xa0, 0x00, 0x88, 0x82, 0xa0, 0x00, 0x88, 0x00, 0x98, 0x22, 0xa8, 0x21, 0xa0, 0x81, 0xa8, 0xa3, 0xb0, 0xc3, 0xb8, 0xc4, 0xc0, 0xa3, 0xb8, 0x21, 0xa0, 0x21, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x41, 0xb8, 0x21, 0xa0, 0x00, 0x88, 0x00, 0x78, 0x00, 0x78, 0x00, 0x88, 0xa2, 0xa0, 0xe4, 0xb0, 0xe3, 0xc0, 0x62, 0xb8, 0x21, 0xb8, 0x82, 0xc0, 0x62, 0xc0, 0x41, 0xc0, 0x45, 0xe1, 0xa3, 0xc0, 0x2d, 0xfb, 0x8b, 0xd2, 0xab, 0xb2, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x15, 0xd5, 0x83, 0x80, 0x41, 0xa8, 0x20, 0xb8, 0x61, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x21, 0xd0, 0x62, 0xd0, 0xa3, 0xd0, 0x62, 0xc0, 0xa2, 0xc0, 0x81, 0xc0, 0x61, 0xc8, 0x20, 0xc8, 0x00, 0xc8, 0x00, 0xd0, 0x01, 0xd0, 0x01, 0xb8, 0x29, 0xc2, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x15, 0xdd, 0x6f, 0xc3, 0xd0, 0xc3, 0xd0, 0xc3, 0xb0, 0xcb, 0xd1, 0xc3, 0xf1, 0xbb, 0xf1, 0xbb, 0xd1, 0xc3, 0x2e, 0xbb, 0x4d, 0xb3, 0x4c, 0xab, 0x2b, 0xb3, 0x28, 0xc2, 0xa5, 0xd0, 0x22, 0xd0, 0x22, 0xd0, 0x42, 0xd0, 0x83, 0xd0, 0x21, 0xc0, 0x21, 0xc0, 0x42, 0xc8, 0x00, 0xb8, 0x01, 0xc0, 0x02, 0xc8, 0x22, 0xc8, 0x22, 0xc8, 0x01, 0xb8, 0x20, 0x98, 0x86, 0x91, 0x28, 0x9a, 0x8b, 0xaa, 0x2d, 0xbb, 0x4b, 0x9a, 0x4b, 0x92, 0x85, 0x50, 0xc9, 0x61, 0x46, 0x49, 0x86, 0x39, 0x27, 0x42, 0xa4, 0x21, 0x26, 0x2a, 0x22, 0x09, 0x84, 0x21, 0xc7, 0x49, 0x66, 0x59, 0x26, 0x61, 0x45, 0x61, 0x45, 0x59, 0x04, 0x59, 0x25, 0x69, 0x45, 0x79, 0x45, 0x79, 0x24, 0x71, 0x43, 0x61, 0x23, 0x59, 0x24, 0x61, 0xe4, 0x80, 0x04, 0xa1, 0x83, 0x98, 0xa3, 0x90, 0xe4, 0x90, 0x63, 0x70, 0x47, 0x91, 0x03, 0x70, 0x06, 0x81, 0xe8, 0x99, 0x04, 0x71, 0xc6, 0x81, 0x00, 0x58, 0x00, 0x58, 0x20, 0x68, 0x61, 0x78, 0x20, 0x80, 0x40, 0x88, 0x61, 0x90, 0x61, 0x98, 0x82, 0xa0, 0xa2, 0xa8, 0xa2, 0xa0, 0x81, 0xa0, 0x60, 0x98, 0x61, 0x98, 0x81, 0x98, 0x61, 0x98, 0x40, 0x98, 0x20, 0x90, 0x40, 0x90, 0x81, 0x98, 0x44, 0xb1, 0x20, 0x90, 0x21, 0x90, 0x00, 0x90, 0x42, 0xa0, 0x00, 0x90, 0x00, 0x90, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x01, 0xa0, 0x01, 0x98, 0x00, 0x88, 0x00, 0x80, 0x00, 0x80, 0x41, 0x88, 0x61, 0x90, 0x00, 0xa0, 0x00, 0xa8, 0x01, 0xa8, 0x00, 0x90, 0x21, 0x90, 0x82, 0x98, 0xe3, 0xa0, 0x61, 0x90, 0x41, 0x90, 0x82, 0x98, 0x41, 0xa0, 0x00, 0x98, 0x00, 0xa0, 0x41, 0xa8, 0x41, 0xa8, 0x41, 0xa8, 0x82, 0xb0, 0x24, 0xc9, 0x08, 0xc2, 0xd0, 0xfb, 0x22, 0xa0, 0x55, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x4d, 0xbb, 0x00, 0x88, 0x82, 0xc0, 0x00, 0xc0, 0x20, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x21, 0xc8, 0x00, 0xc0, 0x82, 0xc8, 0x24, 0xe1, 0xc3, 0xd8, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x42, 0xd0, 0x00, 0xa8, 0x0d, 0xd3, 0x3d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xf6, 0x97, 0xed, 0x97, 0xdd, 0x97, 0xdd, 0x77, 0xdd, 0x78, 0xdd, 0x98, 0xd5, 0xb8, 0xd5, 0x98, 0xdd, 0x98, 0xed, 0x56, 0xdd, 0x75, 0xe5, 0xf3, 0xec, 0x6a, 0xca, 0x48, 0xe1, 0x02, 0xc8, 0x21, 0xc0, 0x21, 0xb8, 0x62, 0xb8, 0x21, 0xb0, 0x62, 0xb8, 0x41, 0xb0, 0x62, 0xc0, 0x62, 0xc0, 0x42, 0xc0, 0x63, 0xc0, 0x42, 0xb0, 0x00, 0xa0, 0x61, 0x90, 0x65, 0x89, 0xa6, 0x81, 0x49, 0xa2, 0x8f, 0xcb, 0x6f, 0xc3, 0x0e, 0xbb, 0xe6, 0x68, 0x67, 0x69, 0x67, 0x59, 0x04, 0x41, 0x24, 0x31, 0xe2, 0x20, 0xc5, 0x31, 0x02, 0x19, 0x64, 0x31, 0x66, 0x51, 0x26, 0x61, 0xe5, 0x68, 0x05, 0x61, 0x05, 0x61, 0x25, 0x61, 0x46, 0x69, 0x66, 0x71, 0x66, 0x71, 0x45, 0x61, 0x65, 0x59, 0x65, 0x51, 0x45, 0x59, 0xc3, 0x68, 0xe4, 0x88, 0x05, 0xa9, 0xc4, 0x98, 0xa3, 0x78, 0x41, 0x48, 0xe3, 0x50, 0xa7, 0x69, 0xe8, 0x79, 0x61, 0x48, 0x02, 0x51, 0x0e, 0xbc, 0x00, 0x60, 0x00, 0x68, 0x40, 0x78, 0x61, 0x88, 0x40, 0x88, 0x20, 0x90, 0x20, 0x90, 0x00, 0x90, 0x20, 0x98, 0x40, 0x98, 0x40, 0x98, 0x20, 0x98, 0x20, 0x90, 0x20, 0x98, 0x20, 0x98, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x20, 0x90, 0x61, 0x90, 0x86, 0xb9, 0x04, 0xa1, 0x00, 0x88, 0xe4, 0xa8, 0xa8, 0xc1, 0x00, 0x80, 0x21, 0x88, 0x20, 0x80, 0x00, 0x88, 0x00, 0x90, 0x01, 0x90, 0x22, 0x90, 0x22, 0x80, 0x00, 0x68, 0x20, 0x60, 0x41, 0x68, 0x42, 0x78, 0x22, 0x90, 0x03, 0xa8, 0x84, 0xb8, 0xe4, 0xb8, 0x62, 0x98, 0x41, 0x88, 0xc2, 0x98, 0xa2, 0x90, 0x44, 0xa9, 0x85, 0xb1, 0x82, 0xa0, 0x41, 0xa0, 0x20, 0x98, 0x41, 0xa0, 0x20, 0x98, 0x20, 0x90, 0x65, 0xc1, 0x44, 0xc1, 0x03, 0xc9, 0xc7, 0xe1, 0x45, 0xc1, 0x00, 0xa8, 0xfb, 0xfe, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0x8a, 0xb2, 0x00, 0xa0, 0x83, 0xc0, 0x20, 0xc0, 0x20, 0xc0, 0x00, 0xc8, 0x20, 0xd0, 0x41, 0xd8, 0x62, 0xd8, 0x82, 0xd8, 0xa2, 0xd8, 0x81, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x20, 0xd8, 0x00, 0xc8, 0xc3, 0xd0, 0x00, 0xa0, 0xb3, 0xec, 0x7e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x7e, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7e, 0xff, 0x5d, 0xff, 0xb3, 0xec, 0xa7, 0xb1, 0x23, 0xb8, 0x00, 0xb0, 0x21, 0xa8, 0x00, 0x90, 0x00, 0x98, 0x00, 0x88, 0x20, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x78, 0x20, 0x78, 0xa2, 0x68, 0x49, 0xa2, 0xcb, 0xb2, 0x66, 0x81, 0x00, 0x40, 0x01, 0x58, 0x00, 0x48, 0x00, 0x38, 0x00, 0x38, 0x83, 0x48, 0x45, 0x59, 0xe3, 0x48, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x18, 0x00, 0x18, 0x00, 0x10, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x83, 0x78, 0x6a, 0xc2, 0xe9, 0xa9, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x45, 0x51, 0xe8, 0x81, 0x21, 0x60, 0x20, 0x48, 0xca, 0x9a, 0x00, 0x70, 0x00, 0x78, 0x00, 0x80, 0x40, 0x88, 0x20, 0x90, 0x20, 0x90, 0x20, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x20, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x20, 0x98, 0x20, 0x90, 0x00, 0x88, 0x04, 0xa9, 0xe3, 0xa0, 0x00, 0x80, 0x04, 0xa9, 0xaa, 0xd2, 0x00, 0x78, 0x61, 0x80, 0x40, 0x78, 0x20, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x78, 0x41, 0x68, 0x20, 0x48, 0x40, 0x38, 0x20, 0x38, 0x20, 0x48, 0x00, 0x68, 0x43, 0x90, 0xa4, 0xb0, 0xc3, 0xa8, 0x00, 0x90, 0x20, 0x88, 0x24, 0xa9, 0x00, 0x88, 0xa2, 0x88, 0x03, 0x99, 0x20, 0x88, 0x00, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x78, 0x00, 0x80, 0x61, 0x88, 0xe3, 0xb0, 0x65, 0xd1, 0x20, 0xc0, 0x82, 0xc8, 0xa3, 0xc0, 0x4d, 0xdb, 0x7c, 0xff, 0xbd, 0xff, 0xb8, 0xce, 0x3b, 0xef, 0xf3, 0xe4, 0x00, 0x78, 0xc4, 0xb8, 0x80, 0xb8, 0x20, 0xc0, 0x00, 0xc0, 0x20, 0xd0, 0x20, 0xd0, 0x21, 0xd8, 0x41, 0xd0, 0x41, 0xd0, 0x00, 0xc8, 0x20, 0xc8, 0x21, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x62, 0xb8, 0x00, 0xa0, 0xb7, 0xf5, 0x7f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7e, 0xff, 0xdc, 0xfe, 0x6a, 0xa2, 0x05, 0xb1, 0x26, 0xd1, 0xe8, 0xe9, 0x45, 0xc1, 0x20, 0x90, 0x64, 0xb1, 0x23, 0xa1, 0x60, 0x88, 0x40, 0x88, 0x61, 0x90, 0xe3, 0xa0, 0x81, 0x90, 0x81, 0x90, 0xe3, 0x98, 0x61, 0x80, 0x00, 0x70, 0xa2, 0x80, 0x24, 0x79, 0x86, 0x81, 0x69, 0x9a, 0x70, 0xc4, 0x30, 0xac, 0xce, 0xa3, 0xef, 0xa3, 0xaf, 0xab, 0x46, 0x79, 0x01, 0x60, 0xc9, 0x99, 0x4f, 0xc3, 0xd3, 0xcc, 0xf3, 0xb4, 0xb1, 0xa4, 0x71, 0x9c, 0x91, 0xa4, 0x51, 0xa4, 0x31, 0x9c, 0x92, 0xa4, 0xb1, 0x8c, 0xd1, 0x84, 0xd2, 0x84, 0x91, 0x84, 0x31, 0x94, 0xf0, 0x93, 0x10, 0x9c, 0xf0, 0xa3, 0xec, 0xa2, 0x26, 0x99, 0xe5, 0x88, 0xcb, 0x9a, 0xf2, 0xac, 0x33, 0xad, 0x08, 0x6a, 0x04, 0x78, 0x48, 0xa9, 0xa5, 0x98, 0x00, 0x78, 0x62, 0x88, 0xa3, 0x90, 0xa3, 0x90, 0xa4, 0x98, 0xc4, 0xa0, 0x83, 0x98, 0x83, 0x98, 0xa3, 0xa0, 0xe4, 0xa8, 0xe4, 0xa8, 0xc3, 0xa0, 0xc3, 0xa0, 0xa3, 0xa0, 0x83, 0xa8, 0x42, 0xa8, 0x62, 0xa0, 0xc3, 0xa8, 0x04, 0xa9, 0xc3, 0xa0, 0x61, 0x90, 0x00, 0x80, 0x40, 0x90, 0x41, 0x90, 0x40, 0x98, 0xeb, 0xe2, 0x00, 0x88, 0x40, 0x78, 0x80, 0x78, 0x82, 0x88, 0x21, 0x80, 0x00, 0x78, 0x00, 0x68, 0x20, 0x50, 0x40, 0x38, 0xa0, 0x28, 0xc1, 0x30, 0xa1, 0x40, 0x00, 0x50, 0x01, 0x70, 0x21, 0x90, 0x00, 0xa0, 0x00, 0xa0, 0x44, 0xc1, 0xca, 0xea, 0x65, 0xb9, 0x20, 0x90, 0x61, 0xa0, 0x21, 0x98, 0x00, 0x88, 0x00, 0x80, 0x00, 0x88, 0x00, 0x80, 0x00, 0x80, 0x81, 0x90, 0x81, 0xa8, 0xe2, 0xb8, 0x44, 0xe1, 0xa2, 0xd0, 0x24, 0xe1, 0x82, 0xa8, 0x54, 0xed, 0xbd, 0xff, 0xd1, 0x9c, 0xaa, 0x5a, 0xab, 0x7a, 0x44, 0x78, 0x82, 0x98, 0xa1, 0xb0, 0x60, 0xb8, 0x20, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xc8, 0x41, 0xd8, 0x00, 0xc8, 0x20, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x29, 0xfa, 0x46, 0xb9, 0xd0, 0xc3, 0xfc, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0xb3, 0xd4, 0xa7, 0xb1, 0x83, 0xb0, 0xc4, 0xd0, 0x25, 0xe1, 0xc4, 0xc8, 0xe3, 0xc8, 0x89, 0xfa, 0x28, 0xe2, 0x20, 0xa8, 0xa2, 0xb0, 0x20, 0xb0, 0xcb, 0xfa, 0xc7, 0xd9, 0x00, 0xa8, 0x24, 0xb9, 0x65, 0xc1, 0x69, 0xda, 0x41, 0x98, 0x00, 0x80, 0x65, 0xa1, 0x99, 0xfe, 0x9c, 0xff, 0x3a, 0xff, 0xdd, 0xff, 0x7c, 0xff, 0x9d, 0xff, 0xdb, 0xfe, 0x12, 0xdc, 0x04, 0x88, 0xce, 0xca, 0x3a, 0xfe, 0x9e, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xf7, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0x7a, 0xfe, 0x72, 0xe4, 0xed, 0xba, 0x9a, 0xf6, 0xfe, 0xff, 0xfe, 0xf7, 0x59, 0xe6, 0xac, 0xa2, 0x00, 0x80, 0x00, 0x78, 0x01, 0x80, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0x78, 0x00, 0x80, 0x01, 0x80, 0x63, 0x88, 0x05, 0x91, 0x65, 0x99, 0x25, 0x99, 0xe3, 0x98, 0x41, 0x90, 0x82, 0xa0, 0x82, 0xa8, 0x00, 0xa0, 0x24, 0xb9, 0x20, 0x98, 0x40, 0x90, 0x00, 0x78, 0x00, 0x88, 0x21, 0x98, 0x00, 0x80, 0xa3, 0x90, 0x42, 0x60, 0x40, 0x48, 0x40, 0x38, 0x60, 0x40, 0x60, 0x58, 0x00, 0x60, 0x00, 0x80, 0x22, 0xa8, 0x82, 0xc0, 0x41, 0xb8, 0xe3, 0xc0, 0x65, 0xc9, 0x61, 0xa8, 0x86, 0xc1, 0x08, 0xe2, 0xa3, 0xb8, 0x41, 0xa8, 0x21, 0xa0, 0x00, 0x90, 0x00, 0x88, 0x20, 0x90, 0x45, 0xc1, 0xa2, 0xb8, 0x40, 0xa8, 0x23, 0xd1, 0xe2, 0xd8, 0x20, 0xc8, 0xc3, 0xc8, 0xc7, 0xb9, 0x17, 0xee, 0xdd, 0xff, 0x95, 0xc5, 0x00, 0x08, 0x26, 0x69, 0x83, 0x78, 0xe2, 0xa0, 0x20, 0x90, 0x41, 0xb8, 0x41, 0xc8, 0x21, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x21, 0xd0, 0x00, 0xc0, 0x62, 0xd0, 0x42, 0xc8, 0x63, 0xd0, 0x2a, 0xea, 0x49, 0xaa, 0x39, 0xf6, 0x9f, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x1c, 0xff, 0xcf, 0xcb, 0x25, 0xc1, 0x41, 0xb8, 0x62, 0xc8, 0x42, 0xd0, 0x21, 0xd0, 0x62, 0xd0, 0x45, 0xe9, 0x25, 0xd9, 0x62, 0xc0, 0x82, 0xc8, 0x62, 0xc8, 0xa7, 0xf9, 0xe5, 0xd8, 0x62, 0xc8, 0xe4, 0xd0, 0xe3, 0xc8, 0xa7, 0xd9, 0xe4, 0xc0, 0x62, 0xa0, 0x00, 0x88, 0x28, 0xaa, 0xe5, 0x89, 0x40, 0x58, 0x94, 0xcd, 0xbd, 0xff, 0x3b, 0xff, 0x9e, 0xff, 0x5e, 0xff, 0xd9, 0xfd, 0xcd, 0xaa, 0x44, 0x70, 0x4e, 0xab, 0x3d, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xde, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0x7d, 0xe7, 0xff, 0xff, 0x9e, 0xff, 0x11, 0xcc, 0x92, 0xc4, 0x9e, 0xff, 0x9c, 0xef, 0xff, 0xf7, 0xff, 0xff, 0x1d, 0xff, 0x57, 0xf5, 0x92, 0xdc, 0x51, 0xcc, 0x72, 0xcc, 0x72, 0xcc, 0x72, 0xcc, 0x52, 0xcc, 0x52, 0xcc, 0x52, 0xcc, 0x31, 0xcc, 0x11, 0xc4, 0x11, 0xc4, 0x11, 0xc4, 0x11, 0xc4, 0x31, 0xc4, 0x11, 0xc4, 0x12, 0xcc, 0xb0, 0xbb, 0xcc, 0x9a, 0xa7, 0x69, 0xa2, 0x58, 0xc3, 0x70, 0x65, 0x91, 0x00, 0x80, 0x86, 0xc9, 0xe8, 0xe1, 0xc7, 0xe9, 0x65, 0xe1, 0x20, 0xb0, 0x00, 0x98, 0xc4, 0xb0, 0x22, 0xa0, 0x00, 0x90, 0x02, 0x98, 0x00, 0x80, 0x41, 0x80, 0x00, 0x50, 0x00, 0x50, 0x81, 0x68, 0x24, 0x89, 0xe4, 0xa0, 0x22, 0xa0, 0x20, 0xa0, 0xe4, 0xe0, 0x61, 0xc8, 0x41, 0xc0, 0x40, 0xb8, 0x00, 0xa8, 0xe4, 0xc8, 0x45, 0xd9, 0x83, 0xc0, 0x22, 0xb8, 0x21, 0xb0, 0x01, 0xa8, 0x00, 0x98, 0x21, 0xa0, 0x21, 0xa8, 0x20, 0xb0, 0x20, 0xa8, 0xc1, 0xc0, 0x22, 0xd9, 0x81, 0xd8, 0x41, 0xc0, 0x41, 0xb8, 0xeb, 0xc2, 0xfb, 0xfe, 0xb6, 0xdd, 0x65, 0x49, 0xc7, 0x61, 0xc3, 0x60, 0x61, 0x80, 0x41, 0x90, 0x82, 0xa8, 0x62, 0xb0, 0x04, 0xc9, 0x62, 0xc8, 0x21, 0xc8, 0x62, 0xc8, 0xc4, 0xc8, 0x83, 0xb8, 0xe4, 0xc0, 0x00, 0xa0, 0xe8, 0xb1, 0x96, 0xfd, 0x5d, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x4d, 0xcb, 0xe4, 0xd0, 0x41, 0xd0, 0x61, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x01, 0xd8, 0x00, 0xd0, 0x21, 0xd0, 0x42, 0xd0, 0x21, 0xd0, 0x22, 0xd8, 0x01, 0xd0, 0x01, 0xd0, 0x42, 0xd8, 0x42, 0xd0, 0x01, 0xc0, 0x62, 0xc8, 0x05, 0xd9, 0xa3, 0xc0, 0x00, 0xa0, 0x00, 0x80, 0x00, 0x68, 0x00, 0x58, 0xe1, 0x70, 0x58, 0xe6, 0xde, 0xff, 0x3c, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xdb, 0xfe, 0x92, 0xbc, 0x88, 0x89, 0x8c, 0x9a, 0x7b, 0xfe, 0x5e, 0xff, 0xbf, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0x5d, 0xff, 0x0c, 0xa3, 0x75, 0xcd, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x79, 0xe6, 0xd2, 0xb4, 0x2c, 0x8b, 0x29, 0x82, 0x01, 0x90, 0x83, 0xa8, 0x42, 0xc0, 0x63, 0xd0, 0xa3, 0xd0, 0xc3, 0xd0, 0xc3, 0xb0, 0xe5, 0xb0, 0x02, 0x98, 0x43, 0xa0, 0x22, 0x98, 0x22, 0x88, 0x00, 0x78, 0x00, 0x68, 0x20, 0x78, 0x40, 0x80, 0x00, 0x88, 0x62, 0xa8, 0x82, 0xb8, 0x42, 0xc0, 0xe4, 0xe8, 0x41, 0xd0, 0x20, 0xc8, 0x00, 0xb8, 0x00, 0xc0, 0x61, 0xc8, 0x42, 0xd0, 0x42, 0xd0, 0x01, 0xc8, 0x21, 0xc0, 0x21, 0xb8, 0x21, 0xb0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xb0, 0x40, 0xb8, 0x40, 0xb8, 0x22, 0xd9, 0x64, 0xe9, 0x61, 0xc8, 0xe4, 0xc0, 0x23, 0xb0, 0x2d, 0xcb, 0x3c, 0xff, 0x58, 0xf6, 0x99, 0xf6, 0x71, 0xbc, 0xab, 0x8a, 0xcb, 0xa2, 0xe4, 0x88, 0x29, 0xc2, 0xaf, 0xfb, 0xc7, 0xd9, 0x04, 0xc9, 0x00, 0xb0, 0xc4, 0xb0, 0x00, 0x98, 0x09, 0xb2, 0x2d, 0xbb, 0xd8, 0xfd, 0xbe, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xec, 0xca, 0x63, 0xd0, 0x20, 0xd8, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x21, 0xd8, 0x00, 0xc8, 0x00, 0xd0, 0x01, 0xd8, 0x01, 0xd0, 0x21, 0xc8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0x98, 0x00, 0x90, 0x41, 0x88, 0x00, 0x68, 0xc7, 0x89, 0x9a, 0xf6, 0xbe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x38, 0xe6, 0x8b, 0x92, 0x6b, 0x92, 0x5a, 0xf6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xef, 0xff, 0xff, 0xdb, 0xfe, 0x6a, 0x8a, 0x79, 0xee, 0xbe, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xde, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x59, 0xf6, 0xcc, 0xba, 0x00, 0x90, 0x63, 0xa8, 0x83, 0xb8, 0x21, 0xb0, 0x62, 0xa8, 0x00, 0x90, 0x86, 0x81, 0xc6, 0x89, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x60, 0x68, 0x61, 0x68, 0x41, 0x78, 0x82, 0x90, 0x61, 0x90, 0x00, 0x90, 0x20, 0xa0, 0xc3, 0xc8, 0xc3, 0xe0, 0x00, 0xd0, 0x61, 0xd8, 0x40, 0xd0, 0x21, 0xd0, 0x41, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x21, 0xc8, 0x20, 0xc0, 0x00, 0xb0, 0x42, 0xb8, 0x01, 0xb8, 0x20, 0xb8, 0x00, 0xb0, 0x60, 0xc0, 0x44, 0xe1, 0xe3, 0xd8, 0x22, 0xc0, 0x46, 0xc9, 0x02, 0xa8, 0xf0, 0xcb, 0xfb, 0xfe, 0xbd, 0xff, 0x7c, 0xff, 0xdb, 0xfe, 0xdb, 0xfe, 0x96, 0xed, 0x87, 0xa9, 0x66, 0xb9, 0x05, 0xa9, 0x86, 0xa9, 0xcb, 0xd2, 0x6e, 0xcb, 0xd3, 0xcc, 0xf8, 0xfd, 0xfc, 0xfe, 0xbf, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xcb, 0xc2, 0x01, 0xd0, 0x00, 0xd8, 0x00, 0xc8, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x20, 0xd0, 0x20, 0xc8, 0x00, 0xc0, 0x20, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x42, 0xd0, 0x00, 0xc8, 0x21, 0xd0, 0x00, 0xd0, 0x01, 0xc8, 0x00, 0xc0, 0x42, 0xb8, 0x21, 0xa8, 0x42, 0x88, 0x00, 0x60, 0xcb, 0xa2, 0x3c, 0xff, 0xde, 0xff, 0xde, 0xf7, 0xff, 0xf7, 0xfe, 0xf7, 0xff, 0xff, 0xfb, 0xf6, 0xf0, 0xab, 0x29, 0x72, 0xbb, 0xf6, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0x14, 0xd5, 0x4d, 0x83, 0x9e, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0x9e, 0xff, 0x35, 0xe5, 0x00, 0x30, 0x06, 0xa1, 0x21, 0x80, 0x42, 0x88, 0x00, 0x70, 0xcb, 0x8a, 0xda, 0xe6, 0x5b, 0xef, 0xb9, 0xde, 0xb9, 0xde, 0xd9, 0xee, 0x17, 0xf6, 0x08, 0x92, 0x41, 0x78, 0x20, 0x88, 0x61, 0xa0, 0x20, 0x98, 0x80, 0xa0, 0x44, 0xd1, 0xc3, 0xe0, 0x00, 0xc8, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x20, 0xc8, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xb8, 0x81, 0xc8, 0x04, 0xd9, 0x46, 0xd9, 0x63, 0xb8, 0xe5, 0xb8, 0xc5, 0xb0, 0xef, 0xc3, 0x7b, 0xff, 0xde, 0xff, 0xdf, 0xff, 0x5d, 0xff, 0x7e, 0xff, 0x52, 0xdc, 0x00, 0x68, 0x83, 0x78, 0x00, 0x88, 0x18, 0xfe, 0x1c, 0xff, 0x7d, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xac, 0xc2, 0x02, 0xe0, 0x00, 0xe0, 0x00, 0xd0, 0x20, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x00, 0xd0, 0x20, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x21, 0xc8, 0x62, 0xc8, 0x62, 0xb8, 0x22, 0x98, 0x63, 0x88, 0x00, 0x48, 0xf0, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xbd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7e, 0xff, 0x14, 0xd5, 0x67, 0x61, 0xb8, 0xfd, 0xfd, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x1d, 0xff, 0x46, 0x71, 0xd6, 0xdd, 0xbd, 0xff, 0xdd, 0xe7, 0xdf, 0xf7, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9a, 0xfe, 0x52, 0xcc, 0x00, 0x58, 0x00, 0x40, 0x00, 0x38, 0x8e, 0x9b, 0x5d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xbe, 0xff, 0x93, 0xcc, 0xc4, 0x80, 0x01, 0x90, 0x23, 0xc0, 0xe6, 0xe8, 0xc4, 0xe0, 0x20, 0xc0, 0x20, 0xc0, 0x41, 0xd8, 0x20, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd0, 0x20, 0xc0, 0x00, 0xa8, 0x21, 0xb0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0xc0, 0xe3, 0xd0, 0x66, 0xd9, 0x67, 0xe1, 0x06, 0xd1, 0xa8, 0xc9, 0x03, 0x99, 0xd1, 0xcc, 0xdd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0x7a, 0xf6, 0xe8, 0x91, 0x00, 0x60, 0x34, 0xf5, 0x7d, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0x8b, 0xc2, 0x22, 0xd8, 0x00, 0xe0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x21, 0xe8, 0x00, 0xe0, 0x00, 0xd0, 0x41, 0xe0, 0x00, 0xd0, 0x20, 0xd8, 0x00, 0xd0, 0x21, 0xd0, 0x21, 0xc8, 0x62, 0xc8, 0x62, 0xb0, 0x01, 0x90, 0x42, 0x80, 0xe4, 0x70, 0x56, 0xdd, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xbe, 0xff, 0x9e, 0xff, 0xb8, 0xfd, 0xa4, 0x70, 0x90, 0xd3, 0x5a, 0xfe, 0x9e, 0xff, 0xde, 0xff, 0xff, 0xff, 0xde, 0xff, 0x9e, 0xff, 0xbc, 0xfe, 0x4b, 0x9a, 0x77, 0xf5, 0x9d, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x7e, 0xff, 0xbb, 0xfe, 0xd7, 0xed, 0x18, 0xee, 0x7d, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xf8, 0xed, 0xc7, 0x89, 0x01, 0x88, 0x02, 0xb0, 0x03, 0xd0, 0x23, 0xe0, 0x01, 0xd8, 0x01, 0xd0, 0x21, 0xd0, 0x00, 0xc8, 0x41, 0xd8, 0x00, 0xc8, 0x20, 0xd0, 0x61, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xe0, 0x00, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x40, 0xd8, 0x20, 0xc8, 0x00, 0xb8, 0x62, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xb8, 0x42, 0xb8, 0x21, 0xa0, 0xc5, 0xc0, 0x47, 0xd1, 0x87, 0xd1, 0xe7, 0xc9, 0xe0, 0xa0, 0x95, 0xdd, 0x9e, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x5d, 0xf7, 0xef, 0xa3, 0xaa, 0x7a, 0x79, 0xf6, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xb9, 0xfe, 0xaa, 0xba, 0x41, 0xc8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x01, 0xd0, 0x22, 0xc8, 0x01, 0xb0, 0x01, 0x90, 0x00, 0x70, 0x86, 0x89, 0x96, 0xe5, 0xbb, 0xee, 0xfb, 0xee, 0xfb, 0xee, 0xba, 0xee, 0x99, 0xee, 0x79, 0xf6, 0xd7, 0xf5, 0x35, 0xfd, 0x00, 0x90, 0x44, 0xa1, 0x30, 0xdc, 0x54, 0xed, 0x99, 0xf6, 0xda, 0xf6, 0xb6, 0xed, 0x0c, 0xa3, 0xaf, 0xc3, 0xdb, 0xf6, 0x9a, 0xee, 0x79, 0xf6, 0x58, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x79, 0xf6, 0x79, 0xf6, 0x79, 0xf6, 0x79, 0xf6, 0x79, 0xf6, 0x79, 0xf6, 0x79, 0xf6, 0x7a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x79, 0xf6, 0x59, 0xf6, 0x79, 0xf6, 0x7a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x9a, 0xf6, 0x79, 0xf6, 0x9a, 0xf6, 0xbb, 0xf6, 0xdb, 0xf6, 0xdb, 0xf6, 0x9a, 0xf6, 0x59, 0xf6, 0x7a, 0xf6, 0x59, 0xf6, 0x79, 0xf6, 0xb6, 0xf5, 0xe7, 0xb1, 0x00, 0x80, 0x00, 0x90, 0x21, 0xb0, 0x42, 0xc0, 0x22, 0xc8, 0x01, 0xc8, 0x00, 0xd0, 0x21, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd0, 0x00, 0xc8, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x01, 0xc0, 0x02, 0xb8, 0x25, 0xa1, 0x66, 0xb1, 0x06, 0xc1, 0x67, 0xd9, 0x45, 0xd9, 0x03, 0xc9, 0x00, 0xa8, 0xd2, 0xe4, 0xda, 0xfe, 0xdd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x99, 0xfe, 0x8a, 0xba, 0x41, 0xc8, 0x20, 0xd8, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x21, 0xd0, 0x21, 0xc8, 0x20, 0xa8, 0x00, 0x90, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x60, 0x00, 0x70, 0x00, 0x88, 0x01, 0xa8, 0x63, 0xb8, 0x21, 0xc0, 0x04, 0xb9, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x88, 0x00, 0x98, 0xc7, 0xb1, 0x82, 0x90, 0x00, 0x88, 0x05, 0xa9, 0xc4, 0xb0, 0x00, 0x90, 0x00, 0xa8, 0x84, 0xa8, 0x03, 0xb0, 0x42, 0xb0, 0x22, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x01, 0xa8, 0x42, 0xb0, 0x63, 0xb0, 0x83, 0xa8, 0x63, 0xa8, 0x83, 0xb0, 0xa3, 0xb0, 0xa3, 0xb0, 0x63, 0xa8, 0x62, 0xa8, 0x62, 0xa8, 0x23, 0xa8, 0x23, 0xa8, 0x22, 0xa8, 0x23, 0xb0, 0x42, 0xa8, 0x02, 0xa8, 0x22, 0xa8, 0x62, 0xa8, 0x43, 0xb0, 0x42, 0xa8, 0x02, 0xa8, 0x83, 0xa8, 0xc3, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x01, 0xb8, 0x00, 0x98, 0x00, 0xa8, 0x21, 0xb8, 0x21, 0xc0, 0x21, 0xc8, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x01, 0xd8, 0x01, 0xd0, 0x21, 0xc8, 0x21, 0xc8, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x21, 0xd0, 0x61, 0xd0, 0x81, 0xc8, 0x81, 0xc0, 0x40, 0xb0, 0x20, 0xa8, 0x21, 0xb8, 0x43, 0xb0, 0x00, 0x78, 0xa4, 0x88, 0x26, 0xa9, 0x46, 0xc1, 0xc3, 0xc0, 0x45, 0xd1, 0x86, 0xc9, 0x00, 0x98, 0xea, 0xc2, 0x1b, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x9a, 0xfe, 0x8a, 0xba, 0x83, 0xc8, 0x61, 0xe0, 0x40, 0xe0, 0x20, 0xe0, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x40, 0xd8, 0x20, 0xd0, 0x20, 0xd0, 0x20, 0xd0, 0x20, 0xd8, 0x20, 0xd8, 0x20, 0xd8, 0x00, 0xc8, 0x62, 0xd0, 0x82, 0xc8, 0x00, 0xa0, 0x00, 0x98, 0x41, 0x90, 0x00, 0x80, 0x02, 0x88, 0x02, 0x90, 0x01, 0x98, 0x00, 0xa0, 0x00, 0xb0, 0x01, 0xc8, 0x01, 0xd0, 0x00, 0xc8, 0x01, 0xc8, 0x22, 0xd0, 0x01, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x01, 0xb8, 0x21, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x22, 0xc8, 0x01, 0xc8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x01, 0xc8, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x02, 0xc8, 0x02, 0xc8, 0x00, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xb8, 0x01, 0xb0, 0x01, 0xb0, 0x00, 0xb0, 0x01, 0xb0, 0x00, 0xa8, 0x21, 0xc0, 0xc3, 0xd8, 0xa3, 0xd8, 0x82, 0xe0, 0x82, 0xe0, 0xa2, 0xe8, 0x82, 0xe8, 0xa2, 0xe8, 0xe3, 0xe0, 0xe3, 0xd8, 0xe3, 0xd8, 0xe3, 0xd8, 0x04, 0xe1, 0x04, 0xe1, 0x04, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x64, 0xd9, 0x85, 0xd1, 0x84, 0xd1, 0x43, 0xc1, 0x23, 0xb9, 0xe4, 0xc0, 0xa7, 0xb1, 0x34, 0xed, 0xef, 0xbb, 0x00, 0x60, 0x00, 0x80, 0xa7, 0xb9, 0x86, 0xb9, 0xe4, 0xb0, 0x87, 0xb9, 0x46, 0x99, 0x71, 0xd4, 0xfb, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x9a, 0xfe, 0xab, 0xc2, 0x05, 0xd1, 0x04, 0xe9, 0xe3, 0xe8, 0x03, 0xe1, 0x23, 0xd9, 0x23, 0xd9, 0x23, 0xd9, 0x23, 0xd9, 0x23, 0xd9, 0x23, 0xd9, 0x43, 0xd9, 0x43, 0xd9, 0x43, 0xd9, 0x43, 0xd9, 0x43, 0xd9, 0x43, 0xd9, 0x43, 0xd9, 0x43, 0xd1, 0x43, 0xd1, 0x43, 0xd1, 0x43, 0xd9, 0x43, 0xd9, 0x23, 0xd9, 0x02, 0xd1, 0x85, 0xd9, 0x64, 0xd1, 0x20, 0xa8, 0x00, 0x98, 0x00, 0x90, 0x00, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xc0, 0x20, 0xc0, 0x40, 0xc8, 0x41, 0xc8, 0x61, 0xc8, 0x00, 0xb8, 0x21, 0xb8, 0x62, 0xc0, 0x41, 0xc0, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xc0, 0x20, 0xc0, 0x00, 0xb0, 0x61, 0xc8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x60, 0xc8, 0x20, 0xc8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x20, 0xc8, 0x20, 0xc8, 0x00, 0xc0, 0x20, 0xc8, 0x61, 0xc8, 0x61, 0xc8, 0x20, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x20, 0xc0, 0x20, 0xb0, 0x20, 0xa8, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa0, 0xe2, 0xc0, 0x64, 0xd1, 0x43, 0xd1, 0x63, 0xd1, 0x84, 0xd9, 0xa4, 0xe1, 0x84, 0xd9, 0x44, 0xd9, 0x65, 0xe1, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x65, 0xe9, 0x85, 0xe1, 0xa5, 0xd9, 0xc5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa6, 0xd9, 0x25, 0xc9, 0x08, 0xa2, 0x1b, 0xff, 0x7c, 0xff, 0xba, 0xfe, 0xaf, 0xc3, 0x00, 0x60, 0xc7, 0xa1, 0x29, 0xba, 0xe9, 0xc9, 0x4a, 0xba, 0xcb, 0xaa, 0x34, 0xd5, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xba, 0xfe, 0xcb, 0xba, 0x67, 0xd1, 0x87, 0xe9, 0x86, 0xe9, 0x85, 0xe9, 0xa5, 0xe1, 0xa5, 0xe1, 0xa5, 0xe1, 0xa5, 0xe1, 0xa5, 0xe1, 0xa5, 0xe1, 0x85, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xc5, 0xe1, 0xa5, 0xe1, 0x85, 0xd9, 0xa5, 0xd9, 0xe3, 0xc8, 0x82, 0xb8, 0xe3, 0xc0, 0xa3, 0xb0, 0xe4, 0xb8, 0xe3, 0xb8, 0xa2, 0xb8, 0xc2, 0xc0, 0xe2, 0xc8, 0xe2, 0xc8, 0xa1, 0xc0, 0xe2, 0xd0, 0xe2, 0xd0, 0xe3, 0xd0, 0xc2, 0xc8, 0xa2, 0xc0, 0x81, 0xc0, 0xe2, 0xd0, 0x02, 0xd9, 0xc1, 0xd0, 0xc1, 0xd0, 0xa1, 0xd0, 0xe2, 0xd8, 0xc2, 0xd0, 0xc2, 0xd0, 0xc2, 0xd0, 0xc2, 0xd0, 0xc1, 0xd0, 0xc1, 0xd0, 0xc1, 0xd0, 0xc1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xc1, 0xd0, 0xc2, 0xd0, 0xc1, 0xd0, 0xa1, 0xc8, 0x80, 0xc8, 0xa1, 0xc8, 0xc1, 0xd0, 0xa1, 0xd0, 0x80, 0xc8, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0xa1, 0xd0, 0xa1, 0xd0, 0xc1, 0xc8, 0xa1, 0xb8, 0xc1, 0xb8, 0xa1, 0xb8, 0x60, 0xb0, 0xe1, 0xb8, 0xa4, 0xd1, 0x63, 0xc9, 0x63, 0xc9, 0x84, 0xc9, 0xa4, 0xd1, 0xc5, 0xd1, 0xa4, 0xd1, 0x84, 0xc9, 0x65, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x65, 0xd9, 0x65, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x45, 0xd9, 0x85, 0xd9, 0x85, 0xe1, 0x44, 0xd9, 0x65, 0xe1, 0xa7, 0xe9, 0x05, 0xd1, 0xc7, 0x99, 0x1b, 0xff, 0xfe, 0xff, 0x9d, 0xff, 0x7d, 0xff, 0x38, 0xfe, 0x6d, 0xab, 0xc8, 0xa1, 0xc8, 0xb9, 0xe9, 0xa9, 0xab, 0xaa, 0xf0, 0xab, 0x3d, 0xff, 0x5d, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xfe, 0xcc, 0xba, 0xa8, 0xc9, 0xc8, 0xd9, 0xc7, 0xd9, 0xa7, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x86, 0xe1, 0x66, 0xe1, 0x66, 0xe1, 0x66, 0xe1, 0x66, 0xe1, 0x66, 0xe1, 0x66, 0xe1, 0x66, 0xe1, 0x86, 0xe1, 0x04, 0xd1, 0x45, 0xe1, 0xa7, 0xf1, 0x25, 0xd9, 0x66, 0xe9, 0x87, 0xe9, 0x66, 0xd9, 0x87, 0xd9, 0x86, 0xd1, 0x65, 0xd1, 0x85, 0xd9, 0x85, 0xd9, 0x64, 0xd1, 0xa5, 0xd9, 0x85, 0xd9, 0x24, 0xd1, 0x65, 0xd1, 0x65, 0xd9, 0x86, 0xd9, 0xa6, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x85, 0xe1, 0x44, 0xd9, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xd9, 0x64, 0xd9, 0x44, 0xd9, 0x44, 0xd9, 0x64, 0xd9, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x85, 0xe1, 0x85, 0xe1, 0x85, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x44, 0xe1, 0x44, 0xe1, 0x44, 0xe1, 0x44, 0xe1, 0x44, 0xe1, 0x44, 0xe1, 0x44, 0xe1, 0x44, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x24, 0xe1, 0x44, 0xe1, 0x44, 0xd9, 0x24, 0xd1, 0x45, 0xd9, 0x85, 0xe1, 0x24, 0xd1, 0x44, 0xd1, 0x65, 0xd1, 0x85, 0xd9, 0x85, 0xd1, 0x65, 0xd1, 0x85, 0xd1, 0x85, 0xd1, 0x85, 0xd1, 0x85, 0xd1, 0x65, 0xd1, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xd9, 0x66, 0xe1, 0x66, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x67, 0xf1, 0x07, 0xd9, 0x08, 0xaa, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xb7, 0xf5, 0xb0, 0xd3, 0xed, 0xba, 0x8f, 0xb3, 0x51, 0xac, 0x3d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0x8b, 0xa2, 0x03, 0x90, 0xc4, 0xa8, 0x83, 0xa8, 0x01, 0xb0, 0x01, 0xb8, 0x02, 0xc0, 0x01, 0xc0, 0x02, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x02, 0xc0, 0x01, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x01, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x01, 0xb8, 0x00, 0xb8, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xb0, 0x01, 0xc8, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x20, 0xb8, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb8, 0x40, 0xb8, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb8, 0x20, 0xb8, 0x20, 0xb8, 0x20, 0xb8, 0x20, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x20, 0xb8, 0x40, 0xb8, 0x20, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x20, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x21, 0xc0, 0x00, 0xb8, 0x21, 0xc0, 0x41, 0xc0, 0xa3, 0xc0, 0xa3, 0xc0, 0x82, 0xb8, 0x61, 0xb8, 0x62, 0xb8, 0x83, 0xb8, 0xa3, 0xb8, 0x63, 0xc0, 0x63, 0xc0, 0x83, 0xc0, 0x83, 0xc0, 0x83, 0xc0, 0x83, 0xc0, 0x63, 0xc0, 0x43, 0xc0, 0x42, 0xc0, 0x43, 0xc0, 0x42, 0xc0, 0x43, 0xc0, 0x43, 0xc0, 0x22, 0xc0, 0x43, 0xc8, 0x02, 0xc8, 0x01, 0xc0, 0x23, 0xc8, 0x04, 0xc0, 0xe8, 0x99, 0x7d, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0xfc, 0xfe, 0x59, 0xee, 0x7a, 0xee, 0x3c, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x5d, 0xff, 0x35, 0xe5, 0x32, 0xdc, 0x93, 0xec, 0xb2, 0xec, 0x92, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x73, 0xec, 0x53, 0xec, 0x33, 0xec, 0x33, 0xec, 0x53, 0xec, 0x53, 0xec, 0x73, 0xec, 0x73, 0xec, 0x92, 0xec, 0x92, 0xec, 0x92, 0xec, 0x72, 0xec, 0x72, 0xec, 0x71, 0xec, 0x71, 0xec, 0x52, 0xec, 0x52, 0xec, 0x52, 0xec, 0x72, 0xec, 0x72, 0xec, 0x71, 0xec, 0x91, 0xec, 0x91, 0xec, 0x71, 0xec, 0x71, 0xec, 0x71, 0xec, 0x71, 0xec, 0x52, 0xec, 0x51, 0xec, 0x31, 0xec, 0x31, 0xec, 0x31, 0xec, 0x31, 0xec, 0x11, 0xec, 0x11, 0xec, 0xaf, 0xe3, 0xcf, 0xe3, 0xcf, 0xe3, 0xd0, 0xe3, 0xd0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xd0, 0xeb, 0xaf, 0xe3, 0xaf, 0xe3, 0xaf, 0xe3, 0xaf, 0xe3, 0xaf, 0xe3, 0xcf, 0xe3, 0x8f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6f, 0xe3, 0x6e, 0xe3, 0x6e, 0xe3, 0x6e, 0xe3, 0x6e, 0xeb, 0x6e, 0xeb, 0x6e, 0xeb, 0x6e, 0xeb, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xec, 0xe2, 0xec, 0xe2, 0xec, 0xe2, 0xed, 0xe2, 0xec, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0x0d, 0xe3, 0x0d, 0xe3, 0x0d, 0xe3, 0x0d, 0xe3, 0x0d, 0xe3, 0x0d, 0xe3, 0x0c, 0xdb, 0x0c, 0xdb, 0xec, 0xe2, 0x0c, 0xe3, 0xec, 0xe2, 0xed, 0xe2, 0xb0, 0xcb, 0xde, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xbf, 0xff, 0x7e, 0xff, 0x5e, 0xff, 0x5e, 0xff, 0x5d, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x7e, 0xff, 0x5e, 0xff, 0x5e, 0xff, 0x7e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xdd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0x9d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x9d, 0xff, 0x9d, 0xff, 0x9d, 0xff, 0xbd, 0xff, 0x9d, 0xff, 0xbd, 0xff, 0x9d, 0xff, 0x9d, 0xff, 0x9d, 0xff, 0x9d, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x7e, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x9c, 0xff, 0x9c, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x9d, 0xff, 0x9c, 0xff, 0x9c, 0xff, 0x9c, 0xff, 0x9c, 0xff, 0x9c, 0xff, 0x9c, 0xff, 0x9c, 0xff, 0x9d, 0xff, 0x9c, 0xff, 0x9d, 0xff, 0x9c, 0xff, 0x9d, 0xff, 0x9c, 0xff, 0x7c, 0xff, 0x7c, 0xff, 0x7b, 0xff, 0x5c, 0xff, 0x1c, 0xff, 0x5e, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xef, 0xfe, 0xe7, 0xfe, 0xef, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-};
-
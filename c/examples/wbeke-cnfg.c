@@ -33,6 +33,8 @@
 #include <pico/stdlib.h>
 #include <hardware/uart.h>
 #include <hardware/irq.h>
+#include <pico/stdio_usb.h>
+#include "Format.h"
 #include "wbeke-ctrl.h"
 
 /**
@@ -60,6 +62,16 @@
 #define BUFZ                2048
 #define ATSENDSZ            256
 
+/**
+ * Screen dumps, see sendScreen()
+ */
+#define SCREEN_WIDTH        240
+#define SCREEN_HEIGHT       135
+#define RLE_CHUNK           1400    // Raw bytes a line, less than BUFZ as base64
+#define SEND_PROMPT_US      40000   // AT+CIPSEND to its data, as atwrite() waits
+#define SEND_GAP_US         240000  // Data to the next AT+CIPSEND
+#define SEND_BURST          256     // Bytes of a line a call, 22 ms at BAUD_RATE
+
 /**
  * Some telnet protocol magics
  */
@@ -315,28 +327,39 @@ static bool checkConnection(char* str)
     return connected;
 }
 
+static void sendFlush(void);
+
+/**
+ * Send a buffer as is to the connected client.
+ */
+static void atwrite(const char *buf, size_t len)
+{
+    sendFlush();
+
+    if (len > 0 && checkConnection(NULL) == true) {
+        sleep_ms(200);  // Avoid ESP8266 busy feedback
+        printf("AT+CIPSEND=0,%d\r\n", len);
+        sleep_ms(40);
+        uart_write_blocking(UART_ID, buf, len);
+        sleep_ms(40);
+    }
+}
+
 /**
  * Output a printf style readable strings for connected clients.
  */
 void atprintf(const char *format , ...)
 {
-    char txt[ATSENDSZ*2];
+    char txt[ATSENDSZ];
     size_t len;
     va_list arglist;
 
+    // Cut to what fits, see Format.h
     va_start(arglist, format);
-    vsprintf(txt, format, arglist);
+    len = Format_VString(txt, sizeof(txt), format, arglist);
     va_end(arglist);
 
-    len = strlen(txt);
-
-    if (len > 0 && len < sizeof(txt)/2 && checkConnection(NULL) == true) {
-        sleep_ms(200);  // Avoid ESP8266 busy feedback
-        printf("AT+CIPSEND=0,%d\r\n", len);
-        sleep_ms(40);
-        uart_write_blocking(UART_ID, txt, len);
-        sleep_ms(40);
-    }
+    atwrite(txt, len);
 }
 
 /**
@@ -408,6 +431,10 @@ static const char *userCmds[][3] = {
     {"scan",        "7",    "scan WiFi neighborhood"},
     {"join",        "8",    "join AP <ssid> <pwd>"},
     {"cjoin",       "9",    "commit join to new WiFi"},
+    {"stats",       "10",   "display counters, [reset] clears"},
+    {"screen",      "11",   "dump the display, see screen2png.py"},
+    {"mirror",      "12",   "toggle sending display changes"},
+    {"hz",          "13",   "line frequency period by period"},
 };
 
 enum userActions {
@@ -420,6 +447,10 @@ enum userActions {
     SCAN,
     JOIN,
     CJOIN,
+    STATS,
+    SCREEN,
+    MIRROR,
+    LINEHZ,
     NOACT
 };
 
@@ -447,16 +478,262 @@ static void doHelp()
             strcat(hbuf, "\t");
             strcat(hbuf, userCmds[i][2]);
             strcat(hbuf, "\r\n");
-            if (strlen(hbuf) >= ATSENDSZ) {
-                hbuf[ATSENDSZ] = '\0';
-                break;
-            }
         }
     }
-    atprintf("%s", hbuf);
+    atwrite(hbuf, strlen(hbuf));    // Longer than atprintf() takes
     prompt(400);
 }
 
+/**
+ * The display counters to the USB stdio only, the
+ * UART one is the AT port of the ESP8266.
+ */
+static void stdioPrintf(const char *format , ...)
+{
+    char txt[ATSENDSZ];
+    va_list arglist;
+
+    va_start(arglist, format);
+    Format_VString(txt, sizeof(txt), format, arglist);
+    va_end(arglist);
+
+#if LIB_PICO_STDIO_USB
+    stdio_usb.out_chars(txt, strlen(txt));
+#endif
+}
+
+/**
+ * Screen dumps.
+ * The display is sent as text lines a client can pick out of the
+ * telnet stream, tools/screen2png.py turns them into PNG files:
+ *   @W <width> <height>        a frame begins
+ *   @R <y> <rows> <base64>     whole rows from y, RLE coded
+ *   @E                         the frame is complete
+ * The rows are coded like tools/img2rle.py does it, a packet byte
+ * n < 0x80 is followed by n+1 literal pixels, n >= 0x80 by one pixel
+ * that repeats n-0x80+2 times. Pixels are RGB565, high byte first.
+ * The dirty bands come from the console grid, see displayChanged().
+ */
+static bool Mirror;
+static uint16_t Band[SCREEN_WIDTH*MIRROR_LINES];
+
+/**
+ * The frame being sent, a line at a time by serialMirror(). A line is
+ * announced with AT+CIPSEND and written in bursts on later calls when
+ * the ESP8266 is ready for it, so the render core never waits for it.
+ */
+static struct {
+    uint32_t Bands;         // Of the frame, MIRROR_LINES rows a bit, 0 if none
+    int Y;                  // The next row to send
+    bool Whole;             // A screen dump, @W goes first
+    int Len;                // The line announced, 0 if none
+    int Sent;               // Bytes of it written so far
+    uint32_t Due;           // Time of the next step
+} Send;
+static char SendLine[BUFZ];
+
+static const char * volatile Notice;   // For the client, see atnotice()
+
+/**
+ * Leave a notice for the connected client from the other core, the
+ * UART is written by the core serving the ESP8266 only. It is sent in
+ * turn with the frame lines by serialMirror(). The message must stay,
+ * a later notice replaces one not sent yet.
+ */
+void atnotice(const char *msg)
+{
+    Notice = msg;
+}
+
+/**
+ * RLE code a row of pixels, returns the bytes written to out.
+ * The pixels are kept in panel byte order and are copied as they are.
+ */
+static int rleRow(const uint16_t *row, int width, uint8_t *out)
+{
+    uint8_t *o = out;
+    int i = 0;
+
+    while (i < width) {
+        int n = 1;
+
+        while (i + n < width && row[i + n] == row[i] && n < 129) {
+            n++;
+        }
+        if (n > 1) {
+            *o++ = 0x80 + n - 2;
+            memcpy(o, &row[i], 2);
+            o += 2;
+            i += n;
+            continue;
+        }
+
+        // Literals up to the next pair of equal pixels
+        while (i + n < width && n < 128 && (i + n + 1 >= width || row[i + n] != row[i + n + 1])) {
+            n++;
+        }
+        *o++ = n - 1;
+        memcpy(o, &row[i], n*2);
+        o += n*2;
+        i += n;
+    }
+
+    return o - out;
+}
+
+/**
+ * An @R line in SendLine, the raw bytes base64 coded.
+ */
+static int chunkLine(int y, int rows, const uint8_t *raw, int len)
+{
+    static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    char *o;
+
+    o = SendLine + Format_String(SendLine, sizeof(SendLine), "@R %d %d ", y, rows);
+    for (int i = 0; i < len; i += 3) {
+        uint32_t v = raw[i] << 16;
+
+        if (i + 1 < len) v |= raw[i+1] << 8;
+        if (i + 2 < len) v |= raw[i+2];
+        *o++ = b64[(v >> 18) & 0x3f];
+        *o++ = b64[(v >> 12) & 0x3f];
+        *o++ = i + 1 < len? b64[(v >> 6) & 0x3f] : '=';
+        *o++ = i + 2 < len? b64[v & 0x3f] : '=';
+    }
+    *o++ = '\r';
+    *o++ = '\n';
+
+    return o - SendLine;
+}
+
+/**
+ * The next line of the frame in SendLine, as many changed rows as fit
+ * or the @E that ends the frame. Returns its length.
+ */
+static int nextLine(void)
+{
+    static uint8_t raw[RLE_CHUNK];
+    uint8_t row[SCREEN_WIDTH*2 + SCREEN_WIDTH/128 + 1];
+    int len = 0, first, y;
+
+    if (Send.Whole == true) {
+        Send.Whole = false;
+        return Format_String(SendLine, sizeof(SendLine), "\r\n@W %d %d\r\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+
+    // To the next changed band
+    while (Send.Y < SCREEN_HEIGHT && (Send.Bands & (1u << (Send.Y / MIRROR_LINES))) == 0) {
+        Send.Y += MIRROR_LINES - Send.Y % MIRROR_LINES;
+    }
+    if (Send.Y >= SCREEN_HEIGHT) {
+        Send.Bands = 0;
+        return Format_String(SendLine, sizeof(SendLine), "@E\r\n");
+    }
+
+    // Adjacent bands go together
+    for (first = y = Send.Y; y < SCREEN_HEIGHT && (Send.Bands & (1u << (y / MIRROR_LINES))); y++) {
+        int n;
+
+        if (y == first || y % MIRROR_LINES == 0) {
+            int top = y - y % MIRROR_LINES;
+
+            displayRows(top, SCREEN_HEIGHT - top < MIRROR_LINES? SCREEN_HEIGHT - top : MIRROR_LINES, Band);
+        }
+        n = rleRow(&Band[(y % MIRROR_LINES)*SCREEN_WIDTH], SCREEN_WIDTH, row);
+        if (len + n > (int)sizeof(raw)) {
+            break;
+        }
+        memcpy(&raw[len], row, n);
+        len += n;
+    }
+    Send.Y = y;
+
+    return chunkLine(first, y - first, raw, len);
+}
+
+/**
+ * Write out a line that is announced already, anything else sent to
+ * the ESP8266 has to wait for it.
+ */
+static void sendFlush(void)
+{
+    while (Send.Len > 0) {
+        serialMirror();
+    }
+}
+
+/**
+ * Begin sending a frame of some bands, or of all with an @W first.
+ */
+static void sendFrame(uint32_t bands, bool whole)
+{
+    sendFlush();
+    Send.Bands = bands;
+    Send.Whole = whole;
+    Send.Y = 0;
+}
+
+/**
+ * The whole display as one frame.
+ */
+static void sendScreen(void)
+{
+    (void)displayChanged();
+    sendFrame((1u << ((SCREEN_HEIGHT + MIRROR_LINES - 1) / MIRROR_LINES)) - 1, true);
+}
+
+/**
+ * Take the next step of sending a frame if it is time for it, it
+ * waits no longer than a SEND_BURST takes on the UART. Called from the thread that renders the display in every
+ * pass, in mirror mode it also begins a frame of the bands changed
+ * since the last one.
+ */
+void serialMirror(void)
+{
+    uint32_t now = time_us_32();
+    const char *msg;
+    uint32_t bands;
+
+    if ((int32_t)(now - Send.Due) < 0) {
+        return;
+    }
+
+    // The ESP8266 takes the announced line, a burst a call as the UART FIFO is off
+    if (Send.Len > 0) {
+        int n = Send.Len - Send.Sent < SEND_BURST? Send.Len - Send.Sent : SEND_BURST;
+
+        uart_write_blocking(UART_ID, (const uint8_t *)SendLine + Send.Sent, n);
+        Send.Sent += n;
+        if (Send.Sent == Send.Len) {
+            Send.Len = 0;
+            Send.Due = now + SEND_GAP_US;
+        }
+        return;
+    }
+
+    if (checkConnection(NULL) == false) {
+        Mirror = false;
+        Send.Bands = 0;
+        Notice = NULL;
+        return;
+    }
+    if ((msg = Notice) != NULL) {
+        Notice = NULL;
+        Send.Len = Format_String(SendLine, sizeof(SendLine), "%s", msg);
+    } else {
+        if (Send.Bands == 0) {
+            if (Mirror == false || (bands = displayChanged()) == 0) {
+                return;
+            }
+            sendFrame(bands, false);
+        }
+        Send.Len = nextLine();
+    }
+    Send.Sent = 0;
+    printf("AT+CIPSEND=0,%d\r\n", Send.Len);
+    Send.Due = now + SEND_PROMPT_US;
+}
+
 /**
  * Parse the user commands and execute them accordingly.
  */
@@ -494,6 +771,9 @@ static int parseCommand(char* str)
         }
     }
 
+    // The ESP8266 may be waiting for a line of a frame
+    sendFlush();
+
     switch(action)
     {
         static char ssid[60];
@@ -511,7 +791,8 @@ static int parseCommand(char* str)
                         closeConnection();
                         serialChatRestart(false);
                     break;
-        case QUIT:      closeConnection();
+        case QUIT:      Mirror = false;
+                        closeConnection();
                     break;
         case GETIP:     printf("AT+CIFSR\r\n");
                     break;
@@ -542,6 +823,25 @@ static int parseCommand(char* str)
                             prompt(100);
                         }
                     break;
+        case STATS:     atprintf("\r\n");
+                        displayStats(stdioPrintf, false);
+                        displayStats(atprintf, strstr(ptr, "reset") != NULL);
+                        prompt(100);
+                    break;
+        case SCREEN:    sendScreen();
+                        prompt(100);
+                    break;
+        case MIRROR:    Mirror = !Mirror;
+                        atprintf("\r\nmirror %s\r\n", Mirror == true? "on" : "off");
+                        if (Mirror == true) {
+                            sendScreen();
+                        }
+                        prompt(100);
+                    break;
+        case LINEHZ:    atprintf("\r\n");
+                        lineHzStats(atprintf);
+                        prompt(100);
+                    break;
         default:        atprintf("%s: Unknown command\r\n", ptr);
                         prompt(200);
                     break; 
@@ -35,7 +35,7 @@
 #include <pico/bootrom.h>
 #include "EPD_Test.h"
 #include "LCD_1in14.h"
-#include "wb50bcd.h"
+#include "Format.h"
 #include "wbeke-ctrl.h"
 
 /**
@@ -51,12 +51,11 @@
 #define DIRECT_HZ
 
 #ifdef DIRECT_HZ
-#include <hardware/pwm.h>
-#include <hardware/clocks.h>
 #include <pico/multicore.h>
 #define HZ_MIN              45      // Adjust to equipment tolerances, typically the charger/inverter.
 #define HZ_MAX              65      // Anything outside this band will cause a shutdown of the generator.
-#define THZDELTA            2       // Tolerant time window (x*1250ms) to be out of bound for Hz/min-max (RPM drift)
+#define THZDELTA            2500    // Tolerant time window (ms) to be out of bound for Hz/min-max (RPM drift)
+#define HZ_CYCLES           2       // Mains cycles per measurement
 #define FLAG_VALUE          123     // Multicore check flag
 #endif
 
@@ -71,22 +70,13 @@
 /**
  * Display properties
  */
-#define MAX_CHAR            21
-#define MAX_LINES           7
-#define FONT                Font16
 #define DEF_PWM             50      // Display brightness
 #define LOW_PWM             4
-#define HDR_OK              GREEN
-#define HDR_ERROR           0xF8C0  // Reddish
 
 #define POLLRATE            250     // Main loop interval in ms
 #define ON                  1
 #define OFF                 0
 
-static UWORD *BlackImage;
-static char HdrStr[100]     = { "Header" };
-static int HdrTxtColor      = HDR_OK;
-static bool FirstLogline    = true;
 static bool MonFlag         = false;
 static bool RemoteEnable    = false;
 static bool RemoteRerun     = false;
@@ -107,132 +97,11 @@ static const uint OffPin =          7;  // On control Panel
 static const uint PsuPin =          6;  // Persistent power signal
 #ifdef DIRECT_HZ
 static const uint HzmeasurePin =    5;  // Square wave 50/60Hz feed
-static uint16_t LineFreq =          0;  // Live frequency
+static uint16_t LineFreq =          0;  // Live frequency in centi-Hz
 #else
 static const uint RunPin =          21; // GPIO level logic feed
 #endif
 
-/**
- * Format the text header.
- */
-static void printHdr(const char *format , ...)
-{
-    char txt[MAX_CHAR*2];
-    va_list arglist;
-
-    va_start(arglist, format);
-    vsprintf(txt, format, arglist);
-    va_end(arglist);
-
-    txt[MAX_CHAR] = '\0';
-
-    // Center align and trim with white spaces
-    int padlen = (MAX_CHAR - strlen(txt)) / 2;
-    sprintf(HdrStr, "%*s%s%*s", padlen, "", txt, padlen, "");
-  
-    Paint_DrawString_EN(4, 0, HdrStr, &FONT, HdrTxtColor, BLACK);
-
-    // Refresh the picture in RAM to LCD
-    LCD_1IN14_Display(BlackImage);
-
-}
-
-/**
- * Text display with colored fixed header and scrolled text.
- */
-void printLog(const char *format , ...)
-{
-    static char buf[100];
-    va_list arglist;
-    va_start(arglist, format);
-    vsprintf(buf, format, arglist);
-    va_end(arglist);
-
-    int curLine;
-    static char lines[MAX_LINES][MAX_CHAR+1];
-    if (FirstLogline == true) {
-        for (int i=0; i <MAX_LINES; i++) {
-            memset(lines[i], 0, MAX_CHAR);
-        }
-
-        FirstLogline = false;
-    }
-
-    buf[MAX_CHAR-1] = '\0';
-    int blenght = (int)strlen(buf);
-
-    // To stdio serial also
-    printf("%s\r\n", buf);
-
-    for (curLine=0; curLine <MAX_LINES; curLine++) {
-        if (lines[curLine][0] == (unsigned char)0x0) {
-            strncpy(lines[curLine], buf, blenght < MAX_CHAR? blenght: MAX_CHAR);
-            break;
-        }
-
-        // Scroll
-        if (curLine >= MAX_LINES-1) {
-            Paint_Clear(WHITE);
-            for (curLine=1; curLine <MAX_LINES; curLine++) {
-                strncpy(lines[curLine-1], lines[curLine], MAX_CHAR);
-            }
-            strncpy(lines[MAX_LINES-1], buf, blenght < MAX_CHAR? blenght: MAX_CHAR);
-        }
-    }
-
-    // Print header and text
-    for (curLine=0; curLine <MAX_LINES; curLine++) {
-            if (curLine == 0) { // Plug in the header first
-                Paint_DrawString_EN(4, 0, HdrStr, &FONT, HdrTxtColor, BLACK);
-            }
-            if (lines[curLine][0] != (unsigned char)0x0) {
-                Paint_DrawString_EN(1, (curLine+1)*16, lines[curLine], &FONT, WHITE, BLACK);
-            }
-
-    }
-
-    // Refresh the picture in RAM to LCD
-    LCD_1IN14_Display(BlackImage);
-
-}
-
-static void clearLog(void)
-{
-    HdrTxtColor = HDR_OK;
-    FirstLogline = true;
-    Paint_Clear(WHITE);
-}
-
-/**
- * Display initialization.
- * Display: https://www.waveshare.com/wiki/Pico-LCD-1.14 (V1)
- * SDK; https://www.waveshare.com/w/upload/2/28/Pico_code.7z
- */
-static int initDisplay(void)
-{
-    if (DEV_Module_Init() != 0) {
-        return -1;
-    }
-
-    // LCD Init
-    LCD_1IN14_Init(HORIZONTAL);
-    LCD_1IN14_Clear(WHITE);
-
-    UDOUBLE Imagesize = LCD_1IN14_HEIGHT*LCD_1IN14_WIDTH*2;
-
-    if((BlackImage = (UWORD *)malloc(Imagesize)) == NULL) {
-        return -1;
-    }
-
-    // Create a new image cache named IMAGE_RGB and fill it with white
-    Paint_NewImage((UBYTE *)BlackImage, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, 0, WHITE);
-    Paint_SetScale(65);
-    Paint_SetRotate(ROTATE_0);
-
-    return 0;
-}
-
-
 /**
  * Check the displays' stop button and the panels' off button.
  */
@@ -400,47 +269,20 @@ static void gpioInit(void)
  * power line.
  * This sine wave should then be represented as
  * a square wave stream (around 2.5v peak) to the
- * PWM B pin of the Pico, i.e a Schmittrigger
+ * GP5 pin of the Pico, i.e a Schmittrigger
  * circuit function to feed GP5.
- */
-static uint16_t measureFrequency(uint gpio, int pollRate)
-{
-
-    uint slice_num;
-    static bool init;
-
-    if (init == false) {
-        // Only the PWM B pins can be used as inputs.
-        assert(pwm_gpio_to_channel(gpio) == PWM_CHAN_B);
-        slice_num = pwm_gpio_to_slice_num(gpio);
-
-        // Count once for every cycles the PWM B input is high
-        pwm_config cfg = pwm_get_default_config();
-        pwm_config_set_clkdiv_mode(&cfg, PWM_DIV_B_RISING);
-        pwm_config_set_clkdiv(&cfg, 1.f);   // Set by default, increment count for each rising edge
-        pwm_init(slice_num, &cfg, false);   // False means don't start pwm
-        gpio_set_function(gpio, GPIO_FUNC_PWM);
-        init = true;
-    }
-
-    pwm_set_counter(slice_num, 0);
-
-    pwm_set_enabled(slice_num, true);
-    sleep_ms(pollRate);
-    pwm_set_enabled(slice_num, false);
-
-    return (uint16_t)pwm_get_counter(slice_num) * (1000/pollRate);
-
-}
-
-/**
- * The thread entry for the measureFrequency() function.
+ * A PIO state machine timestamps the edges and DMA
+ * stores the stamps, see wbeke-hz.c, so nothing waits
+ * for the feed here. The time of HZ_CYCLES whole periods
+ * gives the frequency in centi-Hz, 0 when the feed is gone.
  * Be somewhat tolerant for temporary RPM drifts.
  */
 static void core1Thread(void)
 {
 
-    int retry = THZDELTA;
+    LINE_HZ hz;
+    uint32_t drift = 0;     // When the frequency left the band
+    bool out = false;
     int8_t byte = 0;
 
     multicore_fifo_push_blocking(FLAG_VALUE);
@@ -449,6 +291,13 @@ static void core1Thread(void)
 
     if (g == FLAG_VALUE) {
 
+        // The display is rendered here from now on
+        renderTakeOver();
+
+        if (lineHzInit(HzmeasurePin) == false) {
+            printLog("Cannot measure Hz");
+        }
+
         while(1) {
 
             if (RemoteEnable == true) { // Allow interaction if stopped
@@ -467,25 +316,40 @@ static void core1Thread(void)
                     }
                     continue;
                 }
+                renderService();
                 sleep_ms(4);
             }
 
-            int f = measureFrequency(HzmeasurePin, 1000);
+            // The display and its mirror are served until there is a new measurement
+            if (lineHzUpdate(&hz, HZ_CYCLES) == false) {
+                serialMirror();
+                if (renderService() == false) {
+                    sleep_ms(1);
+                }
+                continue;
+            }
+
+            int f = hz.CentiHz;
 
-            if (f > HZ_MAX || f < HZ_MIN) {
-                if (retry-- >= 0) {   // Hz drift handling for whatever reason
-                    //printLog("drift=%d/%d", retr, f);
-                    sleep_ms(250);
+            if (f > HZ_MAX*100 || f < HZ_MIN*100) {
+                // Hz drift handling for whatever reason
+                if (out == false) {
+                    drift = time_us_32();
+                    out = true;
+                }
+                if (time_us_32() - drift < THZDELTA * 1000) {
                     continue;
                 }
+            } else {
+                out = false;
             }
-            retry = THZDELTA;
 
             LineFreq = f;   // Enter result to global space
         }
 
     } else {
-            printLog("Cannot run core1");
+            // Not the render core, stdio only
+            printf("Cannot run core1\r\n");
     }
 
 }
@@ -504,9 +368,12 @@ static bool wbekeIsRunning(int pollRate)
     sleep_ms(pollRate);
 
 #ifdef DIRECT_HZ
-    if (LineFreq > HZ_MAX || LineFreq < HZ_MIN) {
+    if (LineFreq > HZ_MAX*100 || LineFreq < HZ_MIN*100) {
         if (MonFlag == true) {
-            printLog("Out of Hz band f=%d", LineFreq);
+            char hz[12];
+
+            Format_Fixed(hz, sizeof(hz), LineFreq, 2);
+            printLog("Out of Hz band f=%s", hz);
         }
         return false;
     }
@@ -543,8 +410,7 @@ static void wbekeCtrlRun(bool reRun)
         gpioInit();
     }
 
-    HdrTxtColor = HDR_OK;
-    FirstLogline = true;
+    clearLog();
     RemoteRerun = false;
     RemoteEnable = true;
     RemoteStop = false;  
@@ -552,11 +418,8 @@ static void wbekeCtrlRun(bool reRun)
     DEV_SET_PWM(DEF_PWM);
 
     // Splash screen
-    sprintf(versionString, "V%d.%d", WesterBekeCtrl_VERSION_MAJOR, WesterBekeCtrl_VERSION_MINOR);
-    Paint_DrawImage(wb50bcd,0,0,240,135);
-    Paint_DrawString_EN(2, 118, versionString , &FONT, WHITE, BLACK);
-    Paint_DrawString_EN(194, 118, GTYPE , &FONT, WHITE, BLACK);
-    LCD_1IN14_Display(BlackImage);
+    Format_String(versionString, sizeof(versionString), "V%d.%d", WesterBekeCtrl_VERSION_MAJOR, WesterBekeCtrl_VERSION_MINOR);
+    showSplash(versionString);
 
 #ifdef DIRECT_HZ
     if (reRun == false) {
@@ -566,10 +429,12 @@ static void wbekeCtrlRun(bool reRun)
         uint32_t g = multicore_fifo_pop_blocking();
 
         if (g != FLAG_VALUE) {
-            HdrTxtColor = HDR_ERROR;
+            setHdrColor(HDR_ERROR);
             printLog("%d-%d Hz sens FAILED");
             while(1) sleep_ms(2000);
         } else {
+            // Leave the rendering to core1, printLog() etc. return at once
+            renderHandOver();
             multicore_fifo_push_blocking(FLAG_VALUE);
             sleep_ms(2000);
         }
@@ -584,7 +449,7 @@ static void wbekeCtrlRun(bool reRun)
 #if 0
     while(1) {
         sleep_ms(250);
-        printLog("LineFreq=%d", LineFreq);
+        printLog("LineFreq=%d", LineFreq / 100);
     }
 #endif
 
@@ -592,8 +457,8 @@ static void wbekeCtrlRun(bool reRun)
 
     for (int i=0; i < 16; i++) {    // Allow abort
         if (gpio_get(StopButt) == false || RemoteStop == true) {
-            Paint_Clear(WHITE);
-            HdrTxtColor = HDR_ERROR;
+            clearLog();
+            setHdrColor(HDR_ERROR);
             printHdr("User abort");
             printLog("Start aborted!");
             return;
@@ -601,7 +466,7 @@ static void wbekeCtrlRun(bool reRun)
         sleep_ms(250);
     }
 
-    Paint_Clear(WHITE);
+    clearLog();
 
     // Leave PSU control to panel buttons
     persistentPsu(OFF);
@@ -640,7 +505,7 @@ static void wbekeCtrlRun(bool reRun)
 
     runFlag = 3;    // retry
 
-    atprintf("** remote input disabled during engine runtime **\r\n");
+    atnotice("** remote input disabled during engine runtime **\r\n");
     RemoteEnable = false;
 
     while(runFlag-- > 0 && !wbekeIsRunning(POLLRATE)) {
@@ -649,6 +514,7 @@ static void wbekeCtrlRun(bool reRun)
 
         printLog("Preheat: %d seconds", preHeatInterval);
         gpio_put(PreheatPin, ON);
+        showStatus(STATUS_PREHEAT, true);
 
         for (int i=0; i < preHeatInterval*4; i++) {
             if (stopButton()) {
@@ -661,6 +527,7 @@ static void wbekeCtrlRun(bool reRun)
         if (runFlag == -2) {
             printLog("Stop preheater now");
             gpio_put(PreheatPin, OFF);
+            showStatus(STATUS_PREHEAT, false);
             break;
         }
 
@@ -668,6 +535,7 @@ static void wbekeCtrlRun(bool reRun)
 
         printLog("Cranker: %d seconds", STARTMOTOR_INTERVAL);
         gpio_put(StartPin, ON);
+        showStatus(STATUS_CRANK, true);
 
         for (int i=0; i < STARTMOTOR_INTERVAL*4; i++) {
 
@@ -678,8 +546,10 @@ static void wbekeCtrlRun(bool reRun)
 
         printLog("Stop cranker now");
         gpio_put(StartPin, OFF);
+        showStatus(STATUS_CRANK, false);
         printLog("Stop preheater now");
         gpio_put(PreheatPin, OFF);
+        showStatus(STATUS_PREHEAT, false);
 
         if (stopButton()) {
             runFlag = -2;
@@ -715,7 +585,7 @@ static void wbekeCtrlRun(bool reRun)
     }
 
     if (runFlag < 0) {
-        HdrTxtColor = HDR_ERROR;
+        setHdrColor(HDR_ERROR);
         if (runFlag == -1) {
             printHdr("Start Failed!");
             printLog("3 attempts failed");
@@ -725,11 +595,17 @@ static void wbekeCtrlRun(bool reRun)
     } else {
         clearLog();
         printHdr("Runtime monitoring");
+        showStatus(STATUS_RUN, true);
         runFlag = (RUN_INTERVAL*60)*mFact;
-        int lc = 0;
         int pollRate = 1000/POLLRATE;
         printLog("Runtime: %d minutes", runFlag/60);
         runFlag *= pollRate;
+#ifdef DIRECT_HZ
+        // Left on the screen after the run, to show how it ended
+        showTrend(HZ_MIN, HZ_MAX);
+        bool readout = false;
+        bool rerunHeld = false;
+#endif
 
         while(runFlag-- > 0) {
 
@@ -746,34 +622,42 @@ static void wbekeCtrlRun(bool reRun)
                 if (runFlag < 0) runFlag = 0;
             }
 
-            if ( timeAdj > 0) { // Force log update
-                lc = 60*pollRate;
-            }
-
             if (!wbekeIsRunning(POLLRATE) || stopButton()) {
-                HdrTxtColor = HDR_ERROR;
+                setHdrColor(HDR_ERROR);
                 printHdr("Premature stop");
                 printLog("Monitoring stopped");
                 runFlag = -2;
                 break;
             }
 
-            if (lc++ > 60*pollRate) {
-                lc = 0;
-                printLog("Time left: %d minutes", ((runFlag/pollRate) / 60)+1);
-            }
+            // Only posted, and redrawn, when the shown values change
+            showTimeLeft(runFlag/pollRate);
 #ifdef DIRECT_HZ
-            if (lc > 3*pollRate) {
-                static int lastHz;
-                if (lastHz != LineFreq) {
-                    printHdr("Monitoring@%dHz",LineFreq);
-                    lastHz = LineFreq;
+            showFrequency((LineFreq + 50) / 100);
+            addTrend((LineFreq + 50) / 100);
+            // The rerun button swaps the trend graph and the big readout
+            if (gpio_get(RerunButt) == false) {
+                if (rerunHeld == false) {
+                    readout = !readout;
+                    showReadout(readout);
                 }
+                rerunHeld = true;
+            } else {
+                rerunHeld = false;
             }
 #endif
         }
 
+#ifdef DIRECT_HZ
+        // A press that swapped the readout is no rerun, nor a flash mode request
+        while (rerunHeld == true && gpio_get(RerunButt) == false) {
+            sleep_ms(10);
+        }
+#endif
+
         MonFlag = false;
+        showStatus(STATUS_RUN, false);
+        showTimeLeft(-1);
 
         if (runFlag == -1) {
             printHdr("Runtime expired");
@@ -793,14 +677,16 @@ static void wbekeCtrlRun(bool reRun)
 void wbeke_ctrl(void)
 {
     bool reRun = false;
+    bool passive;           // Running, not started from here
     int tmo;
 
     while (1) {
         wbekeCtrlRun(reRun);
         reRun = true;
         tmo = 16;
+        passive = false;
         RemoteEnable = true;
-        atprintf("** remote input enabled **\r\n");
+        atnotice("** remote input enabled **\r\n");
 
         while (gpio_get(RerunButt)) {
 
@@ -811,30 +697,48 @@ void wbeke_ctrl(void)
             }
 
 #ifdef DIRECT_HZ
-            if (LineFreq > 10) {
+            if (LineFreq > 10*100) {
                 // Manually (re)started from wbekes' panel.
                 DEV_SET_PWM(DEF_PWM);
-                static int lastHz;
-                if (lastHz != LineFreq) {
-                    HdrTxtColor = HDR_OK;
+                if (passive == false) {
+                    char hz[12];
+
+                    setHdrColor(HDR_OK);
                     printHdr("Passive monitoring");
-                    printLog("Line frquency is %dHz", LineFreq);
-                    lastHz = LineFreq;
+                    Format_Fixed(hz, sizeof(hz), LineFreq, 2);
+                    printLog("Line frquency is %sHz", hz);
+                    showReadout(true);
+                    passive = true;
+                }
+                showFrequency((LineFreq + 50) / 100);
+            } else {
+                if (passive == true) {
+                    showReadout(false);
+                }
+                passive = false;
+                showFrequency(-1);
+                if (tmo-- <= 0) {
+                    DEV_SET_PWM(LOW_PWM);
                 }
-            } else if (tmo-- <= 0) {
-                DEV_SET_PWM(LOW_PWM);
             }
 
 #else
             if (gpio_get(RunPin) == true) {
                 DEV_SET_PWM(DEF_PWM);
-                HdrTxtColor = HDR_OK;
-                printHdr("Passive monitoring");
-                printLog("Generator running #%d", tmo);
-            } else if (tmo-- <= 0) {
-                DEV_SET_PWM(LOW_PWM);
+                if (passive == false) {
+                    setHdrColor(HDR_OK);
+                    printHdr("Passive monitoring");
+                    printLog("Generator running #%d", tmo);
+                    passive = true;
+                }
+            } else {
+                passive = false;
+                if (tmo-- <= 0) {
+                    DEV_SET_PWM(LOW_PWM);
+                }
             }
 #endif
+            showStatus(STATUS_RUN, passive);
             if (gpio_get(StopButt) == false || gpio_get(AddtimeButt) == false || gpio_get(SubtimeButt) == false) {
                 DEV_SET_PWM(DEF_PWM);   // React to user activity
                 tmo = 16;
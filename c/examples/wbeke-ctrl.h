@@ -9,11 +9,65 @@
 
 #define GTYPE   "BCD"
 
+/**
+ * Header colors
+ */
+#define HDR_OK      GREEN
+#define HDR_ERROR   0xF8C0  // Reddish
+
+#define MIRROR_LINES    16  // LCD rows per bit of displayChanged()
+
+/**
+ * Status icons, see showStatus()
+ */
+typedef enum {
+    STATUS_PREHEAT,
+    STATUS_CRANK,
+    STATUS_RUN,
+    STATUS_ICONS
+} STATUS_ICON;
+
+/**
+ * The line frequency over its latest periods, see lineHzWindow()
+ */
+typedef struct {
+    uint16_t Cycles;        // Periods, none when the feed is gone
+    uint16_t CentiHz;       // Mean frequency
+    uint32_t PeriodNs;      // Mean period
+    uint32_t MinNs;         // Shortest and longest period
+    uint32_t MaxNs;
+    uint32_t JitterNs;      // Mean deviation from PeriodNs
+} LINE_HZ;
+
+extern int initDisplay(void);
+extern void setHdrColor(int color);
+extern void printHdr(const char *format , ...);
 extern void printLog(const char *format , ...);
+extern void clearLog(void);
+extern void showSplash(const char *version);
+extern void showFrequency(int hz);
+extern void showTimeLeft(int seconds);
+extern void showStatus(STATUS_ICON icon, bool on);
+extern void showTrend(int low, int high);
+extern void addTrend(int hz);
+extern void showReadout(bool on);
+extern bool renderService(void);
+extern void renderHandOver(void);
+extern void renderTakeOver(void);
+extern void displayRows(uint16_t Ystart, uint16_t Lines, uint16_t *Band);
+extern uint32_t displayChanged(void);
+extern void serialMirror(void);
+extern void displayStats(void (*out)(const char *format , ...), bool clear);
 extern void serialChatInit(bool how);
 extern void serialChatRestart(bool full);
 extern int serialChat(uint8_t byte);
 extern void atprintf(const char *format , ...);
+extern void atnotice(const char *msg);
 extern uint8_t getchar_uart(void);
+extern bool lineHzInit(uint gpio);
+extern void lineHzWindow(LINE_HZ *hz, int cycles);
+extern bool lineHzUpdate(LINE_HZ *hz, int cycles);
+extern int lineHzPeriods(uint32_t *ns, int count);
+extern void lineHzStats(void (*out)(const char *format , ...));
 
 #endif
@@ -0,0 +1,1127 @@
+/*****************************************************************************
+* | File      	:   wbeke-disp.c
+* | Author      :   erland@hedmanshome.se
+* | Function    :   Westerbeke Marine Generator Starter and Monitor
+* | Info        :   The display console, a colored header, a scrolled log,
+* |                 a trend graph, a big readout and a status bar
+* | Depends     :   Rasperry Pi Pico, Waveshare Pico LCD 1.14 V1
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-08-22
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <pico/stdlib.h>
+#include <hardware/sync.h>
+#include "EPD_Test.h"
+#include "LCD_1in14.h"
+#include "GUI_Widget.h"
+#include "Format.h"
+#include "wb50bcd.h"
+#include "wbeke-ctrl.h"
+
+/**
+ * Display memory model.
+ * DISP_RGB565 keeps the picture in a 64 KB RGB565 frame buffer and
+ * sends its dirty areas. DISP_STRIP keeps no picture at all, the dirty
+ * bands of the screen are rebuilt from the console text below into two
+ * small strips, one is drawn while the other is sent by DMA.
+ * DISP_INDEXED keeps a 16 KB frame buffer of 4 bit palette indexes that
+ * are expanded to RGB565 as the rows go out, from the DMA interrupt.
+ * With DISP_FRAMES 2 it keeps two, one is drawn while the other is sent
+ * and refresh() swaps them, no update has to wait for the LCD unless
+ * the previous one is still going out.
+ */
+#define DISP_RGB565         1
+#define DISP_STRIP          2
+#define DISP_INDEXED        3
+#ifndef DISP_MODEL
+#define DISP_MODEL          DISP_STRIP
+#endif
+#define DISP_FRAMES         2       // DISP_INDEXED frame buffers, 1 or 2
+
+/**
+ * Bytes of RAM for the glyph cache, see Paint_SetGlyphCache(), 0 for
+ * none. A Font16 glyph takes 364 of them. It serves the RGB565 models,
+ * for the text on colored backgrounds, the log text on white is drawn
+ * transparently and straight from the font.
+ */
+#ifndef GLYPH_CACHE
+#define GLYPH_CACHE         8192
+#endif
+
+/**
+ * Display properties
+ */
+#define MAX_CHAR            21
+#define MAX_LINES           6
+#define FONT                Font16
+#define LINE_HEIGHT         16      // Header and log line pitch
+#define STRIP_LINES         8       // Rows per strip, DISP_STRIP only
+#define SPLASH_TEXT_Y       118     // Version text on the splash screen
+
+/**
+ * The console is a grid of text cells. Row 0 is the header and rows
+ * 1..MAX_LINES the log. Screen holds what should be shown and Glass
+ * what the LCD shows now, refresh() only redraws the cells that differ.
+ */
+#define GRID_ROWS           (MAX_LINES+1)
+#define HDR_X               4       // Left edge of the header cells
+#define LOG_X               1       // Left edge of the log cells
+
+/**
+ * The status bar below the grid is made of widgets, see GUI_Widget.h.
+ * They are set by render commands like the grid and only redrawn if
+ * what they show changed, refresh() commits them with the grid.
+ */
+#define STATUS_Y            (GRID_ROWS*LINE_HEIGHT + 3)
+#define STATUS_X            4       // Frequency at the left, time left at the right
+#define ICON_GAP            4
+
+/**
+ * The trend graph of the line frequency takes the bottom log rows while
+ * it is shown, the log scrolls in the rows above it. It gets a sample
+ * every poll of the runtime loop, four a second, so a column is about
+ * 3 seconds and 232 columns make some 11 minutes.
+ */
+#define TREND_ROWS          3
+#define TREND_PERIOD        12      // Samples per column
+
+/**
+ * The big readout of the frequency and the minutes left, in seven
+ * segment digits to be read from across the engine room. It goes over
+ * the trend graph and leaves READOUT_LOG log rows above it.
+ */
+#define READOUT_LOG         1
+#define READOUT_Y           ((READOUT_LOG+1)*LINE_HEIGHT + 8)
+#define DIGIT_WIDTH         32
+#define DIGIT_HEIGHT        64
+
+// Changed has a bit per grid row
+#if MIRROR_LINES != LINE_HEIGHT
+#error MIRROR_LINES must be LINE_HEIGHT
+#endif
+
+typedef struct {
+    char Ch;
+    UWORD Back;                     // Cell background, the text is black
+} CELL;
+
+static const CELL Blank     = { ' ', WHITE };
+
+#if DISP_MODEL != DISP_INDEXED && GLYPH_CACHE > 0
+static UDOUBLE GlyphArena[GLYPH_CACHE/4];
+#endif
+
+#if DISP_MODEL == DISP_RGB565
+static UWORD *BlackImage;
+#define DISP_FLUSH          LCD_1IN14_DisplayWindowsAsync
+#elif DISP_MODEL == DISP_INDEXED
+static UBYTE *BlackImage[DISP_FRAMES];
+static int Back;                    // The frame buffer drawn into
+#define DISP_FLUSH          LCD_1IN14_DisplayWindowsIndexedAsync
+static const UWORD Palette[] = { WHITE, BLACK, HDR_OK, HDR_ERROR };
+#else
+#define STRIPS              ((LCD_1IN14_WIDTH + STRIP_LINES-1) / STRIP_LINES)  // LCD rows in HORIZONTAL mode
+static UWORD Strip[2][LCD_1IN14_HEIGHT*STRIP_LINES];
+static UWORD StripX0[STRIPS];       // The columns of each strip to redraw
+static UWORD StripX1[STRIPS];
+static bool Redraw          = true; // The whole LCD, not just changed cells
+#endif
+
+/**
+ * What the screen shows
+ */
+static char HdrStr[100]     = { "Header" };
+static int HdrTxtColor      = HDR_OK;
+static bool HdrShown        = false;
+static char Lines[MAX_LINES][MAX_CHAR+1];
+static bool SplashOn        = false;
+static char SplashVersion[40];
+static CELL Screen[GRID_ROWS][MAX_CHAR];
+static CELL Glass[GRID_ROWS][MAX_CHAR];
+static uint32_t Changed;            // Bands redrawn, see displayChanged()
+static WIDGET_TEXT Frequency;
+static WIDGET_TEXT TimeLeft;
+static WIDGET_ICON Icons[STATUS_ICONS];
+static const char IconChars[STATUS_ICONS] = { 'P', 'C', 'R' };
+static WIDGET_TREND Trend;
+static WIDGET_DIGITS BigHz;
+static WIDGET_DIGITS BigMinutes;
+static bool TrendOn         = false;
+static bool ReadoutOn       = false;
+static int LogLines         = MAX_LINES;    // Fewer under the graph or the readout
+
+/**
+ * Render commands. The control logic posts them and returns, they are
+ * executed by renderService(), on the other core once renderHandOver()
+ * is done and right away before that. One core posts and one renders,
+ * so the queue needs no lock. The render core itself does not post, it
+ * renders its own commands right away, see renderSlot().
+ */
+#define RENDER_QUEUE        16      // Commands, a power of 2
+
+typedef enum {
+    RENDER_COLOR,                   // Header color
+    RENDER_HDR,                     // Header text
+    RENDER_LOG,                     // Log line
+    RENDER_CLEAR,                   // Clear screen and log
+    RENDER_SPLASH,                  // Splash screen, Text is the version
+    RENDER_FREQ,                    // Frequency in Hz, hidden if negative
+    RENDER_TIME,                    // Time left in seconds, hidden if negative
+    RENDER_STATUS,                  // Status icon, Value is icon*2 + on
+    RENDER_TREND,                   // Trend graph, Value is low << 8 | high, hidden if 0
+    RENDER_SAMPLE,                  // Trend graph sample in Hz
+    RENDER_READOUT,                 // Big readout, Value is on
+} RENDER_OP;
+
+typedef struct {
+    uint8_t Op;
+    int Value;                      // Header color, see RENDER_OP for the others
+    char Text[MAX_CHAR+1];
+} RENDER_CMD;
+
+static RENDER_CMD RenderQueue[RENDER_QUEUE];
+static volatile uint32_t RenderHead;    // Next to execute, moved by the render core
+static volatile uint32_t RenderTail;    // Next to post, moved by the posting core
+static volatile bool RenderRemote;      // The other core renders
+static uint RenderCore;                 // The other core, see renderHandOver()
+static RENDER_CMD RenderOwn;            // A command of the render core itself
+
+/**
+ * Render counters, see displayStats()
+ */
+static uint32_t RenderBatches;
+static uint32_t RenderCmds;
+static uint64_t RenderUs;
+static uint32_t RenderMaxUs;
+static uint32_t RenderDepth;            // Most commands waiting at once
+
+/**
+ * The status values last posted, only changes are posted. Like the
+ * widgets they are hidden after a clearLog(), the icons are unknown.
+ */
+static int PostedHz         = -1;
+static int PostedTime       = -1;
+static int8_t PostedIcons[STATUS_ICONS] = { -1, -1, -1 };
+
+static UWORD cellX(int row, int col)
+{
+    return (row == 0? HDR_X : LOG_X) + col * FONT.Width;
+}
+
+/**
+ * Fill a grid row from a text, the cells after it are blank.
+ */
+static void setRow(CELL *row, const char *txt, UWORD back)
+{
+    int len = strlen(txt);
+
+    for (int c=0; c < MAX_CHAR; c++) {
+        if (c < len) {
+            row[c].Ch = txt[c];
+            row[c].Back = back;
+        } else {
+            row[c] = Blank;
+        }
+    }
+}
+
+static void setBlank(CELL grid[GRID_ROWS][MAX_CHAR])
+{
+    for (int r=0; r < GRID_ROWS; r++) {
+        setRow(grid[r], "", WHITE);
+    }
+}
+
+static bool sameCell(const CELL *a, const CELL *b)
+{
+    return a->Ch == b->Ch && a->Back == b->Back;
+}
+
+/**
+ * The version text at the bottom of the splash screen.
+ */
+static void drawSplashText(void)
+{
+    Paint_DrawString_EN(2, SPLASH_TEXT_Y, SplashVersion , &FONT, WHITE, BLACK);
+    Paint_DrawString_EN(194, SPLASH_TEXT_Y, GTYPE , &FONT, WHITE, BLACK);
+}
+
+/**
+ * Rasterise one cell of Screen, the background included.
+ */
+static void drawCell(int row, int col)
+{
+    const CELL *cell = &Screen[row][col];
+    UWORD x = cellX(row, col);
+    UWORD y = row * LINE_HEIGHT;
+
+    if (cell->Back == FONT_BACKGROUND) {
+        // Paint_DrawChar() leaves a white background as it is
+        Paint_ClearWindows(x, y, x + FONT.Width, y + FONT.Height, cell->Back);
+        if (cell->Ch == ' ') {
+            return;
+        }
+    }
+    Paint_DrawChar(x, y, cell->Ch, &FONT, BLACK, cell->Back);
+}
+
+/**
+ * Draw the band Ystart..Yend-1 of the screen, only the cells that
+ * reach into the columns Xstart..Xend-1 matter.
+ */
+static void drawBand(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if (SplashOn == true) {
+        Paint_DrawImageRLE(&wb50bcd, 0, 0);
+        drawSplashText();
+    }
+
+    for (int r = Ystart / LINE_HEIGHT; r < GRID_ROWS && r * LINE_HEIGHT < Yend; r++) {
+        for (int c=0; c < MAX_CHAR; c++) {
+            if (cellX(r, c) + FONT.Width <= Xstart || cellX(r, c) >= Xend) {
+                continue;
+            }
+            // The splash shows through the blank cells
+            if (SplashOn == false || sameCell(&Screen[r][c], &Blank) == false) {
+                drawCell(r, c);
+            }
+        }
+    }
+
+    Widget_DrawArea(Xstart, Ystart, Xend, Yend);
+}
+
+/**
+ * Mark the bands of the rows Ystart..Yend-1 as changed.
+ */
+static void setChanged(UWORD Ystart, UWORD Yend)
+{
+    for (int b = Ystart / MIRROR_LINES; b * MIRROR_LINES < Yend; b++) {
+        Changed |= 1u << b;
+    }
+}
+
+#if DISP_MODEL == DISP_STRIP
+/**
+ * Add an area to the columns that the strips it covers redraw.
+ */
+static void stripArea(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    for (int s = Ystart / STRIP_LINES; s < STRIPS && s * STRIP_LINES < Yend; s++) {
+        if (StripX0[s] > Xstart) {
+            StripX0[s] = Xstart;
+        }
+        if (StripX1[s] < Xend) {
+            StripX1[s] = Xend;
+        }
+    }
+}
+#endif
+
+/**
+ * A widget box to bring out, see Widget_Commit().
+ */
+static void commitArea(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    setChanged(Ystart, Yend);
+#if DISP_MODEL == DISP_STRIP
+    stripArea(Xstart, Ystart, Xend, Yend);
+#else
+    Paint_ClearWindows(Xstart, Ystart, Xend, Yend, WHITE);
+    Widget_DrawArea(Xstart, Ystart, Xend, Yend);
+#endif
+}
+
+/**
+ * Bring the changed console cells out to the LCD.
+ * The transfers run by DMA so the caller can go on polling
+ * buttons and the line frequency meanwhile.
+ */
+static void refresh(void)
+{
+#if DISP_MODEL != DISP_STRIP
+#if DISP_MODEL == DISP_RGB565 || (DISP_MODEL == DISP_INDEXED && DISP_FRAMES == 1)
+    // The rows are read as they go out, keep them until they are sent
+    LCD_1IN14_Wait();
+#endif
+    for (int r=0; r < GRID_ROWS; r++) {
+        for (int c=0; c < MAX_CHAR; c++) {
+            if (sameCell(&Screen[r][c], &Glass[r][c]) == false) {
+                drawCell(r, c);
+                Glass[r][c] = Screen[r][c];
+                Changed |= 1u << r;
+            }
+        }
+    }
+    Widget_Commit(commitArea);
+
+#if DISP_MODEL == DISP_INDEXED && DISP_FRAMES == 2
+    const PAINT_AREA *Area;
+
+    // Send this frame, the other one is drawn next once it has caught up
+    if (Paint_GetDirty(&Area) > 0) {
+        LCD_1IN14_Wait();
+        Back ^= 1;
+        Paint_SwapImage(BlackImage[Back], DISP_FLUSH);
+    }
+#else
+    // Refresh the changed parts of the picture in RAM to LCD
+    Paint_FlushDirty(DISP_FLUSH);
+#endif
+#else
+    static int s;
+
+    for (int i=0; i < STRIPS; i++) {
+        StripX0[i] = Redraw == true? 0 : LCD_1IN14.WIDTH;
+        StripX1[i] = Redraw == true? LCD_1IN14.WIDTH : 0;
+    }
+
+    // The changed cells and widgets, in pixels
+    for (int r=0; r < GRID_ROWS; r++) {
+        for (int c=0; c < MAX_CHAR; c++) {
+            if (sameCell(&Screen[r][c], &Glass[r][c]) == false) {
+                stripArea(cellX(r, c), r * LINE_HEIGHT, cellX(r, c) + FONT.Width, (r+1) * LINE_HEIGHT);
+                Glass[r][c] = Screen[r][c];
+                Changed |= 1u << r;
+            }
+        }
+    }
+    Widget_Commit(commitArea);
+
+    for (UWORD y = 0; y < LCD_1IN14.HEIGHT; y += STRIP_LINES) {
+        UWORD yend = y + STRIP_LINES < LCD_1IN14.HEIGHT? y + STRIP_LINES : LCD_1IN14.HEIGHT;
+        UWORD xs = StripX0[y / STRIP_LINES], xe = StripX1[y / STRIP_LINES];
+
+        if (xs >= xe) {
+            continue;
+        }
+
+        /*
+         * The other strip may still be on its way out,
+         * this one was sent before that was started.
+         */
+        s ^= 1;
+        Paint_SelectBand((UBYTE *)Strip[s], y, yend - y);
+        Paint_Clear(WHITE);
+        drawBand(xs, y, xe, yend);
+        LCD_1IN14_DisplayBandAsync(xs, y, xe, yend, Strip[s]);
+    }
+    Redraw = false;
+#endif
+}
+
+/**
+ * Fill the header row of the grid.
+ */
+static void setHeader(void)
+{
+    if (HdrShown == true) {
+        setRow(Screen[0], HdrStr, HdrTxtColor);
+    } else {
+        setRow(Screen[0], "", WHITE);
+    }
+}
+
+/**
+ * The text header, centered.
+ */
+static void drawHdr(const char *txt)
+{
+    // Center align and trim with white spaces
+    Format_Center(HdrStr, sizeof(HdrStr), txt, MAX_CHAR);
+
+    HdrShown = true;
+    setHeader();
+}
+
+/**
+ * Fill the log rows of the grid, the rows under the trend graph or the
+ * readout stay blank while they are shown.
+ */
+static void setLog(void)
+{
+    for (int curLine=0; curLine <MAX_LINES; curLine++) {
+        setRow(Screen[curLine+1], curLine < LogLines? Lines[curLine] : "", WHITE);
+    }
+}
+
+/**
+ * Text display with colored fixed header and scrolled text.
+ */
+static void drawLog(const char *buf)
+{
+    int curLine;
+    int blenght = (int)strlen(buf);
+    int newLine = 0;
+
+    for (curLine=0; curLine <LogLines; curLine++) {
+        if (Lines[curLine][0] == (unsigned char)0x0) {
+            strncpy(Lines[curLine], buf, blenght < MAX_CHAR? blenght: MAX_CHAR);
+            newLine = curLine;
+            break;
+        }
+
+        // Scroll
+        if (curLine >= LogLines-1) {
+            for (curLine=1; curLine <LogLines; curLine++) {
+                strncpy(Lines[curLine-1], Lines[curLine], MAX_CHAR);
+            }
+            memset(Lines[LogLines-1], 0, MAX_CHAR);
+            strncpy(Lines[LogLines-1], buf, blenght < MAX_CHAR? blenght: MAX_CHAR);
+            newLine = LogLines-1;
+        }
+    }
+
+    if (newLine == 0) {
+        // Plug in the header first
+        HdrShown = true;
+        setHeader();
+    }
+    /*
+     * A scroll rewrites every log row of the grid, but only the cells
+     * whose character changed are rendered and sent. That is far less
+     * than moving the whole log pane, which the panel can't do in
+     * hardware anyway, its scroll axis is the X axis in HORIZONTAL mode.
+     */
+    setLog();
+}
+
+/**
+ * Share the log rows between the log and the trend graph or the big
+ * readout, the readout goes over the graph. The log keeps its last
+ * lines that still fit.
+ */
+static void setPane(void)
+{
+    int used = 0;
+
+    LogLines = ReadoutOn? READOUT_LOG : TrendOn? MAX_LINES - TREND_ROWS : MAX_LINES;
+    Widget_Show(&Trend.Base, TrendOn && !ReadoutOn);
+    Widget_Show(&BigHz.Base, ReadoutOn);
+    Widget_Show(&BigMinutes.Base, ReadoutOn);
+
+    while (used < MAX_LINES && Lines[used][0] != 0x0) {
+        used++;
+    }
+    if (used > LogLines) {
+        memmove(Lines[0], Lines[used - LogLines], LogLines * sizeof(Lines[0]));
+        memset(Lines[LogLines], 0, (MAX_LINES - LogLines) * sizeof(Lines[0]));
+    }
+    setLog();
+}
+
+/**
+ * Show the trend graph from low to high Hz under the log, or hide it
+ * with low and high 0.
+ */
+static void drawTrend(int low, int high)
+{
+    TrendOn = low != 0 || high != 0;
+    if (TrendOn == true) {
+        Widget_SetTrend(&Trend, low, high);
+    }
+    setPane();
+}
+
+/**
+ * Show or hide the big readout.
+ */
+static void drawReadout(bool on)
+{
+    ReadoutOn = on;
+    setPane();
+}
+
+/**
+ * Clear the screen and the log, the next
+ * output goes to the top line again.
+ */
+static void drawClear(void)
+{
+    HdrTxtColor = HDR_OK;
+    HdrShown = false;
+    SplashOn = false;
+    memset(Lines, 0, sizeof(Lines));
+    TrendOn = ReadoutOn = false;
+    LogLines = MAX_LINES;
+    setBlank(Screen);
+    Widget_Reset();
+    Widget_SetDigits(&BigHz, -1);
+    Widget_SetDigits(&BigMinutes, -1);
+#if DISP_MODEL == DISP_INDEXED
+    LCD_1IN14_Wait();
+    for (int i=0; i < DISP_FRAMES; i++) {
+        Paint_SelectImage(BlackImage[i]);
+        Paint_Clear(WHITE);
+    }
+    Paint_SelectImage(BlackImage[Back]);
+    Paint_ClearDirty();
+#elif DISP_MODEL != DISP_STRIP
+    LCD_1IN14_Wait();
+    Paint_Clear(WHITE);
+    Paint_ClearDirty();
+#endif
+
+    // The glass is cleared by a DMA fill, nothing left to draw or send
+    LCD_1IN14_Clear(WHITE);
+    setBlank(Glass);
+    Changed = 0xffffffff;
+}
+
+#if DISP_MODEL == DISP_INDEXED
+/**
+ * Produce a row of the splash screen, as the splash has far more
+ * colors than the palette it is streamed to the LCD in RGB565.
+ */
+static void splashRow(UWORD *Line, UWORD Xstart, UWORD Xend, UWORD Y, void *Arg)
+{
+    // Always the whole row, without an argument
+    (void)Xstart;
+    (void)Xend;
+    (void)Arg;
+
+    Paint_ExpandRLE(&wb50bcd, Y, Line);
+
+    if (Y >= SPLASH_TEXT_Y) {
+        Paint_SelectBand((UBYTE *)Line, Y, 1);
+        drawSplashText();
+    }
+}
+#endif
+
+/**
+ * The splash screen, stays under the log until clearLog().
+ * Blank cells let it show through, see refresh().
+ */
+static void drawSplash(const char *version)
+{
+    strncpy(SplashVersion, version, sizeof(SplashVersion)-1);
+    SplashOn = true;
+    Changed = 0xffffffff;
+#if DISP_MODEL == DISP_RGB565
+    LCD_1IN14_Wait();
+    Paint_DrawImageRLE(&wb50bcd, 0, 0);
+    drawSplashText();
+    Paint_FlushDirty(DISP_FLUSH);
+#elif DISP_MODEL == DISP_INDEXED
+    PAINT Frame = Paint;
+
+    // Borrow Paint for RGB565 rows, the frame buffer is left as it is
+    Paint_NewImage(NULL, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, 0, WHITE);
+    Paint_SetScale(65);
+    LCD_1IN14_DisplayRows(0, 0, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, splashRow, NULL);
+    Paint = Frame;
+
+    // The splash is on the LCD only, nothing is pending for it
+    Paint_ClearDirty();
+#else
+    Redraw = true;
+#endif
+}
+
+/**
+ * The line frequency in the status bar.
+ */
+static void drawFrequency(int hz)
+{
+    char txt[8];
+
+    if (hz < 0) {
+        Widget_SetText(&Frequency, NULL);
+    } else {
+        Format_String(txt, sizeof(txt), "%dHz", hz);
+        Widget_SetText(&Frequency, txt);
+    }
+    Widget_SetDigits(&BigHz, hz);
+}
+
+/**
+ * The run time left in the status bar, minutes and seconds.
+ */
+static void drawTimeLeft(int seconds)
+{
+    char txt[12];
+
+    if (seconds < 0) {
+        Widget_SetText(&TimeLeft, NULL);
+    } else {
+        Format_String(txt, sizeof(txt), "%d:%02d", seconds / 60, seconds % 60);
+        Widget_SetText(&TimeLeft, txt);
+    }
+    Widget_SetDigits(&BigMinutes, seconds < 0? -1 : seconds / 60);
+}
+
+/**
+ * Execute one render command.
+ */
+static void renderCmd(const RENDER_CMD *cmd)
+{
+    switch (cmd->Op) {
+        case RENDER_COLOR:
+            HdrTxtColor = cmd->Value;
+        break;
+        case RENDER_HDR:
+            drawHdr(cmd->Text);
+        break;
+        case RENDER_LOG:
+            drawLog(cmd->Text);
+        break;
+        case RENDER_CLEAR:
+            drawClear();
+        break;
+        case RENDER_SPLASH:
+            drawSplash(cmd->Text);
+        break;
+        case RENDER_FREQ:
+            drawFrequency(cmd->Value);
+        break;
+        case RENDER_TIME:
+            drawTimeLeft(cmd->Value);
+        break;
+        case RENDER_STATUS:
+            Widget_SetIcon(&Icons[cmd->Value / 2], cmd->Value % 2);
+        break;
+        case RENDER_TREND:
+            drawTrend(cmd->Value >> 8, cmd->Value & 0xff);
+        break;
+        case RENDER_SAMPLE:
+            Widget_AddTrend(&Trend, cmd->Value);
+        break;
+        case RENDER_READOUT:
+            drawReadout(cmd->Value != 0);
+        break;
+        default:
+        break;
+    }
+}
+
+/**
+ * Execute the posted render commands, then bring the LCD up to date
+ * once for all of them. Returns false if there was nothing to do.
+ */
+bool renderService(void)
+{
+    uint64_t start = DEV_Time_us();
+    uint32_t us;
+    bool done = false;
+
+    while (RenderHead != RenderTail) {
+        RENDER_CMD *cmd = &RenderQueue[RenderHead % RENDER_QUEUE];
+
+        __dmb();    // See the command as posted
+        renderCmd(cmd);
+        __dmb();    // Done with the slot before it is handed back
+        RenderHead++;
+        RenderCmds++;
+        done = true;
+    }
+
+    if (done == true) {
+        refresh();
+
+        us = DEV_Time_us() - start;
+        RenderBatches++;
+        RenderUs += us;
+        if (us > RenderMaxUs) {
+            RenderMaxUs = us;
+        }
+    }
+
+    return done;
+}
+
+/**
+ * Commands of the render core are not posted, the queue has only one
+ * producer and the render core would wait for itself on a full queue.
+ */
+static bool renderOwn(void)
+{
+    return RenderRemote == true && get_core_num() == RenderCore;
+}
+
+/**
+ * A free slot to post a command in. Only a full queue waits.
+ */
+static RENDER_CMD *renderSlot(RENDER_OP op)
+{
+    RENDER_CMD *cmd;
+
+    if (renderOwn() == true) {
+        RenderOwn.Op = op;
+        return &RenderOwn;
+    }
+
+    while (RenderTail - RenderHead == RENDER_QUEUE) {
+        if (RenderRemote == false) {
+            renderService();
+        } else {
+            tight_loop_contents();
+        }
+    }
+
+    cmd = &RenderQueue[RenderTail % RENDER_QUEUE];
+    cmd->Op = op;
+    return cmd;
+}
+
+/**
+ * Hand a filled slot to the renderer.
+ */
+static void renderPost(void)
+{
+    if (renderOwn() == true) {
+        // After what the other core posted before it
+        renderService();
+        renderCmd(&RenderOwn);
+        refresh();
+        RenderCmds++;
+        return;
+    }
+
+    __dmb();        // The command is written before it is seen
+    RenderTail++;
+
+    if (RenderTail - RenderHead > RenderDepth) {
+        RenderDepth = RenderTail - RenderHead;
+    }
+
+    if (RenderRemote == false) {
+        renderService();
+    }
+}
+
+/**
+ * From now on renderService() runs on the other core, which then calls
+ * renderTakeOver(). The LCD must not be busy from here on.
+ */
+void renderHandOver(void)
+{
+    renderService();
+    LCD_1IN14_Wait();
+    DEV_SPI_DMA_Release();
+    RenderCore = get_core_num() == 0? 1 : 0;
+    RenderRemote = true;
+}
+
+/**
+ * Make the calling core the render core, see renderHandOver().
+ */
+void renderTakeOver(void)
+{
+    DEV_SPI_DMA_Claim();
+}
+
+/**
+ * Rows Ystart..Ystart+Lines-1 of what the LCD shows, rebuilt from the
+ * console text into Band, LCD_1IN14.WIDTH pixels a row in RGB565 panel
+ * byte order. For screenshots, call it on the render core.
+ */
+void displayRows(UWORD Ystart, UWORD Lines, UWORD *Band)
+{
+    PAINT Frame = Paint;
+
+    // Borrow Paint like showSplash() does, nothing of it is sent
+    Paint_NewImage((UBYTE *)Band, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_SelectBand((UBYTE *)Band, Ystart, Lines);
+    Paint_Clear(WHITE);
+    drawBand(0, Ystart, LCD_1IN14.WIDTH, Ystart + Lines);
+    Paint = Frame;
+    Paint_ClearDirty();
+}
+
+/**
+ * The bands of MIRROR_LINES rows redrawn since the last call,
+ * bit n for the rows from n*MIRROR_LINES on.
+ */
+uint32_t displayChanged(void)
+{
+    uint32_t bands = Changed;
+
+    Changed = 0;
+    return bands;
+}
+
+/**
+ * Write the display counters to out, a line at a time.
+ * With clear set they start over from zero.
+ */
+void displayStats(void (*out)(const char *format , ...), bool clear)
+{
+    const LCD_1IN14_STATS *lcd = LCD_1IN14_GetStats();
+    const PAINT_STATS *paint = Paint_GetStats();
+
+    out("lcd: %lu frames %llu bytes\r\n", lcd->Frames, lcd->Bytes);
+    out("lcd flush: avg %lu us max %lu us\r\n",
+        lcd->Frames? (uint32_t)(lcd->FlushUs / lcd->Frames) : 0, lcd->FlushMaxUs);
+    out("paint: %lu glyphs %lu strings avg %lu us\r\n", paint->Glyphs, paint->Strings,
+        paint->Strings? (uint32_t)(paint->StringUs / paint->Strings) : 0);
+#if PAINT_PIXEL_STATS
+    out("paint pixels: %llu avg %lu cycles\r\n", paint->Pixels,
+        paint->Pixels? (uint32_t)(paint->PixelCycles / paint->Pixels) : 0);
+#endif
+    out("paint glyph cache: %lu hits %lu misses\r\n", paint->CacheHits, paint->CacheMisses);
+    out("render: %lu cmds %lu batches avg %lu us max %lu us depth %lu\r\n", RenderCmds, RenderBatches,
+        RenderBatches? (uint32_t)(RenderUs / RenderBatches) : 0, RenderMaxUs, RenderDepth);
+
+    if (clear == true) {
+        LCD_1IN14_ClearStats();
+        Paint_ClearStats();
+        RenderBatches = RenderCmds = RenderMaxUs = RenderDepth = 0;
+        RenderUs = 0;
+    }
+}
+
+/**
+ * Set the color of the text header.
+ */
+void setHdrColor(int color)
+{
+    RENDER_CMD *cmd = renderSlot(RENDER_COLOR);
+
+    cmd->Value = color;
+    renderPost();
+}
+
+/**
+ * Format the text header.
+ */
+void printHdr(const char *format , ...)
+{
+    RENDER_CMD *cmd = renderSlot(RENDER_HDR);
+    va_list arglist;
+
+    va_start(arglist, format);
+    Format_VString(cmd->Text, sizeof(cmd->Text), format, arglist);
+    va_end(arglist);
+
+    renderPost();
+}
+
+/**
+ * Format a log line, it is scrolled in below the header.
+ */
+void printLog(const char *format , ...)
+{
+    RENDER_CMD *cmd = renderSlot(RENDER_LOG);
+    va_list arglist;
+
+    va_start(arglist, format);
+    Format_VString(cmd->Text, sizeof(cmd->Text), format, arglist);
+    va_end(arglist);
+
+    // To stdio serial also
+    printf("%s\r\n", cmd->Text);
+
+    renderPost();
+}
+
+/**
+ * Clear the screen and the log.
+ */
+void clearLog(void)
+{
+    renderSlot(RENDER_CLEAR);
+    renderPost();
+
+    PostedHz = PostedTime = -1;
+    memset(PostedIcons, -1, sizeof(PostedIcons));
+}
+
+/**
+ * Show the splash screen with a version text.
+ */
+void showSplash(const char *version)
+{
+    RENDER_CMD *cmd = renderSlot(RENDER_SPLASH);
+
+    Format_String(cmd->Text, sizeof(cmd->Text), "%s", version);
+    renderPost();
+}
+
+/**
+ * The line frequency in the status bar, a negative one hides it.
+ */
+void showFrequency(int hz)
+{
+    if (hz < 0) {
+        hz = -1;
+    }
+    if (hz != PostedHz) {
+        RENDER_CMD *cmd = renderSlot(RENDER_FREQ);
+
+        cmd->Value = hz;
+        renderPost();
+        PostedHz = hz;
+    }
+}
+
+/**
+ * The run time left in the status bar, a negative one hides it.
+ */
+void showTimeLeft(int seconds)
+{
+    if (seconds < 0) {
+        seconds = -1;
+    }
+    if (seconds != PostedTime) {
+        RENDER_CMD *cmd = renderSlot(RENDER_TIME);
+
+        cmd->Value = seconds;
+        renderPost();
+        PostedTime = seconds;
+    }
+}
+
+/**
+ * Turn a status icon on or off.
+ */
+void showStatus(STATUS_ICON icon, bool on)
+{
+    if (icon < STATUS_ICONS && PostedIcons[icon] != on) {
+        RENDER_CMD *cmd = renderSlot(RENDER_STATUS);
+
+        cmd->Value = icon*2 + on;
+        renderPost();
+        PostedIcons[icon] = on;
+    }
+}
+
+/**
+ * Show an empty trend graph of the line frequency under the log, from
+ * low to high Hz. With low and high 0 it is hidden again, clearLog()
+ * hides it too.
+ */
+void showTrend(int low, int high)
+{
+    RENDER_CMD *cmd = renderSlot(RENDER_TREND);
+
+    cmd->Value = (low & 0xff) << 8 | (high & 0xff);
+    renderPost();
+}
+
+/**
+ * Add a line frequency sample to the trend graph, it redraws only the
+ * columns that change.
+ */
+void addTrend(int hz)
+{
+    RENDER_CMD *cmd = renderSlot(RENDER_SAMPLE);
+
+    cmd->Value = hz;
+    renderPost();
+}
+
+/**
+ * Show the frequency and the minutes left in big digits in place of
+ * the log and the trend graph, only the last log line stays. Only the
+ * digits that change are redrawn.
+ */
+void showReadout(bool on)
+{
+    RENDER_CMD *cmd = renderSlot(RENDER_READOUT);
+
+    cmd->Value = on;
+    renderPost();
+}
+
+/**
+ * Display initialization.
+ * Display: https://www.waveshare.com/wiki/Pico-LCD-1.14 (V1)
+ * SDK; https://www.waveshare.com/w/upload/2/28/Pico_code.7z
+ */
+int initDisplay(void)
+{
+    if (DEV_Module_Init() != 0) {
+        return -1;
+    }
+
+    // LCD Init
+    LCD_1IN14_Init(HORIZONTAL);
+    LCD_1IN14_Clear(WHITE);
+
+#if DISP_MODEL == DISP_RGB565
+    UDOUBLE Imagesize = LCD_1IN14_HEIGHT*LCD_1IN14_WIDTH*2;
+
+    if((BlackImage = (UWORD *)malloc(Imagesize)) == NULL) {
+        return -1;
+    }
+
+    // Create a new image cache named IMAGE_RGB and fill it with white
+    Paint_NewImage((UBYTE *)BlackImage, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_SetRotate(ROTATE_0);
+#elif DISP_MODEL == DISP_INDEXED
+    UDOUBLE Imagesize = (LCD_1IN14_HEIGHT+1)/2*LCD_1IN14_WIDTH;
+
+    for (int i=0; i < DISP_FRAMES; i++) {
+        if((BlackImage[i] = (UBYTE *)malloc(Imagesize)) == NULL) {
+            return -1;
+        }
+    }
+
+    // Two pixels a byte, the colors are mapped to the palette when drawn
+    Paint_NewImage(BlackImage[Back], LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, 0, WHITE);
+    Paint_SetScale(16);
+    Paint_SetRotate(ROTATE_0);
+    Paint_SetPalette(Palette, sizeof(Palette)/sizeof(Palette[0]));
+    LCD_1IN14_SetPalette(Palette, sizeof(Palette)/sizeof(Palette[0]));
+#else
+    // The picture is never held whole, refresh() draws it a band at a time
+    Paint_NewImage((UBYTE *)Strip[0], LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_SetRotate(ROTATE_0);
+    Paint_SelectBand((UBYTE *)Strip[0], 0, STRIP_LINES);
+#endif
+#if DISP_MODEL != DISP_INDEXED && GLYPH_CACHE > 0
+    Paint_SetGlyphCache(&FONT, GlyphArena, sizeof(GlyphArena));
+#endif
+
+    // The status bar, hidden until it is set
+    Widget_NewText(&Frequency, STATUS_X, STATUS_Y, 5, &FONT, BLACK, WHITE, WIDGET_LEFT);
+    Widget_NewText(&TimeLeft, LCD_1IN14.WIDTH - STATUS_X - 6*FONT.Width, STATUS_Y, 6, &FONT, BLACK, WHITE, WIDGET_RIGHT);
+    Widget_Add(&Frequency.Base);
+    Widget_Add(&TimeLeft.Base);
+    for (int i=0; i < STATUS_ICONS; i++) {
+        UWORD w = FONT.Width + 2 + ICON_GAP;
+
+        Widget_NewIcon(&Icons[i], (LCD_1IN14.WIDTH - STATUS_ICONS*w) / 2 + i*w, STATUS_Y,
+                       IconChars[i], &FONT, BLACK, HDR_OK, WHITE);
+        Widget_Add(&Icons[i].Base);
+    }
+    Widget_NewTrend(&Trend, HDR_X, (GRID_ROWS - TREND_ROWS) * LINE_HEIGHT + 2,
+                    LCD_1IN14.WIDTH - 2*HDR_X, TREND_ROWS * LINE_HEIGHT - 4,
+                    BLACK, HDR_ERROR, WHITE, TREND_PERIOD);
+    Widget_Add(&Trend.Base);
+    Widget_NewDigits(&BigHz, STATUS_X, READOUT_Y, 2, DIGIT_WIDTH, DIGIT_HEIGHT,
+                     "Hz", &FONT, BLACK, WHITE);
+    // The minutes end where the status bar ends
+    Widget_NewDigits(&BigMinutes, LCD_1IN14.WIDTH - STATUS_X - Widget_DigitsWidth(3, DIGIT_WIDTH, "m", &FONT),
+                     READOUT_Y, 3, DIGIT_WIDTH, DIGIT_HEIGHT, "m", &FONT, BLACK, WHITE);
+    Widget_Add(&BigHz.Base);
+    Widget_Add(&BigMinutes.Base);
+    Widget_Reset();
+
+    return 0;
+}
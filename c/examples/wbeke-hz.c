@@ -0,0 +1,319 @@
+/*****************************************************************************
+* | File      	:   wbeke-hz.c
+* | Author      :   erland@hedmanshome.se
+* | Function    :   Westerbeke Marine Generator Starter and Monitor
+* | Info        :   Line frequency from PIO timestamps of the feed edges,
+* |                 drained into a ring by DMA without the CPU
+* | Depends     :   Rasperry Pi Pico
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-16
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <pico/stdlib.h>
+#include <hardware/pio.h>
+#include <hardware/dma.h>
+#include <hardware/clocks.h>
+#include "Format.h"
+#include "wbeke-ctrl.h"
+#include "wbeke-hz.pio.h"
+
+#define HZ_PIO              pio0
+#define HZ_EDGE_CYCLES      3       // Not counted per edge, see wbeke-hz.pio
+#define HZ_RING_BITS        8       // Ring of 2^8 bytes, 64 stamps
+#define HZ_RING             (1 << (HZ_RING_BITS - 2))
+#define HZ_HISTORY          (HZ_RING - 8)   // Stamps read back, DMA may refill the rest meanwhile
+#define HZ_DMA_COUNT        0xffffffc0u     // Whole rings, 2.2 years of 60 Hz before a restart
+#define HZ_TIMEOUT          250     // No edge for this long (ms) is 0 Hz
+#define HZ_GLITCH           5000    // Edges closer than this (us) are noise
+#define HZ_STATS_PERIODS    8       // The latest periods listed by lineHzStats()
+
+/**
+ * The stamps are X of the state machine, a counter going down. DMA
+ * writes them round the ring, so stamp n of all so far is at n % HZ_RING.
+ */
+static uint32_t Ring[HZ_RING] __attribute__((aligned(HZ_RING * 4)));
+
+static bool Running;
+static uint DmaChan;
+static uint32_t Clock;              // State machine cycles per second
+static uint32_t GlitchCycles;
+static uint32_t TimeoutCycles;
+static uint32_t Base;               // Stamps of earlier DMA runs
+static uint32_t Seen;               // Stamps when the last one was seen
+static uint32_t SeenUs;
+static uint32_t Consumed;           // Stamps at the last lineHzUpdate() result
+static uint32_t ReportedUs;
+
+/**
+ * Stamps so far, the transfers of the DMA channel.
+ */
+static uint32_t stamped(void)
+{
+    uint32_t total = Base + (HZ_DMA_COUNT - dma_channel_hw_addr(DmaChan)->transfer_count);
+
+    if (total != Seen) {
+        Seen = total;
+        SeenUs = time_us_32();
+    }
+
+    return total;
+}
+
+/**
+ * The periods between the latest edges in cycles, the oldest first.
+ * An edge too close to the one before is noise and left out, periods
+ * before a gap of the feed are dropped.
+ */
+static int collect(uint32_t *cycles, uint32_t total)
+{
+    uint32_t n = total < HZ_HISTORY? total : HZ_HISTORY;
+    uint32_t i = total - n;
+    uint32_t prev, pending = 0;
+    int count = 0;
+
+    if (n == 0) {
+        return 0;
+    }
+
+    prev = Ring[i++ % HZ_RING];
+    for (; i != total; i++) {
+        uint32_t stamp = Ring[i % HZ_RING];
+        uint32_t ticks = prev - stamp;
+
+        prev = stamp;
+        if (ticks > TimeoutCycles / 2) {
+            count = 0;
+            pending = 0;
+            continue;
+        }
+        pending += 2 * ticks + HZ_EDGE_CYCLES;
+        if (pending < GlitchCycles) {
+            continue;
+        }
+        cycles[count++] = pending;
+        pending = 0;
+    }
+
+    return count;
+}
+
+static uint32_t toNs(uint64_t cycles)
+{
+    return (uint32_t)((cycles * 1000000000 + Clock / 2) / Clock);
+}
+
+/**
+ * The statistics of some periods, in cycles.
+ */
+static void window(LINE_HZ *hz, const uint32_t *cycles, int count)
+{
+    uint32_t min = UINT32_MAX, max = 0, mean;
+    uint64_t sum = 0, dev = 0, f;
+
+    memset(hz, 0, sizeof(*hz));
+    if (count == 0) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        sum += cycles[i];
+        min = cycles[i] < min? cycles[i] : min;
+        max = cycles[i] > max? cycles[i] : max;
+    }
+    mean = (uint32_t)(sum / count);
+    for (int i = 0; i < count; i++) {
+        dev += cycles[i] > mean? cycles[i] - mean : mean - cycles[i];
+    }
+
+    f = ((uint64_t)count * Clock * 100 + sum / 2) / sum;
+    hz->Cycles = count;
+    hz->CentiHz = f > UINT16_MAX? UINT16_MAX : (uint16_t)f;
+    hz->PeriodNs = toNs(mean);
+    hz->MinNs = toNs(min);
+    hz->MaxNs = toNs(max);
+    hz->JitterNs = toNs(dev / count);
+}
+
+/**
+ * Start timestamping the rising edges of the feed on a gpio pin, a
+ * state machine of pio0 and a DMA channel do it from now on.
+ */
+bool lineHzInit(uint gpio)
+{
+    dma_channel_config cfg;
+    uint offset;
+    int sm, chan;
+
+    if (Running == true) {
+        return true;
+    }
+    if (pio_can_add_program(HZ_PIO, &hzstamp_program) == false) {
+        return false;
+    }
+    if ((sm = pio_claim_unused_sm(HZ_PIO, false)) < 0) {
+        return false;
+    }
+    if ((chan = dma_claim_unused_channel(false)) < 0) {
+        pio_sm_unclaim(HZ_PIO, sm);
+        return false;
+    }
+
+    gpio_init(gpio);
+    gpio_set_dir(gpio, GPIO_IN);
+
+    offset = pio_add_program(HZ_PIO, &hzstamp_program);
+    hzstamp_program_init(HZ_PIO, sm, offset, gpio);
+
+    DmaChan = chan;
+    cfg = dma_channel_get_default_config(DmaChan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_ring(&cfg, true, HZ_RING_BITS);
+    channel_config_set_dreq(&cfg, pio_get_dreq(HZ_PIO, sm, false));
+    dma_channel_configure(DmaChan, &cfg, Ring, &HZ_PIO->rxf[sm], HZ_DMA_COUNT, true);
+
+    Clock = clock_get_hz(clk_sys);
+    GlitchCycles = Clock / 1000000 * HZ_GLITCH;
+    TimeoutCycles = Clock / 1000 * HZ_TIMEOUT;
+
+    pio_sm_set_enabled(HZ_PIO, sm, true);
+    Running = true;
+
+    return true;
+}
+
+/**
+ * The statistics of the latest periods, as many as there are up to
+ * cycles. No periods when the feed is gone, i.e. no edge for a while.
+ */
+void lineHzWindow(LINE_HZ *hz, int cycles)
+{
+    uint32_t periods[HZ_HISTORY];
+    uint32_t total;
+    int count = 0;
+
+    if (Running == true) {
+        total = stamped();
+        if (time_us_32() - SeenUs <= HZ_TIMEOUT * 1000) {
+            count = collect(periods, total);
+        }
+    }
+
+    if (cycles > count) {
+        cycles = count;
+    }
+    window(hz, periods + count - cycles, cycles);
+}
+
+/**
+ * Poll for the frequency, it does not wait. True with the statistics
+ * of the latest periods once cycles more edges have come, or with none
+ * when the feed is gone, else false and hz is left as it is.
+ */
+bool lineHzUpdate(LINE_HZ *hz, int cycles)
+{
+    uint32_t total, now;
+
+    if (Running == false) {
+        return false;
+    }
+
+    // The transfer count ran out, go on round the ring
+    if (dma_channel_is_busy(DmaChan) == false) {
+        Base += HZ_DMA_COUNT;
+        dma_channel_set_trans_count(DmaChan, HZ_DMA_COUNT, true);
+    }
+
+    total = stamped();
+    now = time_us_32();
+
+    if (total - Consumed >= (uint32_t)cycles) {
+        lineHzWindow(hz, cycles);
+    } else if (now - SeenUs > HZ_TIMEOUT * 1000 && now - ReportedUs > HZ_TIMEOUT * 1000) {
+        memset(hz, 0, sizeof(*hz));
+    } else {
+        return false;
+    }
+
+    Consumed = total;
+    ReportedUs = now;
+
+    return true;
+}
+
+/**
+ * The latest periods in ns, the newest first, returns how many.
+ */
+int lineHzPeriods(uint32_t *ns, int count)
+{
+    uint32_t periods[HZ_HISTORY];
+    int n = 0;
+
+    if (Running == true) {
+        n = collect(periods, stamped());
+    }
+
+    if (count > n) {
+        count = n;
+    }
+    for (int i = 0; i < count; i++) {
+        ns[i] = toNs(periods[n - 1 - i]);
+    }
+
+    return count;
+}
+
+/**
+ * The cycle by cycle picture of the feed, as the governor holds the
+ * speed under load changes.
+ */
+void lineHzStats(void (*out)(const char *format , ...))
+{
+    uint32_t ns[HZ_STATS_PERIODS];
+    char f[12], p[12], lo[12], hi[12], j[12];
+    LINE_HZ hz;
+    int n;
+
+    if (Running == false) {
+        out("hz: not measured\r\n");
+        return;
+    }
+
+    lineHzWindow(&hz, HZ_HISTORY);
+    Format_Fixed(f, sizeof(f), hz.CentiHz, 2);
+    Format_Fixed(p, sizeof(p), hz.PeriodNs, 3);
+    Format_Fixed(lo, sizeof(lo), hz.MinNs, 3);
+    Format_Fixed(hi, sizeof(hi), hz.MaxNs, 3);
+    Format_Fixed(j, sizeof(j), hz.JitterNs, 3);
+    out("hz: %s Hz over %u cycles, period %s us\r\n", f, hz.Cycles, p);
+    out("hz period: min %s max %s jitter %s us\r\n", lo, hi, j);
+
+    n = lineHzPeriods(ns, HZ_STATS_PERIODS);
+    out("hz latest:");
+    for (int i = 0; i < n; i++) {
+        Format_Fixed(p, sizeof(p), ns[i], 3);
+        out(" %s", p);
+    }
+    out(" us\r\n");
+}
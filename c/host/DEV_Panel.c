@@ -0,0 +1,349 @@
+/*****************************************************************************
+* | File      	:   DEV_Panel.c
+* | Function    :   Host side DEV layer with an emulated ST7789 panel
+* | Info        :   The LCD_1in14.c driver runs unchanged on top of it. The
+* |                 command and pixel bytes it sends are decoded into a
+* |                 picture of what the 240x135 glass would show, which can
+* |                 be saved as a PPM file.
+* |                 DMA transfers are deferred like on the Pico: they go
+* |                 out, and their Done callbacks run, when the caller
+* |                 waits for the SPI.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-09
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "DEV_Panel.h"
+
+int EPD_RST_PIN     = 12;
+int EPD_DC_PIN      = 8;
+int EPD_CS_PIN      = 9;
+int EPD_BL_PIN      = 13;
+int EPD_CLK_PIN     = 10;
+int EPD_MOSI_PIN    = 11;
+int EPD_SCL_PIN     = 7;
+int EPD_SDA_PIN     = 6;
+
+/**
+ * Panel state, the frame memory window is kept in glass coordinates,
+ * the HORIZONTAL mode offsets of LCD_1IN14_SetWindows() taken off
+ */
+#define PANEL_X_OFFSET  40
+#define PANEL_Y_OFFSET  53
+
+static UWORD Glass[DEV_PANEL_HEIGHT][DEV_PANEL_WIDTH];
+static int Dc, Cs = 1;
+static UBYTE Cmd, Args[4], Nargs;
+static int Xs, Xe, Ys, Ye, X, Y;
+static int High = -1;
+static uint64_t Bytes;
+static uint32_t Errors;
+
+/**
+ * The one DMA transfer in flight, see DEV_SPI_DMA_Wait()
+ */
+static const uint8_t *DmaAddr;
+static uint32_t DmaLen, DmaStride, DmaCount;
+static uint16_t DmaValue;
+static bool DmaFill;
+static void (*DmaDone)(void);
+static bool DmaActive, DmaChained, DmaInDone;
+
+/******************************************************************************
+function:	One byte on the SPI bus, decoded like the ST7789 does
+parameter:
+******************************************************************************/
+static void DEV_Panel_Byte(UBYTE Value)
+{
+    Bytes++;
+    if (Cs) {
+        Errors++;   // Nobody listens
+        return;
+    }
+
+    if (!Dc) {
+        Cmd = Value;
+        Nargs = 0;
+        High = -1;
+        if (Cmd == 0x2C) {
+            X = Xs;
+            Y = Ys;
+        }
+        return;
+    }
+
+    switch (Cmd) {
+    case 0x2A:
+    case 0x2B:
+        if (Nargs < 4) {
+            Args[Nargs++] = Value;
+        }
+        if (Nargs == 4) {
+            int Start = (Args[0] << 8) | Args[1], End = (Args[2] << 8) | Args[3];
+            if (Cmd == 0x2A) {
+                Xs = Start - PANEL_X_OFFSET;
+                Xe = End - PANEL_X_OFFSET;
+            } else {
+                Ys = Start - PANEL_Y_OFFSET;
+                Ye = End - PANEL_Y_OFFSET;
+            }
+        }
+        break;
+    case 0x2C:
+        if (High < 0) {
+            High = Value;
+            break;
+        }
+        if (X >= 0 && X < DEV_PANEL_WIDTH && Y >= 0 && Y < DEV_PANEL_HEIGHT) {
+            Glass[Y][X] = (High << 8) | Value;
+        }
+        High = -1;
+        if (++X > Xe) {
+            X = Xs;
+            if (++Y > Ye) {
+                Y = Ys;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function:	GPIO
+parameter:
+******************************************************************************/
+void DEV_Digital_Write(UWORD Pin, UBYTE Value)
+{
+    if (Pin == EPD_DC_PIN) {
+        Dc = Value;
+    } else if (Pin == EPD_CS_PIN) {
+        Cs = Value;
+    }
+}
+
+UBYTE DEV_Digital_Read(UWORD Pin)
+{
+    (void)Pin;
+    return 1;
+}
+
+void DEV_GPIO_Mode(UWORD Pin, UWORD Mode)
+{
+    (void)Pin;
+    (void)Mode;
+}
+
+/******************************************************************************
+function:	SPI write
+parameter:
+******************************************************************************/
+void DEV_SPI_WriteByte(uint8_t Value)
+{
+    DEV_SPI_DMA_Wait();
+    DEV_Panel_Byte(Value);
+}
+
+void DEV_SPI_Write_nByte(uint8_t pData[], uint32_t Len)
+{
+    DEV_SPI_DMA_Wait();
+    while (Len--) {
+        DEV_Panel_Byte(*pData++);
+    }
+}
+
+/******************************************************************************
+function:	The DMA transfer in flight goes out, then its Done runs
+parameter:
+******************************************************************************/
+static void DEV_Panel_Dma(void)
+{
+    void (*Done)(void) = DmaDone;
+    uint32_t i, j;
+
+    if (DmaFill) {
+        for (i = 0; i < DmaLen; i++) {
+            DEV_Panel_Byte(DmaValue >> 8);
+            DEV_Panel_Byte(DmaValue & 0xff);
+        }
+        DmaFill = false;
+    } else {
+        for (j = 0; j < DmaCount; j++) {
+            for (i = 0; i < DmaLen; i++) {
+                DEV_Panel_Byte(DmaAddr[j * DmaStride + i]);
+            }
+        }
+    }
+
+    DmaDone = NULL;
+    DmaChained = false;
+    if (Done != NULL) {
+        DmaInDone = true;
+        Done();
+        DmaInDone = false;
+    }
+    if (!DmaChained) {
+        DmaActive = false;
+    }
+}
+
+void DEV_SPI_Write_nByte_DMA(const uint8_t *pData, uint32_t Len, uint32_t Stride, uint32_t Count, void (*Done)(void))
+{
+    DEV_SPI_DMA_Wait();
+
+    if (Len == 0 || Count == 0) {
+        if (Done != NULL) {
+            Done();
+        }
+        return;
+    }
+
+    DmaAddr = pData;
+    DmaLen = Len;
+    DmaStride = Stride;
+    DmaCount = Count;
+    DmaDone = Done;
+    DmaChained = true;
+    DmaActive = true;
+}
+
+void DEV_SPI_Fill_DMA(uint16_t Value, uint32_t Count, void (*Done)(void))
+{
+    DEV_SPI_DMA_Wait();
+
+    if (Count == 0) {
+        if (Done != NULL) {
+            Done();
+        }
+        return;
+    }
+
+    DmaValue = Value;
+    DmaLen = Count;
+    DmaFill = true;
+    DmaDone = Done;
+    DmaChained = true;
+    DmaActive = true;
+}
+
+bool DEV_SPI_DMA_Busy(void)
+{
+    return DmaActive;
+}
+
+void DEV_SPI_DMA_Wait(void)
+{
+    while (DmaActive && !DmaInDone) {
+        DEV_Panel_Dma();
+    }
+}
+
+void DEV_SPI_DMA_Release(void)
+{
+    DEV_SPI_DMA_Wait();
+}
+
+void DEV_SPI_DMA_Claim(void)
+{
+}
+
+/******************************************************************************
+function:	The rest of the DEV layer, nothing to do on the host
+parameter:
+******************************************************************************/
+void DEV_Delay_ms(UDOUBLE xms)
+{
+    (void)xms;
+}
+
+void DEV_Delay_us(UDOUBLE xus)
+{
+    (void)xus;
+}
+
+void DEV_SET_PWM(uint8_t Value)
+{
+    (void)Value;
+}
+
+UBYTE DEV_Module_Init(void)
+{
+    return 0;
+}
+
+void DEV_Module_Exit(void)
+{
+}
+
+/******************************************************************************
+function:	The emulated glass
+parameter:
+******************************************************************************/
+UWORD DEV_Panel_Pixel(UWORD X, UWORD Y)
+{
+    DEV_SPI_DMA_Wait();
+    return Glass[Y][X];
+}
+
+uint64_t DEV_Panel_Bytes(void)
+{
+    return Bytes;
+}
+
+uint32_t DEV_Panel_Errors(void)
+{
+    return Errors;
+}
+
+/******************************************************************************
+function:	Save the glass as a binary PPM, 8 bits a channel
+parameter:
+    Path : File to write
+return:
+    0 on success, -1 if the file could not be written
+******************************************************************************/
+int DEV_Panel_SavePPM(const char *Path)
+{
+    FILE *Fp;
+    UBYTE Rgb[3];
+    int i, j;
+
+    DEV_SPI_DMA_Wait();
+
+    if ((Fp = fopen(Path, "wb")) == NULL) {
+        return -1;
+    }
+
+    fprintf(Fp, "P6\n%d %d\n255\n", DEV_PANEL_WIDTH, DEV_PANEL_HEIGHT);
+    for (j = 0; j < DEV_PANEL_HEIGHT; j++) {
+        for (i = 0; i < DEV_PANEL_WIDTH; i++) {
+            UWORD Color = Glass[j][i];
+            Rgb[0] = ((Color >> 11) & 0x1f) * 255 / 31;
+            Rgb[1] = ((Color >> 5) & 0x3f) * 255 / 63;
+            Rgb[2] = (Color & 0x1f) * 255 / 31;
+            fwrite(Rgb, 1, 3, Fp);
+        }
+    }
+
+    return fclose(Fp) == 0? 0 : -1;
+}
@@ -0,0 +1,39 @@
+/*****************************************************************************
+* | File      	:   DEV_Panel.h
+* | Function    :   Host side DEV layer with an emulated ST7789 panel
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-09
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#ifndef _DEV_PANEL_H_
+#define _DEV_PANEL_H_
+
+#include "DEV_Config.h"
+
+#define DEV_PANEL_WIDTH     240     // The glass in HORIZONTAL mode
+#define DEV_PANEL_HEIGHT    135
+
+UWORD DEV_Panel_Pixel(UWORD X, UWORD Y);
+uint64_t DEV_Panel_Bytes(void);
+uint32_t DEV_Panel_Errors(void);
+int DEV_Panel_SavePPM(const char *Path);
+
+#endif
@@ -0,0 +1,154 @@
+/*****************************************************************************
+* | File      	:   bench_blit.c
+* | Function    :   Host side micro-benchmark of Paint_BlitRGB565()
+* | Info        :   A block of RGB565 pixels is blitted and compared with
+* |                 setting it pixel by pixel with Paint_SetPixel(), inside
+* |                 the picture, clipped at its edges, into a band and
+* |                 rotated or mirrored. Both must give the same picture.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-16
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "GUI_Paint.h"
+
+#define WIDTH       240
+#define HEIGHT      135
+#define ROUNDS      2000
+
+#define BLOCK_W     64
+#define BLOCK_H     32
+#define STRIDE      (80*2)      // Bytes a block row, wider than the block
+
+#define BAND_Y      40          // The band of the band case
+#define BAND_LINES  16
+
+static UBYTE Block[BLOCK_H * STRIDE];
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Where the block goes, and how the picture is set up
+ */
+typedef struct {
+    const char *name;
+    UWORD x, y;
+    UWORD rotate;
+    UBYTE mirror;
+    UBYTE band;
+} CASE;
+
+static const CASE *Case;
+
+/**
+ * Point by point reference, the pixels off the picture are left out
+ */
+static void pointsBlock(void)
+{
+    for (UWORD j = 0; j < BLOCK_H; j++) {
+        const UBYTE *ptr = Block + j * STRIDE;
+
+        for (UWORD i = 0; i < BLOCK_W; i++, ptr += 2) {
+            if (Case->x + i < Paint.Width && Case->y + j < Paint.Height)
+                Paint_SetPixel(Case->x + i, Case->y + j, ptr[0] << 8 | ptr[1]);
+        }
+    }
+}
+
+static void blitBlock(void)
+{
+    Paint_BlitRGB565(Case->x, Case->y, BLOCK_W, BLOCK_H, Block, STRIDE);
+}
+
+/**
+ * Set the picture up for the case, clear it and draw ROUNDS times,
+ * returns draws per second.
+ */
+static double run(UBYTE *image, void (*Draw)(void))
+{
+    double t0;
+
+    Paint_NewImage(image, WIDTH, HEIGHT, Case->rotate, WHITE);
+    Paint_SetScale(65);
+    Paint_SetMirroring(Case->mirror);
+    Paint_Clear(WHITE);
+    if (Case->band)
+        Paint_SelectBand(image, BAND_Y, BAND_LINES);
+
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        Draw();
+        Paint_ClearDirty();
+    }
+
+    return ROUNDS / (now() - t0);
+}
+
+int main(void)
+{
+    size_t size = WIDTH*HEIGHT*2;
+    UBYTE *image = malloc(size);
+    UBYTE *ref = malloc(size);
+    int rc = 0;
+
+    const CASE cases[] = {
+        {"inside",              20,  30, ROTATE_0,   MIRROR_NONE,       0},
+        {"clipped right",      200,  30, ROTATE_0,   MIRROR_NONE,       0},
+        {"clipped bottom",      20, 120, ROTATE_0,   MIRROR_NONE,       0},
+        {"band rows 40..55",    20,  30, ROTATE_0,   MIRROR_NONE,       1},
+        {"band clipped",       200,  50, ROTATE_0,   MIRROR_NONE,       1},
+        {"rotate 90 clipped",  100, 220, ROTATE_90,  MIRROR_NONE,       0},
+        {"rotate 180",          20,  30, ROTATE_180, MIRROR_NONE,       0},
+        {"rotate 270 band",     30,  20, ROTATE_270, MIRROR_NONE,       1},
+        {"mirror horizontal",  200,  30, ROTATE_0,   MIRROR_HORIZONTAL, 0},
+    };
+
+    for (size_t i = 0; i < sizeof(Block); i++)
+        Block[i] = (UBYTE)(i * 7 + i / STRIDE * 13);
+
+    printf("%-20s %14s %14s %8s\n", "block 64x32", "points /s", "blits /s", "speedup");
+
+    for (size_t c = 0; c < sizeof(cases)/sizeof(cases[0]); c++) {
+        Case = &cases[c];
+
+        double slow = run(ref, pointsBlock);
+        double fast = run(image, blitBlock);
+
+        printf("%-20s %14.0f %14.0f %7.1fx\n", Case->name, slow, fast, fast/slow);
+
+        if (memcmp(ref, image, size) != 0) {
+            printf("%s: pictures differ!\n", Case->name);
+            rc = 1;
+        }
+    }
+
+    free(ref);
+    free(image);
+    return rc;
+}
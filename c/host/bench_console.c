@@ -0,0 +1,290 @@
+/*****************************************************************************
+* | File      	:   bench_console.c
+* | Function    :   Host side benchmark of the display console
+* | Info        :   The console (examples/wbeke-disp.c) runs on the real LCD
+* |                 driver over an emulated panel, see DEV_Panel.c. Times are
+* |                 host times including the panel emulation, the bytes are
+* |                 what would go over the SPI on the Pico.
+* |                 Given a directory the pictures on the glass are saved
+* |                 there as PPM files, to be compared between builds.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-09
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "DEV_Panel.h"
+#include "GUI_Paint.h"
+#include "LCD_1in14.h"
+#include "wbeke-ctrl.h"
+
+#define ROUNDS      200
+#define LINES       6       // Log lines on a screen
+
+static const char *Text = "Time left: 27 minutes";  // 21 chars, a full log line
+static const char *Dir;
+static int Quiet = -1;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * The console echoes printLog() to stdout, mute it while timing.
+ */
+static void mute(bool on)
+{
+    static int saved = -1;
+
+    fflush(stdout);
+    if (on == true) {
+        saved = dup(STDOUT_FILENO);
+        dup2(Quiet, STDOUT_FILENO);
+    } else if (saved >= 0) {
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+        saved = -1;
+    }
+}
+
+/**
+ * Save the glass as <Dir>/<name>.ppm if a directory was given.
+ */
+static int save(const char *name)
+{
+    char path[256];
+
+    if (Dir == NULL) {
+        return 0;
+    }
+
+    snprintf(path, sizeof(path), "%s/%s.ppm", Dir, name);
+    if (DEV_Panel_SavePPM(path) != 0) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return 1;
+    }
+    return 0;
+}
+
+static void report(const char *name, double secs, uint64_t bytes, int ops)
+{
+    printf("%-16s %12.0f %12llu\n", name, secs * 1e9 / ops, (unsigned long long)(bytes / ops));
+}
+
+/**
+ * Text drawn straight into a frame buffer of its own, the console's
+ * picture is left as it is.
+ */
+static void benchGlyph(void)
+{
+    PAINT saved = Paint;
+    UBYTE *image = malloc(LCD_1IN14_HEIGHT*LCD_1IN14_WIDTH*2);
+    int glyphs = 0;
+    double t0;
+
+    Paint_NewImage(image, LCD_1IN14_HEIGHT, LCD_1IN14_WIDTH, ROTATE_0, WHITE);
+    Paint_SetScale(65);
+    Paint_Clear(WHITE);
+
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int l = 0; l < LINES; l++) {
+            Paint_DrawString_EN(1, (l+1)*16, Text, &Font16, WHITE, BLACK);
+            glyphs += strlen(Text);
+        }
+        Paint_ClearDirty();
+    }
+    report("glyph", now() - t0, 0, glyphs);
+
+    Paint = saved;
+    free(image);
+}
+
+int main(int argc, char *argv[])
+{
+    uint64_t bytes, b0;
+    double t0, t;
+    int rc = 0;
+
+    if (argc > 1) {
+        Dir = argv[1];
+    }
+    if ((Quiet = open("/dev/null", O_WRONLY)) < 0 || initDisplay() != 0) {
+        return 1;
+    }
+
+    printf("%-16s %12s %12s\n", "operation", "ns/op", "bytes/op");
+
+    benchGlyph();
+
+    // Splash screen, the whole glass
+    mute(true);
+    t = 0;
+    bytes = 0;
+    for (int r = 0; r < ROUNDS; r++) {
+        clearLog();
+        LCD_1IN14_Wait();
+        b0 = DEV_Panel_Bytes();
+        t0 = now();
+        showSplash("V1.0");
+        LCD_1IN14_Wait();
+        t += now() - t0;
+        bytes += DEV_Panel_Bytes() - b0;
+    }
+    mute(false);
+    report("splash", t, bytes, ROUNDS);
+    rc |= save("splash");
+
+    // Log lines into an empty log
+    mute(true);
+    t = 0;
+    bytes = 0;
+    for (int r = 0; r < ROUNDS; r++) {
+        clearLog();
+        printHdr("Runtime monitoring");
+        LCD_1IN14_Wait();
+        b0 = DEV_Panel_Bytes();
+        t0 = now();
+        for (int l = 0; l < LINES; l++) {
+            printLog("Time left: %d minutes", LINES - l);
+        }
+        LCD_1IN14_Wait();
+        t += now() - t0;
+        bytes += DEV_Panel_Bytes() - b0;
+    }
+    mute(false);
+    report("log line", t, bytes, ROUNDS*LINES);
+    rc |= save("log");
+
+    // Log lines into a full log, each one scrolls it
+    mute(true);
+    LCD_1IN14_Wait();
+    bytes = DEV_Panel_Bytes();
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        printLog("Runtime: %d minutes", r);
+    }
+    LCD_1IN14_Wait();
+    t = now() - t0;
+    bytes = DEV_Panel_Bytes() - bytes;
+    mute(false);
+    report("scroll", t, bytes, ROUNDS);
+    rc |= save("scroll");
+
+    // A header digit that changes
+    mute(true);
+    LCD_1IN14_Wait();
+    bytes = DEV_Panel_Bytes();
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        printHdr("Monitoring@%dHz", 49 + r % 2);
+    }
+    LCD_1IN14_Wait();
+    t = now() - t0;
+    bytes = DEV_Panel_Bytes() - bytes;
+    mute(false);
+    report("header", t, bytes, ROUNDS);
+
+    // The time left in the status bar, a second at a time
+    mute(true);
+    showFrequency(50);
+    showStatus(STATUS_RUN, true);
+    LCD_1IN14_Wait();
+    bytes = DEV_Panel_Bytes();
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        showTimeLeft(30*60 - r);
+    }
+    LCD_1IN14_Wait();
+    t = now() - t0;
+    bytes = DEV_Panel_Bytes() - bytes;
+    mute(false);
+    report("time left", t, bytes, ROUNDS);
+    rc |= save("status");
+
+    // Trend graph samples, a slow hunting around 50 Hz
+    mute(true);
+    showTrend(45, 65);
+    LCD_1IN14_Wait();
+    bytes = DEV_Panel_Bytes();
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        addTrend(50 + (r / 7 % 4) - (r / 23 % 3));
+    }
+    LCD_1IN14_Wait();
+    t = now() - t0;
+    bytes = DEV_Panel_Bytes() - bytes;
+    mute(false);
+    report("trend sample", t, bytes, ROUNDS);
+    rc |= save("trend");
+
+    // The big readout over the graph, the frequency hunting by a Hz,
+    // one digit and the status bar change
+    mute(true);
+    showReadout(true);
+    showTimeLeft(26*60);
+    LCD_1IN14_Wait();
+    bytes = DEV_Panel_Bytes();
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        showFrequency(50 + r % 2);
+    }
+    LCD_1IN14_Wait();
+    t = now() - t0;
+    bytes = DEV_Panel_Bytes() - bytes;
+    mute(false);
+    report("big digit", t, bytes, ROUNDS);
+    rc |= save("readout");
+
+    // A whole screen of text from a cleared one
+    mute(true);
+    LCD_1IN14_Wait();
+    bytes = DEV_Panel_Bytes();
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        clearLog();
+        setHdrColor(r % 2? HDR_ERROR : HDR_OK);
+        printHdr("Start Attempt %d/3", r % 3 + 1);
+        for (int l = 0; l < LINES; l++) {
+            printLog("Preheat: %d seconds", l + r);
+        }
+    }
+    LCD_1IN14_Wait();
+    t = now() - t0;
+    bytes = DEV_Panel_Bytes() - bytes;
+    mute(false);
+    report("full screen", t, bytes, ROUNDS);
+    rc |= save("screen");
+
+    if (DEV_Panel_Errors() != 0) {
+        printf("%u bytes sent with CS high!\n", DEV_Panel_Errors());
+        rc = 1;
+    }
+
+    return rc;
+}
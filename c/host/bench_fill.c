@@ -0,0 +1,168 @@
+/*****************************************************************************
+* | File      	:   bench_fill.c
+* | Function    :   Host side micro-benchmark of the GUI_Paint fills
+* | Info        :   Filled rectangles, filled circles and straight lines are
+* |                 compared with drawing them point by point with
+* |                 Paint_DrawPoint(), as GUI_Paint did before the span
+* |                 fills. Both must give the same picture.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-14
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "GUI_Paint.h"
+
+#define WIDTH       240
+#define HEIGHT      135
+#define ROUNDS      2000
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Point by point references
+ */
+static void pointsBar(UWORD Color)
+{
+    for (UWORD y = 20; y < 40; y++)
+        for (UWORD x = 10; x <= 210; x++)
+            Paint_DrawPoint(x, y, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+}
+
+static void pointsDisc(UWORD Color)
+{
+    const UWORD cx = 120, cy = 90, r = 30;
+    int16_t x = 0, y = r, esp = 3 - (r << 1);
+
+    while (x <= y) {
+        for (int16_t s = x; s <= y; s++) {
+            Paint_DrawPoint(cx + x, cy + s, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+            Paint_DrawPoint(cx - x, cy + s, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+            Paint_DrawPoint(cx - s, cy + x, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+            Paint_DrawPoint(cx - s, cy - x, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+            Paint_DrawPoint(cx - x, cy - s, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+            Paint_DrawPoint(cx + x, cy - s, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+            Paint_DrawPoint(cx + s, cy - x, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+            Paint_DrawPoint(cx + s, cy + x, Color, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+        }
+        if (esp < 0)
+            esp += 4 * x + 6;
+        else {
+            esp += 10 + 4 * (x - y);
+            y--;
+        }
+        x++;
+    }
+}
+
+static void pointsTicks(UWORD Color)
+{
+    for (UWORD x = 10; x <= 230; x += 20)
+        for (UWORD y = 100; y <= 130; y++)
+            Paint_DrawPoint(x, y, Color, DOT_PIXEL_2X2, DOT_STYLE_DFT);
+    for (UWORD x = 10; x <= 230; x++)
+        Paint_DrawPoint(x, 131, Color, DOT_PIXEL_2X2, DOT_STYLE_DFT);
+}
+
+/**
+ * The same with the span fills
+ */
+static void spansBar(UWORD Color)
+{
+    Paint_DrawRectangle(10, 20, 210, 40, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+}
+
+static void spansDisc(UWORD Color)
+{
+    Paint_DrawCircle(120, 90, 30, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+}
+
+static void spansTicks(UWORD Color)
+{
+    for (UWORD x = 10; x <= 230; x += 20)
+        Paint_DrawLine(x, 100, x, 130, Color, DOT_PIXEL_2X2, LINE_STYLE_SOLID);
+    Paint_DrawLine(10, 131, 230, 131, Color, DOT_PIXEL_2X2, LINE_STYLE_SOLID);
+}
+
+/**
+ * Draw ROUNDS times in two colors and return draws per second.
+ */
+static double run(void (*Draw)(UWORD Color))
+{
+    double t0;
+
+    Paint_Clear(WHITE);
+
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        Draw(r & 1? GREEN : RED);
+        Paint_ClearDirty();
+    }
+
+    return ROUNDS / (now() - t0);
+}
+
+int main(void)
+{
+    size_t size = WIDTH*HEIGHT*2;
+    UBYTE *image = malloc(size);
+    UBYTE *ref = malloc(size);
+    int rc = 0;
+
+    const struct {
+        const char *name;
+        void (*points)(UWORD Color);
+        void (*spans)(UWORD Color);
+    } shapes[] = {
+        {"bar 200x20",          pointsBar,   spansBar},
+        {"disc r=30",           pointsDisc,  spansDisc},
+        {"ticks 2 px",          pointsTicks, spansTicks},
+    };
+
+    Paint_NewImage(image, WIDTH, HEIGHT, ROTATE_0, WHITE);
+    Paint_SetScale(65);
+
+    printf("%-20s %14s %14s %8s\n", "shape", "points /s", "spans /s", "speedup");
+
+    for (size_t s = 0; s < sizeof(shapes)/sizeof(shapes[0]); s++) {
+        double slow = run(shapes[s].points);
+        memcpy(ref, image, size);
+        double fast = run(shapes[s].spans);
+
+        printf("%-20s %14.0f %14.0f %7.1fx\n", shapes[s].name, slow, fast, fast/slow);
+
+        if (memcmp(ref, image, size) != 0) {
+            printf("%s: pictures differ!\n", shapes[s].name);
+            rc = 1;
+        }
+    }
+
+    free(ref);
+    free(image);
+    return rc;
+}
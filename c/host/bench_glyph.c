@@ -0,0 +1,192 @@
+/*****************************************************************************
+* | File      	:   bench_glyph.c
+* | Function    :   Host side micro-benchmark of the GUI_Paint text path
+* | Info        :   The row blitter used with ROTATE_0 is compared with the
+* |                 generic Paint_SetPixel() path. ROTATE_180 together with
+* |                 MIRROR_ORIGIN maps every pixel onto itself, so it renders
+* |                 the very same picture through the generic path.
+* |                 Font16 packed by tools/fontpack.py is timed both ways
+* |                 too and must give the same picture. So must a GB2312
+* |                 string found through the sorted index of Font24CN
+* |                 and by a scan of its table. Last the glyph cache is
+* |                 timed against the packed font it caches.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-02
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "GUI_Paint.h"
+
+#define WIDTH       240
+#define HEIGHT      135
+#define LINES       7
+#define ROUNDS      2000
+#define CACHE       8192    // Glyph cache bytes, as wbeke-disp.c has
+
+extern sFONT Font16Packed;          // font16.c by tools/fontpack.py
+
+// "Welcome" in GB2312, the last characters of the Font24CN table, and
+// "Temperature normal" that it does not have, which is only looked up
+static const char *TextCN = "\xbb\xb6\xd3\xad\xca\xb9\xd3\xc3 abc";
+static const char *MissingCN = "\xce\xc2\xb6\xc8\xd5\xfd\xb3\xa3";
+
+static const char *Text = "Time left: 27 minutes";  // 21 chars, a full log line
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Render ROUNDS screens of log lines and return glyphs per second.
+ */
+static double run(UWORD Rotate, UBYTE Mirror, sFONT *Font, UWORD Fore, UWORD Back)
+{
+    int glyphs = 0;
+    double t0;
+
+    Paint_SetRotate(Rotate);
+    Paint_SetMirroring(Mirror);
+    Paint_Clear(WHITE);
+
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int l = 0; l < LINES; l++) {
+            Paint_DrawString_EN(1, (l+1)*16, Text, Font, Fore, Back);
+            glyphs += strlen(Text);
+        }
+        Paint_ClearDirty();
+    }
+
+    return glyphs / (now() - t0);
+}
+
+/**
+ * Render ROUNDS GB2312 strings of Chars characters and return
+ * characters per second.
+ */
+static double runCN(cFONT *Font, const char *Text, int Chars)
+{
+    double t0;
+
+    Paint_SetRotate(ROTATE_0);
+    Paint_SetMirroring(MIRROR_NONE);
+    Paint_Clear(WHITE);
+
+    t0 = now();
+    for (int r = 0; r < ROUNDS; r++) {
+        Paint_DrawString_CN(0, 40, Text, Font, BLACK, FONT_BACKGROUND);
+        Paint_ClearDirty();
+    }
+
+    return (double)ROUNDS * Chars / (now() - t0);
+}
+
+int main(void)
+{
+    size_t size = WIDTH*HEIGHT*2;
+    UBYTE *image = malloc(size);
+    UBYTE *ref = malloc(size);
+    int rc = 0;
+
+    const struct {
+        const char *name;
+        UWORD fore;
+        UWORD back;
+    } modes[] = {
+        {"log (transparent)",   WHITE, BLACK},  // printLog()
+        {"header (opaque)",     GREEN, BLACK},  // printHdr()
+    };
+
+    Paint_NewImage(image, WIDTH, HEIGHT, ROTATE_0, WHITE);
+    Paint_SetScale(65);
+
+    printf("%-20s %14s %14s %8s %14s %14s\n", "mode", "generic g/s", "blitter g/s", "speedup",
+           "packed g/s", "packed gen g/s");
+
+    for (size_t m = 0; m < sizeof(modes)/sizeof(modes[0]); m++) {
+        double slow = run(ROTATE_180, MIRROR_ORIGIN, &Font16, modes[m].fore, modes[m].back);
+        memcpy(ref, image, size);
+        double fast = run(ROTATE_0, MIRROR_NONE, &Font16, modes[m].fore, modes[m].back);
+        int same = memcmp(ref, image, size) == 0;
+
+        // The packed Font16 must give the same picture either way
+        double packed = run(ROTATE_0, MIRROR_NONE, &Font16Packed, modes[m].fore, modes[m].back);
+        same &= memcmp(ref, image, size) == 0;
+        double packedSlow = run(ROTATE_180, MIRROR_ORIGIN, &Font16Packed, modes[m].fore, modes[m].back);
+        same &= memcmp(ref, image, size) == 0;
+
+        printf("%-20s %14.0f %14.0f %7.1fx %14.0f %14.0f\n", modes[m].name, slow, fast, fast/slow,
+               packed, packedSlow);
+
+        if (!same) {
+            printf("%s: pictures differ!\n", modes[m].name);
+            rc = 1;
+        }
+    }
+
+    // Opaque header text through the glyph cache, and the transparent log
+    // text that it leaves to the packed font
+    static UDOUBLE arena[CACHE / 4];
+    printf("\n%-20s %14s %14s %8s %8s\n", "Font16Packed", "packed g/s", "cached g/s", "speedup", "hits");
+    for (size_t m = 0; m < sizeof(modes)/sizeof(modes[0]); m++) {
+        double packed = run(ROTATE_0, MIRROR_NONE, &Font16Packed, modes[m].fore, modes[m].back);
+        memcpy(ref, image, size);
+        Paint_SetGlyphCache(&Font16Packed, arena, sizeof(arena));
+        Paint_ClearStats();
+        double cached = run(ROTATE_0, MIRROR_NONE, &Font16Packed, modes[m].fore, modes[m].back);
+        const PAINT_STATS *stats = Paint_GetStats();
+        Paint_SetGlyphCache(NULL, NULL, 0);
+
+        printf("%-20s %14.0f %14.0f %7.1fx %7.1f%%\n", modes[m].name, packed, cached, cached/packed,
+               stats->Glyphs? 100.0 * stats->CacheHits / stats->Glyphs : 0.0);
+        if (memcmp(ref, image, size) != 0) {
+            printf("%s: pictures differ!\n", modes[m].name);
+            rc = 1;
+        }
+    }
+
+    // The sorted index of the table against a scan of it
+    cFONT scanned = Font24CN;
+    scanned.Index = NULL;
+    double scan = runCN(&scanned, TextCN, 8);
+    memcpy(ref, image, size);
+    double indexed = runCN(&Font24CN, TextCN, 8);
+
+    printf("\n%-20s %14s %14s %8s\n", "Font24CN", "scan c/s", "index c/s", "speedup");
+    printf("%-20s %14.0f %14.0f %7.1fx\n", "drawn", scan, indexed, indexed/scan);
+    if (memcmp(ref, image, size) != 0) {
+        printf("Font24CN: pictures differ!\n");
+        rc = 1;
+    }
+    scan = runCN(&scanned, MissingCN, 4);
+    indexed = runCN(&Font24CN, MissingCN, 4);
+    printf("%-20s %14.0f %14.0f %7.1fx\n", "looked up only", scan, indexed, indexed/scan);
+
+    free(ref);
+    free(image);
+    return rc;
+}
@@ -0,0 +1,19 @@
+/**
+ * Host build stand-in for the DEV_Config.c time stamps.
+ */
+#include <time.h>
+#include "DEV_Config.h"
+
+systick_hw_t host_systick;
+
+uint64_t DEV_Time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void DEV_Cycles_Init(void)
+{
+}
@@ -0,0 +1,9 @@
+/**
+ * Host build stand-in for the Pico SDK header.
+ */
+#ifndef _HOST_HARDWARE_SPI_H_
+#define _HOST_HARDWARE_SPI_H_
+
+#include "pico/stdlib.h"
+
+#endif
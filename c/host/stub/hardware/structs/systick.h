@@ -0,0 +1,21 @@
+/**
+ * Host build stand-in for the Pico SDK header.
+ * There is no SysTick on the host, the counter stands still and
+ * DEV_Cycles_Since() reads zero.
+ */
+#ifndef _HOST_HARDWARE_STRUCTS_SYSTICK_H_
+#define _HOST_HARDWARE_STRUCTS_SYSTICK_H_
+
+#include "pico/stdlib.h"
+
+typedef struct {
+    volatile uint32_t csr;
+    volatile uint32_t rvr;
+    volatile uint32_t cvr;
+    volatile uint32_t calib;
+} systick_hw_t;
+
+extern systick_hw_t host_systick;
+#define systick_hw (&host_systick)
+
+#endif
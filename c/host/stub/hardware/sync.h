@@ -0,0 +1,13 @@
+/**
+ * Host build stand-in for the Pico SDK header.
+ */
+#ifndef _HOST_HARDWARE_SYNC_H_
+#define _HOST_HARDWARE_SYNC_H_
+
+#include "pico/stdlib.h"
+
+static inline void __dmb(void)
+{
+}
+
+#endif
@@ -0,0 +1,23 @@
+/**
+ * Host build stand-in for the Pico SDK header.
+ * Only what the hardware independent GUI code needs to compile.
+ */
+#ifndef _HOST_PICO_STDLIB_H_
+#define _HOST_PICO_STDLIB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+static inline void tight_loop_contents(void)
+{
+}
+
+static inline uint get_core_num(void)
+{
+    return 0;
+}
+
+#endif
@@ -26,6 +26,7 @@
 # THE SOFTWARE.
 ******************************************************************************/
 #include "DEV_Config.h"
+#include "hardware/irq.h"
 
 #define SPI_PORT spi1
 #define I2C_PORT spi1
@@ -45,6 +46,22 @@ int EPD_SDA_PIN;
 
 
 uint slice_num;
+
+/**
+ * SPI transmit DMA state, one transfer of Count rows in flight at most
+**/
+static int spi_dma_chan = -1;
+static const uint8_t *DmaAddr;
+static uint32_t DmaLen;
+static uint32_t DmaStride;
+static uint32_t DmaCount;
+static void (*DmaDone)(void);
+static volatile bool DmaActive;
+static bool DmaFill;            // 16 bit frames from one word, see DEV_SPI_Fill_DMA()
+static uint16_t DmaFillValue;
+static bool DmaChained;         // Done started the next transfer
+static volatile int DmaDoneCore = -1;   // Core running Done, it must not wait for itself
+
 /******************************************************************************
 function:	GPIO read and write
 parameter:
@@ -70,14 +87,195 @@ parameter:
 ******************************************************************************/
 void DEV_SPI_WriteByte(uint8_t Value)
 {
+    DEV_SPI_DMA_Wait();
     spi_write_blocking(SPI_PORT, &Value, 1);
 }
 
 void DEV_SPI_Write_nByte(uint8_t pData[], uint32_t Len)
 {
+    DEV_SPI_DMA_Wait();
     spi_write_blocking(SPI_PORT, pData, Len);
 }
 
+/******************************************************************************
+function:	SPI DMA completion interrupt
+parameter:
+Info:
+    Starts the next row of a windowed transfer. After the last row the
+    SPI FIFO is drained before the Done callback may release CS.
+    Done may start the next transfer itself, the channel then stays busy
+    and nothing waiting for it gets in between.
+******************************************************************************/
+static void DEV_SPI_DMA_Handler(void)
+{
+    if (!dma_channel_get_irq0_status(spi_dma_chan)) {
+        return;
+    }
+    dma_channel_acknowledge_irq0(spi_dma_chan);
+
+    if (--DmaCount > 0) {
+        DmaAddr += DmaStride;
+        dma_channel_transfer_from_buffer_now(spi_dma_chan, DmaAddr, DmaLen);
+        return;
+    }
+
+    while (spi_is_busy(SPI_PORT)) {
+        tight_loop_contents();
+    }
+
+    if (DmaFill) {
+        dma_channel_config cfg = dma_get_channel_config(spi_dma_chan);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+        channel_config_set_read_increment(&cfg, true);
+        dma_channel_set_config(spi_dma_chan, &cfg, false);
+        spi_set_format(SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+        DmaFill = false;
+    }
+
+    DmaChained = false;
+    if (DmaDone != NULL) {
+        DmaDoneCore = get_core_num();
+        DmaDone();
+        DmaDoneCore = -1;
+    }
+    if (!DmaChained) {
+        DmaActive = false;
+    }
+}
+
+/******************************************************************************
+function:	SPI DMA channel setup, paced by the SPI TX request
+parameter:
+******************************************************************************/
+static void DEV_SPI_DMA_Init(void)
+{
+    if (spi_dma_chan >= 0) {
+        return;
+    }
+
+    spi_dma_chan = dma_claim_unused_channel(true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(spi_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, spi_get_dreq(SPI_PORT, true));
+    dma_channel_configure(spi_dma_chan, &cfg, &spi_get_hw(SPI_PORT)->dr, NULL, 0, false);
+
+    dma_channel_set_irq0_enabled(spi_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, DEV_SPI_DMA_Handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+/******************************************************************************
+function:	SPI write by DMA, returns at once
+parameter:
+		pData	： First row of data, must stay untouched until Done
+		Len		： Bytes per row
+		Stride	： Distance in bytes between two rows
+		Count	： Number of rows
+		Done	： Called from the DMA interrupt when all rows are out, or NULL
+Info:
+    A transfer still in flight is waited for first.
+******************************************************************************/
+void DEV_SPI_Write_nByte_DMA(const uint8_t *pData, uint32_t Len, uint32_t Stride, uint32_t Count, void (*Done)(void))
+{
+    DEV_SPI_DMA_Wait();
+
+    if (Len == 0 || Count == 0) {
+        if (Done != NULL) {
+            Done();
+        }
+        return;
+    }
+
+    // Back to back rows go out as one transfer
+    if (Stride == Len) {
+        Len *= Count;
+        Count = 1;
+    }
+
+    DmaAddr = pData;
+    DmaLen = Len;
+    DmaStride = Stride;
+    DmaCount = Count;
+    DmaDone = Done;
+    DmaChained = true;
+    DmaActive = true;
+
+    dma_channel_transfer_from_buffer_now(spi_dma_chan, pData, Len);
+}
+
+/******************************************************************************
+function:	SPI write of one 16 bit value Count times by DMA, returns at once
+parameter:
+		Value	： Value to repeat, goes out high byte first
+		Count	： Number of values
+		Done	： Called from the DMA interrupt when all values are out, or NULL
+Info:
+    The DMA reads the same word over and over while the SPI runs with
+    16 bit frames, no buffer is needed. The SPI is back to 8 bit frames
+    before Done is called.
+******************************************************************************/
+void DEV_SPI_Fill_DMA(uint16_t Value, uint32_t Count, void (*Done)(void))
+{
+    DEV_SPI_DMA_Wait();
+
+    if (Count == 0) {
+        if (Done != NULL) {
+            Done();
+        }
+        return;
+    }
+
+    DmaFillValue = Value;
+    DmaCount = 1;
+    DmaDone = Done;
+    DmaFill = true;
+    DmaChained = true;
+    DmaActive = true;
+
+    spi_set_format(SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+
+    dma_channel_config cfg = dma_get_channel_config(spi_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, false);
+    dma_channel_configure(spi_dma_chan, &cfg, &spi_get_hw(SPI_PORT)->dr, &DmaFillValue, Count, true);
+}
+
+/******************************************************************************
+function:	Move the SPI DMA interrupt to another core
+parameter:
+Info:
+    DEV_SPI_DMA_Release() waits for the transfer in flight and stops
+    taking the interrupt on the calling core, the other core then calls
+    DEV_SPI_DMA_Claim(). Only that core may use DEV_SPI_ from there on.
+******************************************************************************/
+void DEV_SPI_DMA_Release(void)
+{
+    DEV_SPI_DMA_Wait();
+    irq_set_enabled(DMA_IRQ_0, false);
+}
+
+void DEV_SPI_DMA_Claim(void)
+{
+    irq_set_enabled(DMA_IRQ_0, true);
+    DEV_Cycles_Init();  // The counters are kept here now
+}
+
+bool DEV_SPI_DMA_Busy(void)
+{
+    return DmaActive;
+}
+
+void DEV_SPI_DMA_Wait(void)
+{
+    // From the Done callback the channel is idle, see DEV_SPI_DMA_Handler()
+    while (DmaActive && DmaDoneCore != (int)get_core_num()) {
+        tight_loop_contents();
+    }
+}
+
 
 
 /******************************************************************************
@@ -141,6 +339,25 @@ void DEV_Delay_us(UDOUBLE xus)
     sleep_us(xus);
 }
 
+/******************************************************************************
+function:	Time stamps
+parameter:
+Info:
+    Each core has its own SysTick, DEV_Cycles_Init() runs it free on the
+    calling core.
+******************************************************************************/
+uint64_t DEV_Time_us(void)
+{
+    return time_us_64();
+}
+
+void DEV_Cycles_Init(void)
+{
+    systick_hw->rvr = 0xFFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;  // Enabled on the processor clock, no interrupt
+}
+
 
 /******************************************************************************
 function:	GPIO initialization
@@ -187,6 +404,8 @@ UBYTE DEV_Module_Init(void)
     spi_init(SPI_PORT, 10000 * 1000);
     gpio_set_function(EPD_CLK_PIN, GPIO_FUNC_SPI);
     gpio_set_function(EPD_MOSI_PIN, GPIO_FUNC_SPI);
+    DEV_SPI_DMA_Init();
+    DEV_Cycles_Init();
     
     // GPIO Config
     DEV_GPIO_Init();
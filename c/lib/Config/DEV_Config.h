@@ -33,6 +33,8 @@
 #include "stdio.h"
 #include "hardware/i2c.h"
 #include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/structs/systick.h"
 
 /**
  * data
@@ -64,6 +66,29 @@ UBYTE DEV_Digital_Read(UWORD Pin);
 void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
 
+void DEV_SPI_Write_nByte_DMA(const uint8_t *pData, uint32_t Len, uint32_t Stride, uint32_t Count, void (*Done)(void));
+void DEV_SPI_Fill_DMA(uint16_t Value, uint32_t Count, void (*Done)(void));
+bool DEV_SPI_DMA_Busy(void);
+void DEV_SPI_DMA_Wait(void);
+void DEV_SPI_DMA_Release(void);
+void DEV_SPI_DMA_Claim(void);
+
+/**
+ * Time stamps for performance counters. DEV_Cycles() reads the SysTick
+ * of the calling core, a 24 bit down counter at the CPU clock started by
+ * DEV_Cycles_Init(), so a span must stay below 2^24 cycles (134 ms).
+**/
+uint64_t DEV_Time_us(void);
+void DEV_Cycles_Init(void);
+static inline UDOUBLE DEV_Cycles(void)
+{
+    return systick_hw->cvr;
+}
+static inline UDOUBLE DEV_Cycles_Since(UDOUBLE Start)
+{
+    return (Start - systick_hw->cvr) & 0xFFFFFF;
+}
+
 void DEV_Delay_ms(UDOUBLE xms);
 void DEV_Delay_us(UDOUBLE xus);
 
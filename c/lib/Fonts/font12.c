@@ -1379,6 +1379,7 @@ sFONT Font12 = {
   Font12_Table,
   7, /* Width */
   12, /* Height */
+  NULL, /* Packed */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -519,6 +519,7 @@ cFONT Font24CN = {
   24, /* ASCII Width */
   32, /* Width */
   41, /* Height */
+  &Font24CN_Index,
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -49,14 +49,33 @@
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include <stdint.h>
 
+//Packed ASCII, made by tools/fontpack.py
+typedef struct
+{
+  uint16_t Offset;          // First row in Runs
+  uint8_t Top;              // Blank rows above the first one kept
+  uint8_t Rows;             // Rows kept, 0 for a blank glyph
+  uint8_t Advance;          // Pixels to the next glyph
+} pGLYPH;
+
+typedef struct
+{
+  const pGLYPH *Glyphs;     // From First to Last
+  const uint8_t *Runs;      // Per row a count, then (column << 4) | (pixels - 1) per run
+  uint8_t First;
+  uint8_t Last;
+} pFONT;
+
 //ASCII
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const pFONT *Packed;      // Instead of table when not NULL
   
 } sFONT;
 
@@ -69,6 +88,14 @@ typedef struct                                          // 
 }CH_CN;
 
 
+//Sorted index of a GB2312 table, made by tools/cnindex.py
+typedef struct
+{
+  const uint16_t *Keys;     // (index[0] << 8) | index[1], ascending
+  const uint16_t *Entries;  // The table entry of each key
+  uint16_t Size;
+} cINDEX;
+
 typedef struct
 {    
   const CH_CN *table;
@@ -76,6 +103,7 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const cINDEX *Index;      // The table is scanned when NULL
   
 }cFONT;
 
@@ -87,6 +115,9 @@ extern sFONT Font8;
 
 extern cFONT Font12CN;
 extern cFONT Font24CN;
+
+extern const cINDEX Font12CN_Index;
+extern const cINDEX Font24CN_Index;
 #ifdef __cplusplus
 }
 #endif
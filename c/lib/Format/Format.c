@@ -0,0 +1,331 @@
+/*****************************************************************************
+* | File      	:   Format.c
+* | Function    :   Bounded text formatting without floating point
+* | Info        :
+*   Integers are converted with 32 bit divisions unless they need 64 bits,
+*   the Cortex-M0+ has no divider of its own and no FPU.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-13
+* | Info        :
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#include <stdbool.h>
+#include <string.h>
+#include "Format.h"
+
+#define FORMAT_DIGITS   24      // The digits of a 64 bit integer
+
+/**
+ * The output so far, Len never reaches Size
+ */
+typedef struct {
+    char *Buf;
+    size_t Size;
+    size_t Len;
+} FORMAT_OUT;
+
+static void Format_Put(FORMAT_OUT *Out, char Ch, size_t Count)
+{
+    while (Count-- > 0 && Out->Len + 1 < Out->Size) {
+        Out->Buf[Out->Len++] = Ch;
+    }
+}
+
+static void Format_Puts(FORMAT_OUT *Out, const char *Str, size_t Len)
+{
+    if (Len > Out->Size - 1 - Out->Len) {
+        Len = Out->Size - 1 - Out->Len;
+    }
+    memcpy(&Out->Buf[Out->Len], Str, Len);
+    Out->Len += Len;
+}
+
+/******************************************************************************
+function:	The digits of an unsigned integer
+parameter:
+    End   : Just after the last digit, they are written backwards
+    Value : The integer
+    Base  : 10 or 16
+    Upper : Upper case hex digits
+return:
+    The first digit
+******************************************************************************/
+static char *Format_Digits(char *End, uint64_t Value, unsigned Base, bool Upper)
+{
+    const char *Digits = Upper? "0123456789ABCDEF" : "0123456789abcdef";
+    uint32_t Low;
+
+    while (Value > UINT32_MAX) {
+        *--End = Digits[Value % Base];
+        Value /= Base;
+    }
+    Low = (uint32_t)Value;
+    do {
+        *--End = Digits[Low % Base];
+        Low /= Base;
+    } while (Low != 0);
+
+    return End;
+}
+
+/******************************************************************************
+function:	A converted field with its sign, padding and precision
+parameter:
+    Out       : The output
+    Sign      : '-', '+', ' ' or 0 for none
+    Str, Len  : The digits or the text
+    Width     : The least characters of the field
+    Zeros     : The least digits, from the precision
+    Left      : Left aligned, padded with spaces on the right
+    ZeroPad   : Padded with zeros between the sign and the digits
+******************************************************************************/
+static void Format_Field(FORMAT_OUT *Out, char Sign, const char *Str, size_t Len,
+                         size_t Width, size_t Zeros, bool Left, bool ZeroPad)
+{
+    size_t Used = (Sign? 1 : 0) + (Zeros > Len? Zeros : Len);
+    size_t Pad = Width > Used? Width - Used : 0;
+
+    if (!Left && !ZeroPad) {
+        Format_Put(Out, ' ', Pad);
+    }
+    if (Sign) {
+        Format_Put(Out, Sign, 1);
+    }
+    if (!Left && ZeroPad) {
+        Format_Put(Out, '0', Pad);
+    }
+    if (Zeros > Len) {
+        Format_Put(Out, '0', Zeros - Len);
+    }
+    Format_Puts(Out, Str, Len);
+    if (Left) {
+        Format_Put(Out, ' ', Pad);
+    }
+}
+
+/******************************************************************************
+function:	Format into a buffer of Size bytes, see Format.h
+parameter:
+    Buf    : The buffer, always terminated if Size > 0
+    Size   : Its size
+    Format : The format
+    Args   : The values
+return:
+    The characters written, the terminator not counted
+******************************************************************************/
+size_t Format_VString(char *Buf, size_t Size, const char *Format, va_list Args)
+{
+    FORMAT_OUT Out = { Buf, Size, 0 };
+    char Digits[FORMAT_DIGITS];
+    const char *Start;
+
+    if (Size == 0) {
+        return 0;
+    }
+
+    while (*Format != '\0') {
+        bool Left = false, ZeroPad = false;
+        char Sign = 0, Plus = 0;
+        size_t Width = 0;
+        int Precision = -1;
+        int Long = 0;
+        uint64_t Value;
+        bool Negative = false;
+        char *Str;
+
+        if (*Format != '%') {
+            Start = Format;
+            while (*Format != '\0' && *Format != '%') {
+                Format++;
+            }
+            Format_Puts(&Out, Start, Format - Start);
+            continue;
+        }
+        Start = Format++;
+
+        // Flags
+        for (;; Format++) {
+            if (*Format == '-') {
+                Left = true;
+            } else if (*Format == '0') {
+                ZeroPad = true;
+            } else if (*Format == '+' || (*Format == ' ' && Plus == 0)) {
+                Plus = *Format;
+            } else {
+                break;
+            }
+        }
+
+        // Width and precision
+        if (*Format == '*') {
+            int Arg = va_arg(Args, int);
+            if (Arg < 0) {
+                Left = true;
+                Arg = -Arg;
+            }
+            Width = Arg;
+            Format++;
+        } else {
+            while (*Format >= '0' && *Format <= '9') {
+                Width = Width * 10 + *Format++ - '0';
+            }
+        }
+        if (*Format == '.') {
+            Format++;
+            Precision = 0;
+            if (*Format == '*') {
+                Precision = va_arg(Args, int);
+                Format++;
+            } else {
+                while (*Format >= '0' && *Format <= '9') {
+                    Precision = Precision * 10 + *Format++ - '0';
+                }
+            }
+        }
+
+        // Length, hh and h are promoted to int anyway
+        while (*Format == 'h') {
+            Format++;
+        }
+        if (*Format == 'l') {
+            Long = 1;
+            if (*++Format == 'l') {
+                Long = 2;
+                Format++;
+            }
+        } else if (*Format == 'z') {
+            Long = sizeof(size_t) > sizeof(long)? 2 : 1;
+            Format++;
+        }
+
+        switch (*Format) {
+        case 'd':
+        case 'i': {
+            int64_t Arg = Long == 2? va_arg(Args, long long) : Long == 1? va_arg(Args, long) : va_arg(Args, int);
+
+            Negative = Arg < 0;
+            Value = Negative? -(uint64_t)Arg : (uint64_t)Arg;
+            Sign = Negative? '-' : Plus;
+            Str = Format_Digits(&Digits[FORMAT_DIGITS], Value, 10, false);
+            Format_Field(&Out, Sign, Str, &Digits[FORMAT_DIGITS] - Str, Width,
+                         Precision > 0? Precision : 0, Left, ZeroPad && Precision < 0);
+            break;
+        }
+        case 'u':
+        case 'x':
+        case 'X':
+            Value = Long == 2? va_arg(Args, unsigned long long) : Long == 1? va_arg(Args, unsigned long) : va_arg(Args, unsigned);
+            Str = Format_Digits(&Digits[FORMAT_DIGITS], Value, *Format == 'u'? 10 : 16, *Format == 'X');
+            Format_Field(&Out, 0, Str, &Digits[FORMAT_DIGITS] - Str, Width,
+                         Precision > 0? Precision : 0, Left, ZeroPad && Precision < 0);
+            break;
+        case 'c':
+            Digits[0] = (char)va_arg(Args, int);
+            Format_Field(&Out, 0, Digits, 1, Width, 0, Left, false);
+            break;
+        case 's': {
+            const char *Arg = va_arg(Args, const char *);
+            size_t Len;
+
+            if (Arg == NULL) {
+                Arg = "(null)";
+            }
+            for (Len = 0; Arg[Len] != '\0' && (Precision < 0 || Len < (size_t)Precision); Len++) {
+            }
+            Format_Field(&Out, 0, Arg, Len, Width, 0, Left, false);
+            break;
+        }
+        case '%':
+            Format_Put(&Out, '%', 1);
+            break;
+        default:
+            // Not ours, leave it as it is
+            if (*Format == '\0') {
+                Format_Puts(&Out, Start, Format - Start);
+                continue;
+            }
+            Format_Puts(&Out, Start, Format + 1 - Start);
+            break;
+        }
+        Format++;
+    }
+
+    Buf[Out.Len] = '\0';
+    return Out.Len;
+}
+
+size_t Format_String(char *Buf, size_t Size, const char *Format, ...)
+{
+    va_list Args;
+    size_t Len;
+
+    va_start(Args, Format);
+    Len = Format_VString(Buf, Size, Format, Args);
+    va_end(Args);
+
+    return Len;
+}
+
+/******************************************************************************
+function:	A fixed point decimal, see Format.h
+parameter:
+    Buf, Size : The buffer and its size
+    Value     : In units of 10^-Decimals
+    Decimals  : Digits after the point, at most FORMAT_DECIMALS_MAX
+return:
+    The characters written
+******************************************************************************/
+size_t Format_Fixed(char *Buf, size_t Size, int32_t Value, uint8_t Decimals)
+{
+    uint32_t Scale = 1, Abs;
+    uint8_t i;
+
+    if (Decimals > FORMAT_DECIMALS_MAX) {
+        Decimals = FORMAT_DECIMALS_MAX;
+    }
+    for (i = 0; i < Decimals; i++) {
+        Scale *= 10;
+    }
+
+    Abs = Value < 0? -(uint32_t)Value : (uint32_t)Value;
+    if (Decimals == 0) {
+        return Format_String(Buf, Size, "%s%lu", Value < 0? "-" : "", (unsigned long)Abs);
+    }
+    return Format_String(Buf, Size, "%s%lu.%0*lu", Value < 0? "-" : "",
+                         (unsigned long)(Abs / Scale), (int)Decimals, (unsigned long)(Abs % Scale));
+}
+
+/******************************************************************************
+function:	Center a text, see Format.h
+parameter:
+    Buf, Size : The buffer and its size
+    Text      : The text, a longer one than Width is left as it is
+    Width     : Characters to center it in
+return:
+    The characters written
+******************************************************************************/
+size_t Format_Center(char *Buf, size_t Size, const char *Text, size_t Width)
+{
+    size_t Len = strlen(Text);
+    int Pad = Len < Width? (Width - Len) / 2 : 0;
+
+    return Format_String(Buf, Size, "%*s%s%*s", Pad, "", Text, Pad, "");
+}
@@ -0,0 +1,64 @@
+/*****************************************************************************
+* | File      	:   Format.h
+* | Function    :   Bounded text formatting without floating point
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-13
+* | Info        :
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+******************************************************************************/
+#ifndef _FORMAT_H_
+#define _FORMAT_H_
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A printf subset for the display and the telnet port, with no floating
+ * point and no heap. The output always fits Size, it is cut and still
+ * terminated, and the length written is returned, not the length it
+ * would have had.
+ *
+ *   %d %i %u %x %X %c %s %%
+ *   flags - 0 + space, a width and a precision, also given as *
+ *   lengths hh h l ll z
+ *
+ * The precision is the most characters of a %s and the least digits of
+ * an integer. Anything else after a % is copied as it is.
+ */
+size_t Format_String(char *Buf, size_t Size, const char *Format, ...);
+size_t Format_VString(char *Buf, size_t Size, const char *Format, va_list Args);
+
+/**
+ * A fixed point decimal, Value is in units of 10^-Decimals,
+ * Format_Fixed(buf, sizeof(buf), 4998, 2) gives "49.98".
+ */
+#define FORMAT_DECIMALS_MAX     9
+
+size_t Format_Fixed(char *Buf, size_t Size, int32_t Value, uint8_t Decimals);
+
+/**
+ * Text centered in Width characters, with as many spaces on each side.
+ */
+size_t Format_Center(char *Buf, size_t Size, const char *Text, size_t Width);
+
+#endif
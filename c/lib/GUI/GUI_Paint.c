@@ -29,6 +29,7 @@
 #include "GUI_Paint.h"
 #include "DEV_Config.h"
 #include "Debug.h"
+#include "Format.h"
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h> //memset()
@@ -36,6 +37,32 @@
 
 PAINT Paint;
 
+static PAINT_AREA DirtyList[PAINT_DIRTY_MAX];
+static UBYTE DirtyCount;
+static UBYTE DirtyHold;     // Set while a caller has already marked its whole area
+
+static const UWORD *PaletteList;
+static UBYTE PaletteCount;
+static UWORD PaletteColor;  // Last color looked up and its index
+static UBYTE PaletteIndex;
+static PAINT_STATS Stats;
+
+/**
+ * A glyph of the cached font in one color pair, see Paint_SetGlyphCache()
+**/
+typedef struct {
+    UDOUBLE Used;           // Clock of its last draw, 0 for a free slot
+    UWORD Fore;
+    UWORD Back;
+    char Ch;
+} PAINT_GLYPH;
+
+static const sFONT *CacheFont;
+static PAINT_GLYPH *CacheSlot;
+static UWORD *CachePixels;  // Font->Width * Font->Height per slot
+static UWORD CacheSlots;
+static UDOUBLE CacheClock;
+
 /******************************************************************************
 function: Create Image
 parameter:
@@ -56,11 +83,13 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
 		
     Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
     Paint.HeightByte = Height;    
+    Paint.BandStart = 0;
 //    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
     Paint.Rotate = Rotate;
     Paint.Mirror = MIRROR_NONE;
+    Paint_ClearDirty();
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
         Paint.Width = Width;
@@ -79,6 +108,30 @@ parameter:
 void Paint_SelectImage(UBYTE *image)
 {
     Paint.Image = image;
+    Paint.BandStart = 0;
+    Paint.HeightByte = Paint.HeightMemory;
+}
+
+/******************************************************************************
+function: Select a band of the picture as the image cache
+parameter:
+    image  : Pointer to the band cache, Height rows of the picture
+    Ystart : First picture row held by the band
+    Height : Rows held by the band
+info:
+    Drawing keeps using picture coordinates, pixels outside the band are
+    dropped. A screen is then built by drawing it once per band into a
+    small strip instead of into a whole frame buffer. Paint_SelectImage()
+    returns to a whole picture cache.
+******************************************************************************/
+void Paint_SelectBand(UBYTE *image, UWORD Ystart, UWORD Height)
+{
+    if(Ystart + Height > Paint.HeightMemory)
+        Height = Paint.HeightMemory - Ystart;
+
+    Paint.Image = image;
+    Paint.BandStart = Ystart;
+    Paint.HeightByte = Height;
 }
 
 /******************************************************************************
@@ -115,6 +168,54 @@ void Paint_SetScale(UBYTE scale)
         Debug("Scale Only support: 2 4 16 65\r\n");
     }
 }
+/******************************************************************************
+function: Set the palette of a scale 16 (4 bit indexed) image
+parameter:
+    Palette : RGB565 color of each index, or NULL
+    Count   : Number of colors, 16 at most
+info:
+    With a palette the drawing functions keep taking RGB565 colors, each
+    is stored as the index of the closest palette color. Without one the
+    color is taken as the index itself.
+******************************************************************************/
+void Paint_SetPalette(const UWORD *Palette, UBYTE Count)
+{
+    PaletteList = Palette;
+    PaletteCount = Count > 16 ? 16 : Count;
+    PaletteColor = Palette != NULL ? Palette[0] : 0;
+    PaletteIndex = 0;
+}
+
+/******************************************************************************
+function: Index of the palette color closest to an RGB565 color
+parameter:
+    Color : RGB565 color
+******************************************************************************/
+static UBYTE Paint_PaletteIndex(UWORD Color)
+{
+    UDOUBLE Best = 0xffffffff;
+    UBYTE i;
+
+    if(PaletteList == NULL)
+        return Color % 16;
+    if(Color == PaletteColor)
+        return PaletteIndex;
+
+    for(i = 0; i < PaletteCount; i++) {
+        int R = (int)(Color >> 11) - (PaletteList[i] >> 11);
+        int G = (int)((Color >> 5) & 0x3f) - ((PaletteList[i] >> 5) & 0x3f);
+        int B = (int)(Color & 0x1f) - (PaletteList[i] & 0x1f);
+        UDOUBLE Distance = 4*R*R + G*G + 4*B*B;
+
+        if(Distance < Best) {
+            Best = Distance;
+            PaletteIndex = i;
+        }
+    }
+    PaletteColor = Color;
+    return PaletteIndex;
+}
+
 /******************************************************************************
 function:	Select Image mirror
 parameter:
@@ -132,6 +233,307 @@ void Paint_SetMirroring(UBYTE mirror)
     }    
 }
 
+/******************************************************************************
+function: Add an area in image memory coordinates to the dirty list
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point (exclusive)
+    Yend   : y end point (exclusive)
+info:
+    An area that overlaps or touches a listed area is merged into it.
+    When the list is full the area is merged into the entry that grows
+    the least, so the list always covers everything drawn since the
+    last flush.
+******************************************************************************/
+static void Paint_AddDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    PAINT_AREA *Area = NULL;
+    UBYTE i;
+
+    if(Xend > Paint.WidthMemory)
+        Xend = Paint.WidthMemory;
+    if(Yend > Paint.HeightMemory)
+        Yend = Paint.HeightMemory;
+    if(Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    for(i = 0; i < DirtyCount; i++) {
+        if(Xstart <= DirtyList[i].Xend && Xend >= DirtyList[i].Xstart &&
+           Ystart <= DirtyList[i].Yend && Yend >= DirtyList[i].Ystart) {
+            Area = &DirtyList[i];
+            break;
+        }
+    }
+
+    if(Area == NULL && DirtyCount < PAINT_DIRTY_MAX) {
+        Area = &DirtyList[DirtyCount++];
+        Area->Xstart = Xstart;
+        Area->Ystart = Ystart;
+        Area->Xend = Xend;
+        Area->Yend = Yend;
+        return;
+    }
+
+    if(Area == NULL) {
+        UDOUBLE Grow, Least = 0xFFFFFFFF;
+        for(i = 0; i < DirtyCount; i++) {
+            UWORD X0 = Xstart < DirtyList[i].Xstart ? Xstart : DirtyList[i].Xstart;
+            UWORD Y0 = Ystart < DirtyList[i].Ystart ? Ystart : DirtyList[i].Ystart;
+            UWORD X1 = Xend > DirtyList[i].Xend ? Xend : DirtyList[i].Xend;
+            UWORD Y1 = Yend > DirtyList[i].Yend ? Yend : DirtyList[i].Yend;
+            Grow = (UDOUBLE)(X1 - X0) * (Y1 - Y0) -
+                   (UDOUBLE)(DirtyList[i].Xend - DirtyList[i].Xstart) * (DirtyList[i].Yend - DirtyList[i].Ystart);
+            if(Grow < Least) {
+                Least = Grow;
+                Area = &DirtyList[i];
+            }
+        }
+    }
+
+    if(Xstart < Area->Xstart) Area->Xstart = Xstart;
+    if(Ystart < Area->Ystart) Area->Ystart = Ystart;
+    if(Xend > Area->Xend) Area->Xend = Xend;
+    if(Yend > Area->Yend) Area->Yend = Yend;
+
+    // The grown area may now cover other entries
+    for(i = 0; i < DirtyCount; ) {
+        PAINT_AREA *Other = &DirtyList[i];
+        if(Other != Area &&
+           Other->Xstart <= Area->Xend && Other->Xend >= Area->Xstart &&
+           Other->Ystart <= Area->Yend && Other->Yend >= Area->Ystart) {
+            if(Other->Xstart < Area->Xstart) Area->Xstart = Other->Xstart;
+            if(Other->Ystart < Area->Ystart) Area->Ystart = Other->Ystart;
+            if(Other->Xend > Area->Xend) Area->Xend = Other->Xend;
+            if(Other->Yend > Area->Yend) Area->Yend = Other->Yend;
+            *Other = DirtyList[--DirtyCount];
+            if(Area == &DirtyList[DirtyCount])
+                Area = Other;
+            i = 0;
+            continue;
+        }
+        i++;
+    }
+}
+
+/******************************************************************************
+function: Map an area of the picture into image memory
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point (exclusive)
+    Yend   : y end point (exclusive)
+    Area   : Set to the same pixels in image memory coordinates
+return:
+    0 when the area is empty after clipping to the picture
+info:
+    The two inclusive corners are rotated and mirrored the same way as
+    Paint_SetPixel() does with single pixels.
+******************************************************************************/
+static UBYTE Paint_MapArea(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, PAINT_AREA *Area)
+{
+    UWORD X0, Y0, X1, Y1, Tmp;
+
+    if(Xend > Paint.Width)
+        Xend = Paint.Width;
+    if(Yend > Paint.Height)
+        Yend = Paint.Height;
+    if(Xstart >= Xend || Ystart >= Yend)
+        return 0;
+
+    switch(Paint.Rotate) {
+    case 0:
+        X0 = Xstart;    Y0 = Ystart;
+        X1 = Xend - 1;  Y1 = Yend - 1;
+        break;
+    case 90:
+        X0 = Paint.WidthMemory - Ystart - 1;    Y0 = Xstart;
+        X1 = Paint.WidthMemory - Yend;          Y1 = Xend - 1;
+        break;
+    case 180:
+        X0 = Paint.WidthMemory - Xstart - 1;    Y0 = Paint.HeightMemory - Ystart - 1;
+        X1 = Paint.WidthMemory - Xend;          Y1 = Paint.HeightMemory - Yend;
+        break;
+    case 270:
+        X0 = Ystart;    Y0 = Paint.HeightMemory - Xstart - 1;
+        X1 = Yend - 1;  Y1 = Paint.HeightMemory - Xend;
+        break;
+    default:
+        return 0;
+    }
+
+    if(Paint.Mirror & MIRROR_HORIZONTAL) {
+        X0 = Paint.WidthMemory - X0 - 1;
+        X1 = Paint.WidthMemory - X1 - 1;
+    }
+    if(Paint.Mirror & MIRROR_VERTICAL) {
+        Y0 = Paint.HeightMemory - Y0 - 1;
+        Y1 = Paint.HeightMemory - Y1 - 1;
+    }
+
+    if(X0 > X1) { Tmp = X0; X0 = X1; X1 = Tmp; }
+    if(Y0 > Y1) { Tmp = Y0; Y0 = Y1; Y1 = Tmp; }
+
+    Area->Xstart = X0;
+    Area->Ystart = Y0;
+    Area->Xend = X1 + 1;
+    Area->Yend = Y1 + 1;
+    return 1;
+}
+
+/******************************************************************************
+function: Mark an area of the picture as changed
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point (exclusive)
+    Yend   : y end point (exclusive)
+info:
+    The coordinates are the same as for the drawing functions and are
+    rotated and mirrored into image memory before being listed.
+******************************************************************************/
+void Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    PAINT_AREA Area;
+
+    if(Paint_MapArea(Xstart, Ystart, Xend, Yend, &Area))
+        Paint_AddDirty(Area.Xstart, Area.Ystart, Area.Xend, Area.Yend);
+}
+
+/******************************************************************************
+function: Forget all dirty areas, e.g. after the whole picture was sent
+parameter:
+******************************************************************************/
+void Paint_ClearDirty(void)
+{
+    DirtyCount = 0;
+}
+
+/******************************************************************************
+function: Get the dirty areas
+parameter:
+    Area : Set to the first entry of the dirty list
+return:
+    The number of entries
+******************************************************************************/
+UBYTE Paint_GetDirty(const PAINT_AREA **Area)
+{
+    *Area = DirtyList;
+    return DirtyCount;
+}
+
+/******************************************************************************
+function: Send only the dirty areas of the picture to the display
+parameter:
+    Flush : Window transfer function, e.g. LCD_1IN14_DisplayWindows
+******************************************************************************/
+void Paint_FlushDirty(PAINT_FLUSH Flush)
+{
+    UBYTE i;
+
+    for(i = 0; i < DirtyCount; i++) {
+        Flush(DirtyList[i].Xstart, DirtyList[i].Ystart,
+              DirtyList[i].Xend, DirtyList[i].Yend, (UWORD *)Paint.Image);
+    }
+    DirtyCount = 0;
+}
+
+/******************************************************************************
+function: Swap the image cache of a double buffered picture
+parameter:
+    image : The other image cache, same size and scale, which the display
+            is done reading
+    Flush : Window transfer function that returns at once, e.g.
+            LCD_1IN14_DisplayWindowsIndexedAsync
+info:
+    The dirty areas of the current cache are copied into image and handed
+    to Flush, then image is the cache drawn into. Drawing goes on while
+    the display reads the other cache, only the next swap has to wait for
+    it. Both caches must hold the whole picture, not a band.
+******************************************************************************/
+void Paint_SwapImage(UBYTE *image, PAINT_FLUSH Flush)
+{
+    UBYTE *Front = Paint.Image;
+    UDOUBLE First, Last, Addr;
+    UBYTE Bits, i;
+    UWORD Y;
+
+    switch(Paint.Scale) {
+    case 2:  Bits = 1;  break;
+    case 4:  Bits = 2;  break;
+    case 16: Bits = 4;  break;
+    default: Bits = 16; break;
+    }
+
+    for(i = 0; i < DirtyCount; i++) {
+        First = (UDOUBLE)DirtyList[i].Xstart * Bits / 8;
+        Last = ((UDOUBLE)DirtyList[i].Xend * Bits + 7) / 8;
+        for(Y = DirtyList[i].Ystart; Y < DirtyList[i].Yend; Y++) {
+            Addr = (UDOUBLE)Y * Paint.WidthByte + First;
+            memcpy(image + Addr, Front + Addr, Last - First);
+        }
+    }
+
+    Paint_FlushDirty(Flush);
+    Paint.Image = image;
+}
+
+/******************************************************************************
+function: Get the drawing counters
+parameter:
+******************************************************************************/
+const PAINT_STATS *Paint_GetStats(void)
+{
+    return &Stats;
+}
+
+void Paint_ClearStats(void)
+{
+    memset(&Stats, 0, sizeof(Stats));
+}
+
+/******************************************************************************
+function: Store one pixel in image memory
+parameter:
+    X, Y  : Image memory coordinates
+    Color : Painted color
+info:
+    Rows outside the selected band are skipped.
+******************************************************************************/
+static void Paint_PutMemory(UWORD X, UWORD Y, UWORD Color)
+{
+    if(Y < Paint.BandStart || Y >= Paint.BandStart + Paint.HeightByte)
+        return;
+    Y -= Paint.BandStart;
+    
+    if(Paint.Scale == 2){
+        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
+        UBYTE Rdata = Paint.Image[Addr];
+        if(Color&0xff == BLACK)
+            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
+        else
+            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
+    }else if(Paint.Scale == 4){
+        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
+        Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
+        UBYTE Rdata = Paint.Image[Addr];
+        
+        Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
+        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
+    }else if(Paint.Scale == 16) {
+        UDOUBLE Addr = X / 2 + Y * Paint.WidthByte;
+        UBYTE Rdata = Paint.Image[Addr];
+        Color = Paint_PaletteIndex(Color);
+        Rdata = Rdata & (~(0xf0 >> ((X % 2)*4)));
+        Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
+    }else if(Paint.Scale == 65) {
+        UDOUBLE Addr = X*2 + Y*Paint.WidthByte;
+        Paint.Image[Addr] = 0xff & (Color>>8);
+        Paint.Image[Addr+1] = 0xff & Color;
+    }
+
+}
+
 /******************************************************************************
 function: Draw Pixels
 parameter:
@@ -139,9 +541,9 @@ parameter:
     Ypoint : At point Y
     Color  : Painted colors
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+static void Paint_PutPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
+    if(Xpoint >= Paint.Width || Ypoint >= Paint.Height){
         Debug("Exceeding display boundaries\r\n");
         return;
     }      
@@ -185,37 +587,91 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
         return;
     }
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
+    if(X >= Paint.WidthMemory || Y >= Paint.HeightMemory){
         Debug("Exceeding display boundaries\r\n");
         return;
     }
-    
-    if(Paint.Scale == 2){
-        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
-        UBYTE Rdata = Paint.Image[Addr];
-        if(Color&0xff == BLACK)
-            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
-        else
-            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    }else if(Paint.Scale == 4){
-        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
-        Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
-        UBYTE Rdata = Paint.Image[Addr];
-        
-        Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
-        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
-    }else if(Paint.Scale == 16) {
-        UDOUBLE Addr = X / 2 + Y * Paint.WidthByte;
-        UBYTE Rdata = Paint.Image[Addr];
-        Color = Color % 16;
-        Rdata = Rdata & (~(0xf0 >> ((X % 2)*4)));
-        Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
-    }else if(Paint.Scale == 65) {
-        UDOUBLE Addr = X*2 + Y*Paint.WidthByte;
-        Paint.Image[Addr] = 0xff & (Color>>8);
-        Paint.Image[Addr+1] = 0xff & Color;
+
+    if(DirtyHold == 0)
+        Paint_AddDirty(X, Y, X + 1, Y + 1);
+
+    Paint_PutMemory(X, Y, Color);
+}
+
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+#if PAINT_PIXEL_STATS
+    UDOUBLE Start = DEV_Cycles();
+
+    Paint_PutPixel(Xpoint, Ypoint, Color);
+    Stats.Pixels++;
+    Stats.PixelCycles += DEV_Cycles_Since(Start);
+#else
+    Paint_PutPixel(Xpoint, Ypoint, Color);
+#endif
+}
+
+/******************************************************************************
+function: Fill RGB565 image memory with one color
+parameter:
+    Image : First pixel, 16 bit aligned
+    Color : Painted color
+    Count : Number of pixels
+info:
+    Stores two pixels per 32 bit word.
+******************************************************************************/
+static void Paint_FillWords(UWORD *Image, UWORD Color, UDOUBLE Count)
+{
+    // Image memory holds the high byte first
+    UWORD Pixel = (Color >> 8) | (Color << 8);
+    UDOUBLE Pair = Pixel | ((UDOUBLE)Pixel << 16);
+    UDOUBLE *Word;
+
+    if(Count > 0 && ((uintptr_t)Image & 2)) {
+        *Image++ = Pixel;
+        Count--;
     }
+    for(Word = (UDOUBLE *)Image; Count >= 2; Count -= 2)
+        *Word++ = Pair;
+    if(Count > 0)
+        *(UWORD *)Word = Pixel;
+}
+
+/******************************************************************************
+function: Fill a run of pixels in one row of image memory
+parameter:
+    X, Y  : First pixel, image memory coordinates
+    Count : Number of pixels, they must fit the row
+    Color : Painted color
+info:
+    RGB565 is stored two pixels per word and 4 bit indexed two pixels per
+    byte, the other scales pixel by pixel. Rows outside the selected band
+    are skipped.
+******************************************************************************/
+static void Paint_FillSpan(UWORD X, UWORD Y, UWORD Count, UWORD Color)
+{
+    UBYTE *Row;
+
+    if(Y < Paint.BandStart || Y >= Paint.BandStart + Paint.HeightByte)
+        return;
+    Row = &Paint.Image[(UDOUBLE)(Y - Paint.BandStart) * Paint.WidthByte];
 
+    if(Paint.Scale == 65) {
+        Paint_FillWords((UWORD *)&Row[X * 2], Color, Count);
+    } else if(Paint.Scale == 16) {
+        Color = Paint_PaletteIndex(Color);
+        if(Count > 0 && (X & 1)) {
+            Row[X / 2] = (Row[X / 2] & 0xf0) | Color;
+            X++;
+            Count--;
+        }
+        memset(&Row[X / 2], (Color << 4) | Color, Count / 2);
+        if(Count & 1)
+            Row[(X + Count) / 2] = (Row[(X + Count) / 2] & 0x0f) | (Color << 4);
+    } else {
+        while(Count-- > 0)
+            Paint_PutMemory(X++, Y, Color);
+    }
 }
 
 /******************************************************************************
@@ -225,6 +681,8 @@ parameter:
 ******************************************************************************/
 void Paint_Clear(UWORD Color)
 {
+    Paint_AddDirty(0, Paint.BandStart, Paint.WidthMemory, Paint.BandStart + Paint.HeightByte);
+
     if(Paint.Scale == 2 || Paint.Scale == 4) {
         for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
             for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
@@ -233,21 +691,10 @@ void Paint_Clear(UWORD Color)
             }
         }
     }else if(Paint.Scale == 16) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-                UDOUBLE Addr = X + Y*Paint.WidthByte;
-                Color = Color & 0x0f;
-                Paint.Image[Addr] = (Color<<4) | Color;
-            }
-        }
+        Color = Paint_PaletteIndex(Color);
+        memset(Paint.Image, (Color<<4) | Color, (UDOUBLE)Paint.HeightByte * Paint.WidthByte);
     }else if(Paint.Scale == 65) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-                UDOUBLE Addr = X*2 + Y*Paint.WidthByte;
-                Paint.Image[Addr] = 0xff & (Color>>8);
-                Paint.Image[Addr+1] = 0xff & Color;
-            }
-        }
+        Paint_FillWords((UWORD *)Paint.Image, Color, (UDOUBLE)Paint.HeightByte * Paint.WidthByte / 2);
     }
 }
 
@@ -256,18 +703,87 @@ function: Clear the color of a window
 parameter:
     Xstart : x starting point
     Ystart : Y starting point
-    Xend   : x end point
-    Yend   : y end point
+    Xend   : x end point (exclusive)
+    Yend   : y end point (exclusive)
     Color  : Painted colors
+info:
+    Any rotation and mirroring keeps the window a box in image memory,
+    it is filled a memory row at a time with Paint_FillSpan().
 ******************************************************************************/
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
-        }
+    PAINT_AREA Area;
+    UWORD Y;
+
+    if(!Paint_MapArea(Xstart, Ystart, Xend, Yend, &Area))
+        return;
+    if(DirtyHold == 0)
+        Paint_AddDirty(Area.Xstart, Area.Ystart, Area.Xend, Area.Yend);
+
+    if(Area.Ystart < Paint.BandStart)
+        Area.Ystart = Paint.BandStart;
+    if(Area.Yend > Paint.BandStart + Paint.HeightByte)
+        Area.Yend = Paint.BandStart + Paint.HeightByte;
+    for(Y = Area.Ystart; Y < Area.Yend; Y++)
+        Paint_FillSpan(Area.Xstart, Y, Area.Xend - Area.Xstart, Color);
+}
+
+/******************************************************************************
+function: Draw a horizontal run of pixels
+parameter:
+    Xstart : x starting point
+    Ypoint : The row
+    Width  : Number of pixels, cut at the edge of the picture
+    Color  : Painted color
+******************************************************************************/
+void Paint_DrawSpan(UWORD Xstart, UWORD Ypoint, UWORD Width, UWORD Color)
+{
+    if(Xstart >= Paint.Width)
+        return;
+    if(Width > Paint.Width - Xstart)
+        Width = Paint.Width - Xstart;
+    Paint_ClearWindows(Xstart, Ypoint, Xstart + Width, Ypoint + 1, Color);
+}
+
+/******************************************************************************
+function: Scroll a band of the picture up
+parameter:
+    Ystart : First row of the band
+    Yend   : End row of the band (exclusive)
+    Lines  : Number of rows to scroll
+    Color  : Color of the rows scrolled in at the bottom
+return:
+    1 when scrolled, 0 when the rotation does not keep rows in memory order
+info:
+    Whole memory rows are moved, so the glyphs in the band need no
+    redrawing. Works for every scale with ROTATE_0 and no vertical mirror,
+    on a whole picture cache only.
+******************************************************************************/
+UBYTE Paint_ScrollUp(UWORD Ystart, UWORD Yend, UWORD Lines, UWORD Color)
+{
+    if(Paint.Rotate != ROTATE_0 || (Paint.Mirror & MIRROR_VERTICAL)) {
+        Debug("Paint_ScrollUp needs ROTATE_0 without vertical mirroring\r\n");
+        return 0;
+    }
+    if(Paint.HeightByte != Paint.HeightMemory) {
+        Debug("Paint_ScrollUp needs a whole picture cache\r\n");
+        return 0;
     }
+
+    if(Yend > Paint.Height)
+        Yend = Paint.Height;
+    if(Ystart >= Yend)
+        return 0;
+    if(Lines > Yend - Ystart)
+        Lines = Yend - Ystart;
+
+    memmove(&Paint.Image[(UDOUBLE)Ystart * Paint.WidthByte],
+            &Paint.Image[(UDOUBLE)(Ystart + Lines) * Paint.WidthByte],
+            (UDOUBLE)(Yend - Ystart - Lines) * Paint.WidthByte);
+    Paint_AddDirty(0, Ystart, Paint.WidthMemory, Yend);
+
+    Paint_ClearWindows(0, Yend - Lines, Paint.Width, Yend, Color);
+    return 1;
 }
 
 /******************************************************************************
@@ -308,6 +824,38 @@ void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
     }
 }
 
+/******************************************************************************
+function: Fill a box of points the way Paint_DrawPoint() draws each of them
+parameter:
+    Xstart, Ystart : First point
+    Xend, Yend     : Last point, included
+    Color          : Painted color
+    Dot_Pixel      : Point size, drawn DOT_FILL_AROUND
+info:
+    A point of size n covers 2n-1 pixels each way from x-n, y-n, so a row,
+    a column or a box of points is one box of pixels. It is cut at the
+    edges of the picture.
+******************************************************************************/
+static void Paint_FillPoints(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                             UWORD Color, DOT_PIXEL Dot_Pixel)
+{
+    int X0 = (int)Xstart - (int)Dot_Pixel;
+    int Y0 = (int)Ystart - (int)Dot_Pixel;
+    int X1 = (int)Xend + (int)Dot_Pixel - 1;
+    int Y1 = (int)Yend + (int)Dot_Pixel - 1;
+
+    if(X0 < 0)
+        X0 = 0;
+    if(Y0 < 0)
+        Y0 = 0;
+    if(X1 > Paint.Width)
+        X1 = Paint.Width;
+    if(Y1 > Paint.Height)
+        Y1 = Paint.Height;
+    if(X0 < X1 && Y0 < Y1)
+        Paint_ClearWindows(X0, Y0, X1, Y1, Color);
+}
+
 /******************************************************************************
 function: Draw a line of arbitrary slope
 parameter:
@@ -328,6 +876,14 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
         return;
     }
 
+    // Straight solid lines are a box of points
+    if (Line_Style == LINE_STYLE_SOLID && (Xstart == Xend || Ystart == Yend)) {
+        Paint_FillPoints(Xstart < Xend ? Xstart : Xend, Ystart < Yend ? Ystart : Yend,
+                         Xstart < Xend ? Xend : Xstart, Ystart < Yend ? Yend : Ystart,
+                         Color, Line_width);
+        return;
+    }
+
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
     int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
@@ -390,10 +946,10 @@ void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
     }
 
     if (Draw_Fill) {
-        UWORD Ypoint;
-        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
-        }
+        // The lines of rows Ystart to Yend - 1, as one box of points
+        if (Ystart < Yend)
+            Paint_FillPoints(Xstart < Xend ? Xstart : Xend, Ystart,
+                             Xstart < Xend ? Xend : Xstart, Yend - 1, Color, Line_width);
     } else {
         Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
         Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
@@ -402,6 +958,36 @@ void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
     }
 }
 
+/******************************************************************************
+function: Fill the two rows of a filled circle Dy above and below the center
+parameter:
+    X_Center : Center X coordinate
+    Y_Center : Center Y coordinate
+    Dy       : Row distance from the center
+    Half     : The rows reach Half pixels to each side
+    Color    : Painted color
+info:
+    Paint_DrawPoint() puts a 1 x 1 point one pixel up and to the left,
+    and so do the rows.
+******************************************************************************/
+static void Paint_FillCircleRows(UWORD X_Center, UWORD Y_Center, int16_t Dy, int16_t Half, UWORD Color)
+{
+    int X0 = (int)X_Center - 1 - Half;
+    int X1 = (int)X_Center + Half;
+    int Y = (int)Y_Center - 1 - Dy;
+
+    if(X0 < 0)
+        X0 = 0;
+    if(X1 > Paint.Width)
+        X1 = Paint.Width;
+    if(X0 >= X1)
+        return;
+    if(Y >= 0)
+        Paint_ClearWindows(X0, Y, X1, Y + 1, Color);
+    if(Dy != 0)
+        Paint_ClearWindows(X0, Y + 2 * Dy, X1, Y + 2 * Dy + 1, Color);
+}
+
 /******************************************************************************
 function: Use the 8-point method to draw a circle of the
             specified size at the specified position->
@@ -429,19 +1015,18 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     //Cumulative error,judge the next point of the logo
     int16_t Esp = 3 - (Radius << 1 );
 
-    int16_t sCountY;
+    int16_t YLast;
     if (Draw_Fill == DRAW_FILL_FULL) {
+        // The disc the 8 point method fills, as two rows for each of
+        // XCurrent and YCurrent. A row of YCurrent is drawn when YCurrent
+        // is about to change, with the widest XCurrent it had.
+        Paint_MarkDirty(X_Center > Radius ? X_Center - Radius - 1 : 0,
+                        Y_Center > Radius ? Y_Center - Radius - 1 : 0,
+                        X_Center + Radius, Y_Center + Radius);
+        DirtyHold++;
         while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
+            Paint_FillCircleRows(X_Center, Y_Center, XCurrent, YCurrent, Color);
+            YLast = YCurrent;
             if (Esp < 0 )
                 Esp += 4 * XCurrent + 6;
             else {
@@ -449,7 +1034,10 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
                 YCurrent --;
             }
             XCurrent ++;
+            if (YCurrent != YLast || XCurrent > YCurrent)
+                Paint_FillCircleRows(X_Center, Y_Center, YLast, XCurrent - 1, Color);
         }
+        DirtyHold--;
     } else { //Draw a hollow circle
         while (XCurrent <= YCurrent ) {
             Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
@@ -472,6 +1060,285 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     }
 }
 
+/******************************************************************************
+function: Fast path of Paint_DrawChar() for RGB565 with ROTATE_0 and no mirror
+parameter:
+    Xpoint           ：X coordinate, the glyph must fit the picture
+    Ypoint           ：Y coordinate
+    ptr              ：First byte of the glyph
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Every glyph row is expanded straight into the 16 bit words of the
+    picture row, no Paint_SetPixel() per pixel. Rows outside the selected
+    band are skipped.
+******************************************************************************/
+static void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, const unsigned char *ptr,
+                            sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    // Image memory holds the high byte first
+    UWORD Fore = (Color_Foreground >> 8) | (Color_Foreground << 8);
+    UWORD Back = (Color_Background >> 8) | (Color_Background << 8);
+    UWORD RowBytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+    UWORD *Row;
+    UWORD Page = 0, Pages = Font->Height, Column, i;
+    UDOUBLE Bits, Mask;
+
+    if (Ypoint >= Paint.BandStart + Paint.HeightByte)
+        return;
+    if (Ypoint < Paint.BandStart)
+        Page = Paint.BandStart - Ypoint;
+    if (Ypoint + Pages > Paint.BandStart + Paint.HeightByte)
+        Pages = Paint.BandStart + Paint.HeightByte - Ypoint;
+    if (Page >= Pages)
+        return;
+
+    ptr += Page * RowBytes;
+    Row = (UWORD *)&Paint.Image[Xpoint * 2 + (UDOUBLE)(Ypoint + Page - Paint.BandStart) * Paint.WidthByte];
+
+    for (; Page < Pages; Page ++ ) {
+        Bits = 0;
+        for (i = 0; i < RowBytes; i++)
+            Bits = (Bits << 8) | *ptr++;
+        Mask = (UDOUBLE)1 << (RowBytes * 8 - 1);
+
+        if (FONT_BACKGROUND == Color_Background) {
+            for (Column = 0; Column < Font->Width; Column ++, Mask >>= 1) {
+                if (Bits & Mask)
+                    Row[Column] = Fore;
+            }
+        } else {
+            for (Column = 0; Column < Font->Width; Column ++, Mask >>= 1)
+                Row[Column] = (Bits & Mask) ? Fore : Back;
+        }
+        Row += Paint.WidthByte / 2;
+    }
+}
+
+/******************************************************************************
+function: Set up the glyph cache
+parameter:
+    Font  : The font to cache, NULL to turn the cache off
+    Arena : Memory for the cache, 32 bit aligned
+    Size  : Its size in bytes
+return:
+    The number of glyphs it holds
+info:
+    Paint_DrawChar() keeps the glyphs of Font that it draws with a
+    background, expanded to RGB565 in their colors, and copies them row
+    by row into the picture the next time. That is with scale 65,
+    ROTATE_0 and no mirror. The least recently drawn glyph gives way to
+    a new one. A glyph takes Font->Width * Font->Height * 2 bytes and a
+    few more, Font16 364.
+******************************************************************************/
+UWORD Paint_SetGlyphCache(sFONT* Font, void *Arena, UDOUBLE Size)
+{
+    UDOUBLE Slots;
+
+    CacheFont = NULL;
+    CacheSlots = 0;
+    if (Font == NULL || Arena == NULL)
+        return 0;
+
+    Slots = Size / (sizeof(PAINT_GLYPH) + (UDOUBLE)Font->Width * Font->Height * 2);
+    if (Slots == 0)
+        return 0;
+    CacheSlots = Slots > 0xffff ? 0xffff : Slots;
+    CacheSlot = Arena;
+    CachePixels = (UWORD *)&CacheSlot[CacheSlots];
+    memset(CacheSlot, 0, CacheSlots * sizeof(PAINT_GLYPH));
+    CacheClock = 0;
+    CacheFont = Font;
+    return CacheSlots;
+}
+
+/******************************************************************************
+function: Expand a glyph to RGB565
+parameter:
+    Pixels           : Font->Width * Font->Height pixels, high byte first
+    Acsii_Char       : The character
+    Font             : A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+static void Paint_ExpandGlyph(UWORD *Pixels, const char Acsii_Char,
+                              sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    // Image memory holds the high byte first
+    UWORD Fore = (Color_Foreground >> 8) | (Color_Foreground << 8);
+    UWORD Back = (Color_Background >> 8) | (Color_Background << 8);
+    const pFONT *Packed = Font->Packed;
+    UWORD Page, Column, Count;
+    UDOUBLE i;
+
+    for (i = 0; i < (UDOUBLE)Font->Width * Font->Height; i++)
+        Pixels[i] = Back;
+
+    if (Packed != NULL) {
+        const pGLYPH *Glyph;
+        const uint8_t *Runs;
+        UBYTE Run;
+
+        if ((UBYTE)Acsii_Char < Packed->First || (UBYTE)Acsii_Char > Packed->Last)
+            return;
+        Glyph = &Packed->Glyphs[(UBYTE)Acsii_Char - Packed->First];
+        Runs = &Packed->Runs[Glyph->Offset];
+        for (Page = Glyph->Top; Page < Glyph->Top + Glyph->Rows; Page ++ ) {
+            for (Count = *Runs++; Count > 0; Count --) {
+                Run = *Runs++;
+                for (Column = Run >> 4; Column <= (Run >> 4) + (Run & 0x0f); Column ++)
+                    Pixels[Page * Font->Width + Column] = Fore;
+            }
+        }
+    } else {
+        UWORD RowBytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+        const unsigned char *ptr = &Font->table[(Acsii_Char - ' ') * Font->Height * RowBytes];
+
+        for (Page = 0; Page < Font->Height; Page ++, ptr += RowBytes) {
+            for (Column = 0; Column < Font->Width; Column ++) {
+                if (ptr[Column / 8] & (0x80 >> (Column % 8)))
+                    Pixels[Page * Font->Width + Column] = Fore;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+function: Find a glyph in the cache, expanding it there when missing
+parameter:
+    Acsii_Char       : The character
+    Font             : The cached font
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+return:
+    Its pixels, high byte first
+******************************************************************************/
+static const UWORD *Paint_CachedGlyph(const char Acsii_Char, sFONT* Font,
+                                      UWORD Color_Foreground, UWORD Color_Background)
+{
+    UDOUBLE Size = (UDOUBLE)Font->Width * Font->Height;
+    PAINT_GLYPH *Slot, *Oldest = CacheSlot;
+    UWORD n;
+
+    for (n = 0; n < CacheSlots; n++) {
+        Slot = &CacheSlot[n];
+        if (Slot->Used != 0 && Slot->Ch == Acsii_Char &&
+            Slot->Fore == Color_Foreground && Slot->Back == Color_Background) {
+            Slot->Used = ++CacheClock;
+            Stats.CacheHits++;
+            return &CachePixels[n * Size];
+        }
+        if (Slot->Used < Oldest->Used)
+            Oldest = Slot;
+    }
+
+    n = Oldest - CacheSlot;
+    Paint_ExpandGlyph(&CachePixels[n * Size], Acsii_Char, Font, Color_Foreground, Color_Background);
+    Oldest->Ch = Acsii_Char;
+    Oldest->Fore = Color_Foreground;
+    Oldest->Back = Color_Background;
+    Oldest->Used = ++CacheClock;
+    Stats.CacheMisses++;
+    return &CachePixels[n * Size];
+}
+
+/******************************************************************************
+function: Copy a cached glyph into the picture, RGB565 with ROTATE_0 and no mirror
+parameter:
+    Xpoint : X coordinate, the glyph must fit the picture
+    Ypoint : Y coordinate
+    Pixels : The glyph, high byte first
+    Font   : A structure pointer that displays a character size
+info:
+    Rows outside the selected band are skipped.
+******************************************************************************/
+static void Paint_CopyGlyph(UWORD Xpoint, UWORD Ypoint, const UWORD *Pixels, sFONT* Font)
+{
+    UWORD Page = 0, Pages = Font->Height;
+    UWORD *Row;
+
+    if (Ypoint >= Paint.BandStart + Paint.HeightByte)
+        return;
+    if (Ypoint < Paint.BandStart)
+        Page = Paint.BandStart - Ypoint;
+    if (Ypoint + Pages > Paint.BandStart + Paint.HeightByte)
+        Pages = Paint.BandStart + Paint.HeightByte - Ypoint;
+    if (Page >= Pages)
+        return;
+
+    Pixels += Page * Font->Width;
+    Row = (UWORD *)&Paint.Image[Xpoint * 2 + (UDOUBLE)(Ypoint + Page - Paint.BandStart) * Paint.WidthByte];
+
+    for (; Page < Pages; Page ++ ) {
+        memcpy(Row, Pixels, Font->Width * 2);
+        Pixels += Font->Width;
+        Row += Paint.WidthByte / 2;
+    }
+}
+
+/******************************************************************************
+function: Paint_DrawChar() of a packed font, see tools/fontpack.py
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters, blank if the
+                       font left it out
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    A row is the background span with the runs of the foreground over
+    it. RGB565 with ROTATE_0 and no mirror fills the picture memory
+    straight away, else every span goes through Paint_DrawSpan().
+******************************************************************************/
+static void Paint_DrawPacked(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                             sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    const pFONT *Packed = Font->Packed;
+    const pGLYPH *Glyph = NULL;
+    const uint8_t *Runs = NULL;
+    void (*Span)(UWORD X, UWORD Y, UWORD Count, UWORD Color) = Paint_DrawSpan;
+    UWORD Page, Count;
+    UBYTE Run;
+
+    if ((UBYTE)Acsii_Char >= Packed->First && (UBYTE)Acsii_Char <= Packed->Last) {
+        Glyph = &Packed->Glyphs[(UBYTE)Acsii_Char - Packed->First];
+        Runs = &Packed->Runs[Glyph->Offset];
+    }
+    if (Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE &&
+        Xpoint + Font->Width <= Paint.WidthMemory)
+        Span = Paint_FillSpan;
+
+    DirtyHold++;
+    for (Page = 0; Page < Font->Height; Page ++ ) {
+        if (FONT_BACKGROUND != Color_Background)
+            Span(Xpoint, Ypoint + Page, Font->Width, Color_Background);
+        if (Glyph == NULL || Page < Glyph->Top || Page >= Glyph->Top + Glyph->Rows)
+            continue;
+        for (Count = *Runs++; Count > 0; Count --) {
+            Run = *Runs++;
+            Span(Xpoint + (Run >> 4), Ypoint + Page, (Run & 0x0f) + 1, Color_Foreground);
+        }
+    }
+    DirtyHold--;
+}
+
+/******************************************************************************
+function: The pixels from a character to the next one
+parameter:
+    Acsii_Char : The character
+    Font       : A structure pointer that displays a character size
+******************************************************************************/
+static UWORD Paint_Advance(const char Acsii_Char, sFONT* Font)
+{
+    const pFONT *Packed = Font->Packed;
+
+    if (Packed != NULL && (UBYTE)Acsii_Char >= Packed->First && (UBYTE)Acsii_Char <= Packed->Last)
+        return Packed->Glyphs[(UBYTE)Acsii_Char - Packed->First].Advance;
+    return Font->Width;
+}
+
 /******************************************************************************
 function: Show English characters
 parameter:
@@ -492,9 +1359,33 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
         return;
     }
 
+    Stats.Glyphs++;
+
+    Paint_MarkDirty(Xpoint, Ypoint, Xpoint + Font->Width, Ypoint + Font->Height);
+
+    UBYTE Direct = Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE &&
+        Xpoint + Font->Width <= Paint.WidthMemory && Ypoint + Font->Height <= Paint.HeightMemory;
+
+    if (Direct && Font == CacheFont && FONT_BACKGROUND != Color_Background) {
+        Paint_CopyGlyph(Xpoint, Ypoint, Paint_CachedGlyph(Acsii_Char, Font, Color_Foreground, Color_Background), Font);
+        return;
+    }
+
+    if (Font->Packed != NULL) {
+        Paint_DrawPacked(Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
+        return;
+    }
+
     uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     const unsigned char *ptr = &Font->table[Char_Offset];
 
+    if (Direct) {
+        Paint_DrawGlyph(Xpoint, Ypoint, ptr, Font, Color_Foreground, Color_Background);
+        return;
+    }
+
+    DirtyHold++;
+
     for (Page = 0; Page < Font->Height; Page ++ ) {
         for (Column = 0; Column < Font->Width; Column ++ ) {
 
@@ -519,6 +1410,7 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
         if (Font->Width % 8 != 0)
             ptr++;
     }// Write all
+    DirtyHold--;
 }
 
 /******************************************************************************
@@ -536,6 +1428,7 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
 {
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
+    uint64_t Start = DEV_Time_us();
 
     if (Xstart > Paint.Width || Ystart > Paint.Height) {
         Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
@@ -556,15 +1449,60 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
         }
         Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
 
+        //The next word of the abscissa increases the font of the broadband
+        Xpoint += Paint_Advance(* pString, Font);
+
         //The next character of the address
         pString ++;
-
-        //The next word of the abscissa increases the font of the broadband
-        Xpoint += Font->Width;
     }
+
+    Stats.Strings++;
+    Stats.StringUs += DEV_Time_us() - Start;
 }
 
 
+/******************************************************************************
+function: Find a character of a GB2312 font
+parameter:
+    font   : The font
+    First  : The first byte of the character
+    Second : The second byte, 0 for an ASCII character
+return:
+    The bitmap of the character, NULL if the font does not have it
+info:
+    A binary search of the sorted index of the table when the font has
+    one, see tools/cnindex.py, else a scan of the table. The ASCII
+    characters of a table have 0 as their second byte.
+******************************************************************************/
+static const char *Paint_FindCN(const cFONT* font, UBYTE First, UBYTE Second)
+{
+    const cINDEX *Index = font->Index;
+    UWORD Key = (First << 8) | Second;
+    UWORD Low, High, Mid, Num;
+
+    if (Index == NULL) {
+        for (Num = 0; Num < font->size; Num++) {
+            if ((UBYTE)font->table[Num].index[0] == First && (UBYTE)font->table[Num].index[1] == Second)
+                return &font->table[Num].matrix[0];
+        }
+        return NULL;
+    }
+
+    // The first key not below Key, the first one of equal keys
+    Low = 0;
+    High = Index->Size;
+    while (Low < High) {
+        Mid = (Low + High) / 2;
+        if (Index->Keys[Mid] < Key)
+            Low = Mid + 1;
+        else
+            High = Mid;
+    }
+    if (Low == Index->Size || Index->Keys[Low] != Key)
+        return NULL;
+    return &font->table[Index->Entries[Low]].matrix[0];
+}
+
 /******************************************************************************
 function: Display the string
 parameter:
@@ -580,85 +1518,59 @@ void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT
                         UWORD Color_Foreground, UWORD Color_Background)
 {
     const char* p_text = pString;
+    const char* ptr;
     int x = Xstart, y = Ystart;
-    int i, j,Num;
+    int i, j;
 
+    DirtyHold++;
     /* Send the string character by character on EPD */
     while (*p_text != 0) {
-        if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
+        UBYTE Ascii = (UBYTE)*p_text <= 0x7F;  //ASCII < 126
+
+        if (!Ascii && *(p_text+1) == 0)
+            break;
+        ptr = Paint_FindCN(font, *p_text, Ascii ? 0 : *(p_text+1));
+        if (ptr != NULL) {
+            Paint_MarkDirty(x, y, x + font->Width, y + font->Height);
+
+            for (j = 0; j < font->Height; j++) {
+                for (i = 0; i < font->Width; i++) {
+                    if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
+                        if (*ptr & (0x80 >> (i % 8))) {
+                            Paint_SetPixel(x + i, y + j, Color_Foreground);
+                            // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
                         }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
+                    } else {
+                        if (*ptr & (0x80 >> (i % 8))) {
+                            Paint_SetPixel(x + i, y + j, Color_Foreground);
+                            // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                        } else {
+                            Paint_SetPixel(x + i, y + j, Color_Background);
+                            // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
                         }
                     }
-                    break;
+                    if (i % 8 == 7) {
+                        ptr++;
+                    }
+                }
+                if (font->Width % 8 != 0) {
+                    ptr++;
                 }
             }
+        }
+        if (Ascii) {
             /* Point on the next character */
             p_text += 1;
             /* Decrement the column position by 16 */
             x += font->ASCII_Width;
         } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if((*p_text== font->table[Num].index[0]) && (*(p_text+1) == font->table[Num].index[1])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
             /* Point on the next character */
             p_text += 2;
             /* Decrement the column position by 16 */
             x += font->Width;
         }
     }
+    DirtyHold--;
 }
 
 /******************************************************************************
@@ -671,55 +1583,59 @@ parameter:
 	Digit						 : Fractional width
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
+info:
+    Kept only for compatibility, callers should use Paint_DrawFixed(),
+    which needs no floating point. The number is rounded to the nearest
+    fraction and held to what Paint_DrawFixed() takes.
 ******************************************************************************/
-#define  ARRAY_LEN 255
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, double Nummber,
                    sFONT* Font, UWORD Digit,UWORD Color_Foreground, UWORD Color_Background)
 {
-    int16_t Num_Bit = 0, Str_Bit = 0;
-    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
-    uint8_t *pStr = Str_Array;
-	int temp = Nummber;
-	float decimals;
-	uint8_t i;
+    int32_t Scale = 1, Value;
+    double Scaled;
+    UWORD i;
+
+    if(Digit > FORMAT_DECIMALS_MAX)
+        Digit = FORMAT_DECIMALS_MAX;
+    for(i = 0; i < Digit; i++)
+        Scale *= 10;
+
+    // Half away from zero, 0.29 is 28.999... hundredths
+    Scaled = Nummber * Scale;
+    Scaled += Scaled < 0 ? -0.5 : 0.5;
+    if(Scaled >= INT32_MAX)
+        Value = INT32_MAX;
+    else if(Scaled > -INT32_MAX)
+        Value = (int32_t)Scaled;
+    else
+        Value = -INT32_MAX;     // Also for NaN
+
+    Paint_DrawFixed(Xpoint, Ypoint, Value, Font, Digit, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function:	Display a fixed point nummber
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    Value            : The number in units of 10^-Digit, e.g. 4998 for 49.98
+    Font             ：A structure pointer that displays a character size
+    Digit            : Fractional width
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawFixed(UWORD Xpoint, UWORD Ypoint, int32_t Value,
+                     sFONT* Font, UWORD Digit, UWORD Color_Foreground, UWORD Color_Background)
+{
+    char Str[16];
+
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DisNum Input exceeds the normal display range\r\n");
+        Debug("Paint_DrawFixed Input exceeds the normal display range\r\n");
         return;
     }
 
-	if(Digit > 0) {		
-		decimals = Nummber - temp;
-		for(i=Digit; i > 0; i--) {
-			decimals*=10;
-		}
-		temp = decimals;
-		//Converts a number to a string
-		for(i=Digit; i>0; i--) {
-			Num_Array[Num_Bit] = temp % 10 + '0';
-			Num_Bit++;
-			temp /= 10;						
-		}	
-		Num_Array[Num_Bit] = '.';
-		Num_Bit++;
-	}
-
-	temp = Nummber;
-    //Converts a number to a string
-    while (temp) {
-        Num_Array[Num_Bit] = temp % 10 + '0';
-        Num_Bit++;
-        temp /= 10;
-    }
-		
-    //The string is inverted
-    while (Num_Bit > 0) {
-        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
-        Str_Bit ++;
-        Num_Bit --;
-    }
-
-    //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
+    Format_Fixed(Str, sizeof(Str), Value, Digit);
+    Paint_DrawString_EN(Xpoint, Ypoint, Str, Font, Color_Background, Color_Foreground);
 }
 
 /******************************************************************************
@@ -754,8 +1670,17 @@ void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
 
 void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
 {
-    int i,j; 
-		for(j = 0; j < H_Image; j++){
+    int i,j,jend = H_Image; 
+		Paint_MarkDirty(xStart, yStart, xStart + W_Image, yStart + H_Image);
+		DirtyHold++;
+		j = 0;
+		if(Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE) {//Only the rows of the selected band
+			if(yStart < Paint.BandStart)
+				j = Paint.BandStart - yStart;
+			if(yStart + jend > Paint.BandStart + Paint.HeightByte)
+				jend = Paint.BandStart + Paint.HeightByte - yStart;
+		}
+		for(; j < jend; j++){
 			for(i = 0; i < W_Image; i++){
 				if(xStart+i < Paint.WidthMemory  &&  yStart+j < Paint.HeightMemory)//Exceeded part does not display
 					Paint_SetPixel(xStart + i, yStart + j, (*(image + j*W_Image*2 + i*2+1))<<8 | (*(image + j*W_Image*2 + i*2)));
@@ -764,6 +1689,134 @@ void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWO
 				//i*2              	   X offset
 			}
 		} 
+		DirtyHold--;
+}
+
+/******************************************************************************
+function:	Copy a block of RGB565 pixels into the picture
+parameter:
+    Xstart : X coordinate
+    Ystart : Y coordinate
+    Width  : Block width
+    Height : Block height
+    Image  : First pixel, two bytes high byte first as in the image memory,
+             e.g. made by c/tools/img2rle.py --raw
+    Stride : Bytes from one block row to the next
+info:
+    With RGB565, ROTATE_0 and no mirror every row inside the picture and
+    the selected band is a single memcpy(). Otherwise pixel by pixel.
+******************************************************************************/
+void Paint_BlitRGB565(UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height, const UBYTE *Image, UDOUBLE Stride)
+{
+    int i, j = 0, jend = Height;
+    const UBYTE *ptr;
+
+    Paint_MarkDirty(Xstart, Ystart, Xstart + Width, Ystart + Height);
+
+    if(Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE) {
+        if(Xstart >= Paint.WidthMemory)
+            return;
+        if(Xstart + Width > Paint.WidthMemory)
+            Width = Paint.WidthMemory - Xstart;
+        if(Ystart < Paint.BandStart)
+            j = Paint.BandStart - Ystart;
+        if(Ystart + jend > Paint.BandStart + Paint.HeightByte)
+            jend = Paint.BandStart + Paint.HeightByte - Ystart;
+
+        for(; j < jend; j++)
+            memcpy(&Paint.Image[Xstart * 2 + (UDOUBLE)(Ystart + j - Paint.BandStart) * Paint.WidthByte],
+                   Image + j * Stride, Width * 2);
+        return;
+    }
+
+    DirtyHold++;
+    for(; j < jend; j++) {
+        ptr = Image + j * Stride;
+        for(i = 0; i < Width; i++, ptr += 2) {
+            if(Xstart + i < Paint.Width && Ystart + j < Paint.Height)
+                Paint_SetPixel(Xstart + i, Ystart + j, ptr[0] << 8 | ptr[1]);
+        }
+    }
+    DirtyHold--;
+}
+
+/******************************************************************************
+function:	Decode a row of a run length coded image
+parameter:
+    Image : Run length coded image
+    Y     : Row of the image
+    Line  : Image->Width pixels, high byte first as in the image memory
+            and on the panel
+******************************************************************************/
+void Paint_ExpandRLE(const PAINT_RLE *Image, UWORD Y, UWORD *Line)
+{
+    const UBYTE *ptr = &Image->Data[Image->Row[Y]];
+    UWORD *End = Line + Image->Width;
+    UWORD Pixel, n;
+
+    while (Line < End) {
+        n = *ptr++;
+        if (n & 0x80) {
+            memcpy(&Pixel, ptr, 2);
+            ptr += 2;
+            for (n = n - 0x80 + 2; n > 0; n--)
+                *Line++ = Pixel;
+        } else {
+            memcpy(Line, ptr, (n + 1) * 2);
+            Line += n + 1;
+            ptr += (n + 1) * 2;
+        }
+    }
+}
+
+/******************************************************************************
+function:	Display a run length coded RGB565 image
+parameter:
+    Image  : Run length coded image
+    xStart : X coordinate
+    yStart : Y coordinate
+info:
+    Only the rows of the selected band are decoded. With RGB565, ROTATE_0
+    and no mirror they are decoded straight into the image memory.
+******************************************************************************/
+void Paint_DrawImageRLE(const PAINT_RLE *Image, UWORD xStart, UWORD yStart)
+{
+    int i, j = 0, jend = Image->Height;
+    UWORD n, Color;
+    const UBYTE *ptr;
+
+    Paint_MarkDirty(xStart, yStart, xStart + Image->Width, yStart + Image->Height);
+    if(Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE) {
+        if(yStart < Paint.BandStart)
+            j = Paint.BandStart - yStart;
+        if(yStart + jend > Paint.BandStart + Paint.HeightByte)
+            jend = Paint.BandStart + Paint.HeightByte - yStart;
+
+        if(Paint.Scale == 65 && xStart + Image->Width <= Paint.WidthMemory) {
+            for(; j < jend; j++)
+                Paint_ExpandRLE(Image, j, (UWORD *)&Paint.Image[xStart * 2 +
+                                (UDOUBLE)(yStart + j - Paint.BandStart) * Paint.WidthByte]);
+            return;
+        }
+    }
+
+    DirtyHold++;
+    for(; j < jend; j++) {
+        ptr = &Image->Data[Image->Row[j]];
+        for(i = 0; i < Image->Width; ) {
+            n = *ptr++;
+            if(n & 0x80) {
+                Color = ptr[0] << 8 | ptr[1];
+                ptr += 2;
+                for(n = n - 0x80 + 2; n > 0; n--, i++)
+                    Paint_SetPixel(xStart + i, yStart + j, Color);
+            } else {
+                for(n = n + 1; n > 0; n--, i++, ptr += 2)
+                    Paint_SetPixel(xStart + i, yStart + j, ptr[0] << 8 | ptr[1]);
+            }
+        }
+    }
+    DirtyHold--;
 }
 
 
@@ -780,6 +1833,7 @@ void Paint_DrawBitMap(const unsigned char* image_buffer)
     UWORD x, y;
     UDOUBLE Addr = 0;
 
+    Paint_AddDirty(0, 0, Paint.WidthMemory, Paint.HeightMemory);
     for (y = 0; y < Paint.HeightByte; y++) {
         for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
             Addr = x + y * Paint.WidthByte;
@@ -792,6 +1846,7 @@ void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region)
 {
     UWORD x, y;
     UDOUBLE Addr = 0;
+		Paint_AddDirty(0, 0, Paint.WidthMemory, Paint.HeightMemory);
 		for (y = 0; y < Paint.HeightByte; y++) {
 				for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
 						Addr = x + y * Paint.WidthByte ;
@@ -807,6 +1862,8 @@ void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region)
 					unsigned char chWidth,unsigned char chHeight)
 {
 	uint16_t i, j, byteWidth = (chWidth + 7)/8;
+    Paint_MarkDirty(x, y, x + chWidth, y + chHeight);
+    DirtyHold++;
     for(j = 0; j < chHeight; j ++){
         for(i = 0; i < chWidth; i ++ ) {
             if(*(pBmp + j * byteWidth + i / 8) & (128 >> (i & 7))) {
@@ -814,6 +1871,7 @@ void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region)
             }
         }
     }
+    DirtyHold--;
 }
          
 
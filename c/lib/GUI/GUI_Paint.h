@@ -47,9 +47,60 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    UWORD BandStart;    // First memory row held in Image, see Paint_SelectBand()
 } PAINT;
 extern PAINT Paint;
 
+/**
+ * Dirty region in image memory coordinates, Xend and Yend are exclusive
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} PAINT_AREA;
+#define PAINT_DIRTY_MAX     8
+
+/**
+ * Run length coded RGB565 image, made by c/tools/img2rle.py.
+ * Every row is coded on its own, Row[y] is where it starts in Data.
+ * Packet n < 0x80: n+1 literal pixels follow, n >= 0x80: the next pixel
+ * repeats n-0x80+2 times. Pixels are two bytes, high byte first.
+**/
+typedef struct {
+    UWORD Width;
+    UWORD Height;
+    const UDOUBLE *Row;
+    const UBYTE *Data;
+} PAINT_RLE;
+
+/**
+ * Sends a region of the image to the display, e.g. LCD_1IN14_DisplayWindows
+**/
+typedef void (*PAINT_FLUSH)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+
+/**
+ * Paint_SetPixel() times every pixel it sets when PAINT_PIXEL_STATS is
+ * 1, that costs more than setting it so it is off unless asked for.
+**/
+#ifndef PAINT_PIXEL_STATS
+#define PAINT_PIXEL_STATS   0
+#endif
+
+/**
+ * Drawing counters, see Paint_GetStats()
+**/
+typedef struct {
+    UDOUBLE Glyphs;         // Characters drawn
+    UDOUBLE Strings;        // Paint_DrawString_EN() calls
+    uint64_t StringUs;      // Time spent in them
+    uint64_t Pixels;        // Paint_SetPixel() calls, with PAINT_PIXEL_STATS
+    uint64_t PixelCycles;   // CPU cycles spent in them
+    UDOUBLE CacheHits;      // Glyphs copied from the glyph cache
+    UDOUBLE CacheMisses;    // Glyphs expanded into it
+} PAINT_STATS;
+
 /**
  * Display rotate
 **/
@@ -147,25 +198,42 @@ extern PAINT_TIME sPaint_time;
 //init and Clear
 void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
 void Paint_SelectImage(UBYTE *image);
+void Paint_SelectBand(UBYTE *image, UWORD Ystart, UWORD Height);
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
 void Paint_SetScale(UBYTE scale);
+void Paint_SetPalette(const UWORD *Palette, UBYTE Count);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+UBYTE Paint_ScrollUp(UWORD Ystart, UWORD Yend, UWORD Lines, UWORD Color);
+
+//Dirty regions
+void Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Paint_ClearDirty(void);
+UBYTE Paint_GetDirty(const PAINT_AREA **Area);
+void Paint_FlushDirty(PAINT_FLUSH Flush);
+void Paint_SwapImage(UBYTE *image, PAINT_FLUSH Flush);
+
+//Counters
+const PAINT_STATS *Paint_GetStats(void);
+void Paint_ClearStats(void);
 
 //Drawing
+void Paint_DrawSpan(UWORD Xstart, UWORD Ypoint, UWORD Width, UWORD Color);
 void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
 void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 
 //Display string
+UWORD Paint_SetGlyphCache(sFONT* Font, void *Arena, UDOUBLE Size);
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, double Nummber, sFONT* Font, UWORD Digit,UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawFixed(UWORD Xpoint, UWORD Ypoint, int32_t Value, sFONT* Font, UWORD Digit, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 
 //pic
@@ -173,6 +241,9 @@ void Paint_DrawBitMap(const unsigned char* image_buffer);
 void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region);
 
 void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) ;
+void Paint_DrawImageRLE(const PAINT_RLE *Image, UWORD xStart, UWORD yStart);
+void Paint_BlitRGB565(UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height, const UBYTE *Image, UDOUBLE Stride);
+void Paint_ExpandRLE(const PAINT_RLE *Image, UWORD Y, UWORD *Line);
 
  void Paint_BmpWindows(unsigned char x,unsigned char y,const unsigned char *pBmp,\
 					unsigned char chWidth,unsigned char chHeight);
@@ -0,0 +1,658 @@
+/*****************************************************************************
+* | File        :   GUI_Widget.c
+* | Function    :   Retained widgets on top of GUI_Paint
+* | Info        :
+*   A widget is a box on the screen that remembers what it shows. It is
+*   only redrawn when that changes, and then only its own box or the
+*   damaged part of it, see Widget_Commit(). Without a frame buffer the
+*   boxes are rebuilt a band at a time with Widget_DrawArea().
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-12
+* | Info        :
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include "GUI_Widget.h"
+#include <string.h>
+
+static WIDGET *Widgets;     // In drawing order
+
+/******************************************************************************
+function: Add a widget to the screen, it is drawn at the next commit
+parameter:
+    Widget : A widget made by one of the Widget_New functions
+******************************************************************************/
+void Widget_Add(WIDGET *Widget)
+{
+    WIDGET **Last = &Widgets;
+
+    while(*Last != NULL) {
+        if(*Last == Widget)
+            return;
+        Last = &(*Last)->Next;
+    }
+    Widget->Next = NULL;
+    Widget->Invalid = 1;
+    Widget->Damage.Xstart = Widget->Damage.Xend = 0;
+    *Last = Widget;
+}
+
+/******************************************************************************
+function: Redraw a widget at the next commit
+parameter:
+    Widget : The widget
+******************************************************************************/
+void Widget_Invalidate(WIDGET *Widget)
+{
+    Widget->Invalid = 1;
+}
+
+/******************************************************************************
+function: Redraw a part of a widget at the next commit
+parameter:
+    Widget         : The widget
+    Xstart, Ystart : Top left of the part
+    Xend, Yend     : Bottom right, excluded
+info:
+    The parts damaged before the commit are redrawn as one box around
+    them all.
+******************************************************************************/
+void Widget_Damage(WIDGET *Widget, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    PAINT_AREA *Damage = &Widget->Damage;
+
+    if(Xstart < Widget->Xstart)
+        Xstart = Widget->Xstart;
+    if(Ystart < Widget->Ystart)
+        Ystart = Widget->Ystart;
+    if(Xend > Widget->Xend)
+        Xend = Widget->Xend;
+    if(Yend > Widget->Yend)
+        Yend = Widget->Yend;
+    if(Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    if(Damage->Xstart >= Damage->Xend) {
+        Damage->Xstart = Xstart;
+        Damage->Ystart = Ystart;
+        Damage->Xend = Xend;
+        Damage->Yend = Yend;
+        return;
+    }
+    if(Xstart < Damage->Xstart) Damage->Xstart = Xstart;
+    if(Ystart < Damage->Ystart) Damage->Ystart = Ystart;
+    if(Xend > Damage->Xend) Damage->Xend = Xend;
+    if(Yend > Damage->Yend) Damage->Yend = Yend;
+}
+
+/******************************************************************************
+function: Show or hide a widget, a hidden one is left as its background
+parameter:
+    Widget : The widget
+    Shown  : 1 to show it
+******************************************************************************/
+void Widget_Show(WIDGET *Widget, UBYTE Shown)
+{
+    if(Widget->Shown != Shown) {
+        Widget->Shown = Shown;
+        Widget->Invalid = 1;
+    }
+}
+
+/******************************************************************************
+function: Hide all widgets as the display has been cleared, there is
+          nothing left of them to redraw
+parameter:
+******************************************************************************/
+void Widget_Reset(void)
+{
+    WIDGET *Widget;
+
+    for(Widget = Widgets; Widget != NULL; Widget = Widget->Next) {
+        Widget->Shown = 0;
+        Widget->Invalid = 0;
+        Widget->Damage.Xstart = Widget->Damage.Xend = 0;
+    }
+}
+
+/******************************************************************************
+function: Bring the invalid widgets out, the frame commit
+parameter:
+    Area : Called with the box of each invalid widget, or the damaged part
+           of it. With NULL they are drawn into the Paint image, which
+           marks them dirty for Paint_FlushDirty().
+return:
+    The number of widgets that were invalid or damaged
+******************************************************************************/
+UWORD Widget_Commit(WIDGET_AREA Area)
+{
+    WIDGET *Widget;
+    PAINT_AREA Box;
+    UWORD Count = 0;
+
+    for(Widget = Widgets; Widget != NULL; Widget = Widget->Next) {
+        if(Widget->Invalid) {
+            Box.Xstart = Widget->Xstart;
+            Box.Ystart = Widget->Ystart;
+            Box.Xend = Widget->Xend;
+            Box.Yend = Widget->Yend;
+        } else if(Widget->Shown && Widget->Damage.Xstart < Widget->Damage.Xend) {
+            Box = Widget->Damage;
+        } else {
+            continue;
+        }
+
+        Widget->Invalid = 0;
+        Widget->Damage.Xstart = Widget->Damage.Xend = 0;
+        Count++;
+
+        if(Area != NULL) {
+            Area(Box.Xstart, Box.Ystart, Box.Xend, Box.Yend);
+        } else {
+            if(!Widget->Shown)
+                Paint_ClearWindows(Box.Xstart, Box.Ystart, Box.Xend, Box.Yend, Widget->Back);
+            Widget_DrawArea(Box.Xstart, Box.Ystart, Box.Xend, Box.Yend);
+        }
+    }
+
+    return Count;
+}
+
+/******************************************************************************
+function: Draw the shown widgets that reach into an area
+parameter:
+    Xstart, Ystart : Top left of the area
+    Xend, Yend     : Bottom right, excluded
+info:
+    Hidden widgets are not drawn, what is under them shows. A widget may
+    draw more of its box than the area, at least the area is drawn.
+******************************************************************************/
+void Widget_DrawArea(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    WIDGET *Widget;
+    PAINT_AREA Clip;
+
+    for(Widget = Widgets; Widget != NULL; Widget = Widget->Next) {
+        if(!Widget->Shown || Widget->Xend <= Xstart || Widget->Xstart >= Xend
+           || Widget->Yend <= Ystart || Widget->Ystart >= Yend)
+            continue;
+        Clip.Xstart = Widget->Xstart > Xstart ? Widget->Xstart : Xstart;
+        Clip.Ystart = Widget->Ystart > Ystart ? Widget->Ystart : Ystart;
+        Clip.Xend = Widget->Xend < Xend ? Widget->Xend : Xend;
+        Clip.Yend = Widget->Yend < Yend ? Widget->Yend : Yend;
+        Widget->Draw(Widget, &Clip);
+    }
+}
+
+/******************************************************************************
+function: Draw a text widget
+parameter:
+    Widget : A WIDGET_TEXT
+    Area   : Not used, the text is drawn whole
+******************************************************************************/
+static void Widget_DrawText(const WIDGET *Widget, const PAINT_AREA *Area)
+{
+    const WIDGET_TEXT *Text = (const WIDGET_TEXT *)Widget;
+    UWORD Width = strlen(Text->Text) * Text->Font->Width;
+    UWORD X = Widget->Xstart;
+
+    (void)Area;
+    if(Text->Align == WIDGET_CENTER)
+        X += (Widget->Xend - Widget->Xstart - Width) / 2;
+    else if(Text->Align == WIDGET_RIGHT)
+        X = Widget->Xend - Width;
+
+    Paint_ClearWindows(Widget->Xstart, Widget->Ystart, Widget->Xend, Widget->Yend, Widget->Back);
+    Paint_DrawString_EN(X, Widget->Ystart, Text->Text, Text->Font, Widget->Back, Text->Fore);
+}
+
+/******************************************************************************
+function: Create a text widget, hidden until it gets a text
+parameter:
+    Text           : The widget
+    Xstart, Ystart : Top left
+    Chars          : Width of the box in characters
+    Font           : Font of the text
+    Fore, Back     : Text and background colors
+    Align          : Where a shorter text goes in the box
+******************************************************************************/
+void Widget_NewText(WIDGET_TEXT *Text, UWORD Xstart, UWORD Ystart, UWORD Chars,
+                    sFONT *Font, UWORD Fore, UWORD Back, WIDGET_ALIGN Align)
+{
+    if(Chars > WIDGET_TEXT_MAX)
+        Chars = WIDGET_TEXT_MAX;
+
+    memset(Text, 0, sizeof(*Text));
+    Text->Base.Xstart = Xstart;
+    Text->Base.Ystart = Ystart;
+    Text->Base.Xend = Xstart + Chars * Font->Width;
+    Text->Base.Yend = Ystart + Font->Height;
+    Text->Base.Back = Back;
+    Text->Base.Draw = Widget_DrawText;
+    Text->Font = Font;
+    Text->Fore = Fore;
+    Text->Align = Align;
+}
+
+/******************************************************************************
+function: Set the text of a text widget, it is only redrawn if it changed
+parameter:
+    Text   : The widget
+    String : The new text, cut to the box, NULL hides the widget
+******************************************************************************/
+void Widget_SetText(WIDGET_TEXT *Text, const char *String)
+{
+    UWORD Chars = (Text->Base.Xend - Text->Base.Xstart) / Text->Font->Width;
+    char New[WIDGET_TEXT_MAX+1];
+
+    if(String == NULL) {
+        Widget_Show(&Text->Base, 0);
+        return;
+    }
+
+    strncpy(New, String, Chars);
+    New[Chars] = '\0';
+    if(strcmp(Text->Text, New) != 0) {
+        strcpy(Text->Text, New);
+        Text->Base.Invalid = 1;
+    }
+    Widget_Show(&Text->Base, 1);
+}
+
+/******************************************************************************
+function: Draw an icon widget
+parameter:
+    Widget : A WIDGET_ICON
+    Area   : Not used, the icon is drawn whole
+******************************************************************************/
+static void Widget_DrawIcon(const WIDGET *Widget, const PAINT_AREA *Area)
+{
+    const WIDGET_ICON *Icon = (const WIDGET_ICON *)Widget;
+    UWORD Back = Icon->State? Icon->On : Widget->Back;
+
+    (void)Area;
+    Paint_ClearWindows(Widget->Xstart, Widget->Ystart, Widget->Xend, Widget->Yend, Back);
+    Paint_DrawChar(Widget->Xstart + 1, Widget->Ystart, Icon->Ch, Icon->Font, Icon->Fore, Back);
+}
+
+/******************************************************************************
+function: Create a status icon, shown and off
+parameter:
+    Icon           : The widget
+    Xstart, Ystart : Top left
+    Ch             : The character on it
+    Font           : Font of the character
+    Fore           : Character color
+    On, Back       : Square color when on and when off
+******************************************************************************/
+void Widget_NewIcon(WIDGET_ICON *Icon, UWORD Xstart, UWORD Ystart, char Ch,
+                    sFONT *Font, UWORD Fore, UWORD On, UWORD Back)
+{
+    memset(Icon, 0, sizeof(*Icon));
+    Icon->Base.Xstart = Xstart;
+    Icon->Base.Ystart = Ystart;
+    Icon->Base.Xend = Xstart + Font->Width + 2;
+    Icon->Base.Yend = Ystart + Font->Height;
+    Icon->Base.Back = Back;
+    Icon->Base.Shown = 1;
+    Icon->Base.Draw = Widget_DrawIcon;
+    Icon->Font = Font;
+    Icon->Fore = Fore;
+    Icon->On = On;
+    Icon->Ch = Ch;
+}
+
+/******************************************************************************
+function: Turn a status icon on or off, it is only redrawn if that changes
+parameter:
+    Icon  : The widget
+    State : 1 for on
+******************************************************************************/
+void Widget_SetIcon(WIDGET_ICON *Icon, UBYTE State)
+{
+    State = State? 1 : 0;
+    if(Icon->State != State) {
+        Icon->State = State;
+        Icon->Base.Invalid = 1;
+    }
+    Widget_Show(&Icon->Base, 1);
+}
+
+/******************************************************************************
+function: The row of a value in a trend graph
+parameter:
+    Trend : The widget
+    Value : The value, kept within Low and High
+******************************************************************************/
+static UWORD Widget_TrendY(const WIDGET_TREND *Trend, UBYTE Value)
+{
+    UWORD Rows = Trend->Base.Yend - Trend->Base.Ystart - 1;
+
+    if(Value < Trend->Low)
+        Value = Trend->Low;
+    if(Value > Trend->High)
+        Value = Trend->High;
+    if(Trend->High == Trend->Low)
+        return Trend->Base.Yend - 1;
+
+    return Trend->Base.Yend - 1 - (UDOUBLE)(Value - Trend->Low) * Rows / (Trend->High - Trend->Low);
+}
+
+/******************************************************************************
+function: Draw the columns of a trend graph in an area
+parameter:
+    Widget : A WIDGET_TREND
+    Area   : The columns to draw, all rows of them are drawn
+******************************************************************************/
+static void Widget_DrawTrend(const WIDGET *Widget, const PAINT_AREA *Area)
+{
+    const WIDGET_TREND *Trend = (const WIDGET_TREND *)Widget;
+    UWORD X, C;
+
+    Paint_ClearWindows(Area->Xstart, Widget->Ystart, Area->Xend, Widget->Yend, Widget->Back);
+    Paint_DrawSpan(Area->Xstart, Widget_TrendY(Trend, Trend->High), Area->Xend - Area->Xstart, Trend->Mark);
+    Paint_DrawSpan(Area->Xstart, Widget_TrendY(Trend, Trend->Low), Area->Xend - Area->Xstart, Trend->Mark);
+
+    for(X = Area->Xstart; X < Area->Xend; X++) {
+        C = X - Widget->Xstart;
+        if(Trend->Min[C] > Trend->Max[C])
+            continue;
+        Paint_ClearWindows(X, Widget_TrendY(Trend, Trend->Max[C]),
+                           X + 1, Widget_TrendY(Trend, Trend->Min[C]) + 1, Trend->Fore);
+    }
+}
+
+/******************************************************************************
+function: Create a trend graph, hidden until Widget_SetTrend()
+parameter:
+    Trend          : The widget
+    Xstart, Ystart : Top left
+    Width, Height  : Size of the box, Width is the number of columns
+    Fore           : Sample color
+    Mark           : Color of the lines at Low and High
+    Back           : Background color
+    Period         : Samples per column
+******************************************************************************/
+void Widget_NewTrend(WIDGET_TREND *Trend, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height,
+                     UWORD Fore, UWORD Mark, UWORD Back, UBYTE Period)
+{
+    if(Width > WIDGET_TREND_MAX)
+        Width = WIDGET_TREND_MAX;
+
+    memset(Trend, 0, sizeof(*Trend));
+    Trend->Base.Xstart = Xstart;
+    Trend->Base.Ystart = Ystart;
+    Trend->Base.Xend = Xstart + Width;
+    Trend->Base.Yend = Ystart + Height;
+    Trend->Base.Back = Back;
+    Trend->Base.Draw = Widget_DrawTrend;
+    Trend->Fore = Fore;
+    Trend->Mark = Mark;
+    Trend->Period = Period > 0 ? Period : 1;
+}
+
+/******************************************************************************
+function: Show an empty trend graph
+parameter:
+    Trend     : The widget
+    Low, High : The values at the bottom and at the top
+******************************************************************************/
+void Widget_SetTrend(WIDGET_TREND *Trend, UBYTE Low, UBYTE High)
+{
+    memset(Trend->Min, 0xff, sizeof(Trend->Min));
+    memset(Trend->Max, 0, sizeof(Trend->Max));
+    Trend->Low = Low;
+    Trend->High = High;
+    Trend->Head = 0;
+    Trend->Count = 0;
+    Trend->Base.Invalid = 1;
+    Widget_Show(&Trend->Base, 1);
+}
+
+/******************************************************************************
+function: Add a sample to a trend graph
+parameter:
+    Trend : The widget
+    Value : The sample, cut to 0..255
+info:
+    The first sample of a column empties the gap ahead of it, the others
+    widen its range. Only the columns that change are damaged.
+******************************************************************************/
+void Widget_AddTrend(WIDGET_TREND *Trend, int Value)
+{
+    UWORD Columns = Trend->Base.Xend - Trend->Base.Xstart;
+    UWORD X = Trend->Head, Gap, i;
+    UBYTE Sample = Value < 0 ? 0 : Value > 0xff ? 0xff : Value;
+
+    if(Trend->Count == 0) {
+        Trend->Min[X] = Trend->Max[X] = Sample;
+
+        Gap = WIDGET_TREND_GAP < Columns ? WIDGET_TREND_GAP : Columns - 1;
+        for(i = 1; i <= Gap; i++) {
+            Trend->Min[(X + i) % Columns] = 0xff;
+            Trend->Max[(X + i) % Columns] = 0;
+        }
+        Widget_Damage(&Trend->Base, Trend->Base.Xstart + X, Trend->Base.Ystart,
+                      Trend->Base.Xstart + X + Gap + 1, Trend->Base.Yend);
+        if(X + Gap + 1 > Columns)
+            Widget_Damage(&Trend->Base, Trend->Base.Xstart, Trend->Base.Ystart,
+                          Trend->Base.Xstart + X + Gap + 1 - Columns, Trend->Base.Yend);
+    } else if(Sample < Trend->Min[X] || Sample > Trend->Max[X]) {
+        if(Sample < Trend->Min[X])
+            Trend->Min[X] = Sample;
+        if(Sample > Trend->Max[X])
+            Trend->Max[X] = Sample;
+        Widget_Damage(&Trend->Base, Trend->Base.Xstart + X, Trend->Base.Ystart,
+                      Trend->Base.Xstart + X + 1, Trend->Base.Yend);
+    }
+
+    if(++Trend->Count >= Trend->Period) {
+        Trend->Count = 0;
+        Trend->Head = (X + 1) % Columns;
+    }
+}
+
+/**
+ * Lit segments of the digits, bit 0 is segment a and bit 6 segment g:
+ *    a
+ *  f   b
+ *    g
+ *  e   c
+ *    d
+ */
+static const UBYTE Widget_Segments[10] = {
+    0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f
+};
+
+/******************************************************************************
+function: The left edge of a digit
+parameter:
+    Digits : The widget
+    Pos    : The digit, 0 is the leftmost
+******************************************************************************/
+static UWORD Widget_DigitX(const WIDGET_DIGITS *Digits, UBYTE Pos)
+{
+    return Digits->Base.Xstart + Pos * (Digits->Width + Digits->Gap);
+}
+
+/******************************************************************************
+function: Draw one big digit with its background
+parameter:
+    Digits : The widget
+    Pos    : The digit, 0 is the leftmost
+info:
+    A segment leaves a pixel free at each end, the corners stay open.
+******************************************************************************/
+static void Widget_DrawDigit(const WIDGET_DIGITS *Digits, UBYTE Pos)
+{
+    UWORD X = Widget_DigitX(Digits, Pos), Y = Digits->Base.Ystart;
+    UWORD W = Digits->Width, H = Digits->Height, T = Digits->Thick;
+    UWORD Mid = Y + (H - T) / 2;
+    char Ch = Digits->Text[Pos];
+    UBYTE Lit = 0;
+
+    if(Ch >= '0' && Ch <= '9')
+        Lit = Widget_Segments[Ch - '0'];
+    else if(Ch == '-')
+        Lit = 0x40;
+
+    Paint_ClearWindows(X, Y, X + W, Y + H, Digits->Base.Back);
+    if(Lit & 0x01)  // a
+        Paint_ClearWindows(X + T + 1, Y, X + W - T - 1, Y + T, Digits->Fore);
+    if(Lit & 0x02)  // b
+        Paint_ClearWindows(X + W - T, Y + T + 1, X + W, Mid - 1, Digits->Fore);
+    if(Lit & 0x04)  // c
+        Paint_ClearWindows(X + W - T, Mid + T + 1, X + W, Y + H - T - 1, Digits->Fore);
+    if(Lit & 0x08)  // d
+        Paint_ClearWindows(X + T + 1, Y + H - T, X + W - T - 1, Y + H, Digits->Fore);
+    if(Lit & 0x10)  // e
+        Paint_ClearWindows(X, Mid + T + 1, X + T, Y + H - T - 1, Digits->Fore);
+    if(Lit & 0x20)  // f
+        Paint_ClearWindows(X, Y + T + 1, X + T, Mid - 1, Digits->Fore);
+    if(Lit & 0x40)  // g
+        Paint_ClearWindows(X + T + 1, Mid, X + W - T - 1, Mid + T, Digits->Fore);
+}
+
+/******************************************************************************
+function: Draw the digits and the unit that reach into an area
+parameter:
+    Widget : A WIDGET_DIGITS
+    Area   : The part to draw, whole digits are drawn
+******************************************************************************/
+static void Widget_DrawDigits(const WIDGET *Widget, const PAINT_AREA *Area)
+{
+    const WIDGET_DIGITS *Digits = (const WIDGET_DIGITS *)Widget;
+    UWORD X, Unit = Widget_DigitX(Digits, Digits->Count);
+    UBYTE Pos;
+
+    for(Pos = 0; Pos < Digits->Count; Pos++) {
+        X = Widget_DigitX(Digits, Pos);
+        if(X < Area->Xend && X + Digits->Width + Digits->Gap > Area->Xstart) {
+            Widget_DrawDigit(Digits, Pos);
+            Paint_ClearWindows(X + Digits->Width, Widget->Ystart, X + Digits->Width + Digits->Gap,
+                               Widget->Yend, Widget->Back);
+        }
+    }
+
+    if(Unit < Area->Xend) {
+        Paint_ClearWindows(Unit, Widget->Ystart, Widget->Xend, Widget->Yend, Widget->Back);
+        Paint_DrawString_EN(Unit, Widget->Yend - Digits->Font->Height, Digits->Unit,
+                            Digits->Font, Widget->Back, Digits->Fore);
+    }
+}
+
+/******************************************************************************
+function: Segment thickness of a big digit, also the space after it
+parameter:
+    Width : Width of a digit
+******************************************************************************/
+static UBYTE Widget_DigitThick(UBYTE Width)
+{
+    return Width / 5 > 1 ? Width / 5 : 2;
+}
+
+/******************************************************************************
+function: Width of a big digit number, to place one before creating it
+parameter:
+    Count : Number of digits, at most WIDGET_DIGITS_MAX
+    Width : Width of a digit
+    Unit  : Text after the digits
+    Font  : Font of the unit
+******************************************************************************/
+UWORD Widget_DigitsWidth(UBYTE Count, UBYTE Width, const char *Unit, sFONT *Font)
+{
+    if(Count > WIDGET_DIGITS_MAX)
+        Count = WIDGET_DIGITS_MAX;
+
+    return Count * (Width + Widget_DigitThick(Width)) + strlen(Unit) * Font->Width;
+}
+
+/******************************************************************************
+function: Create a big digit number, hidden and showing dashes
+parameter:
+    Digits         : The widget
+    Xstart, Ystart : Top left
+    Count          : Number of digits, at most WIDGET_DIGITS_MAX
+    Width, Height  : Size of a digit
+    Unit           : Text after the digits, at their foot
+    Font           : Font of the unit
+    Fore, Back     : Digit and background colors
+******************************************************************************/
+void Widget_NewDigits(WIDGET_DIGITS *Digits, UWORD Xstart, UWORD Ystart, UBYTE Count,
+                      UBYTE Width, UBYTE Height, const char *Unit, sFONT *Font, UWORD Fore, UWORD Back)
+{
+    if(Count > WIDGET_DIGITS_MAX)
+        Count = WIDGET_DIGITS_MAX;
+
+    memset(Digits, 0, sizeof(*Digits));
+    Digits->Count = Count;
+    Digits->Width = Width;
+    Digits->Height = Height;
+    Digits->Thick = Widget_DigitThick(Width);
+    Digits->Gap = Digits->Thick;
+    Digits->Font = Font;
+    Digits->Unit = Unit;
+    Digits->Fore = Fore;
+    memset(Digits->Text, '-', Count);
+
+    Digits->Base.Xstart = Xstart;
+    Digits->Base.Ystart = Ystart;
+    Digits->Base.Xend = Xstart + Widget_DigitsWidth(Count, Width, Unit, Font);
+    Digits->Base.Yend = Ystart + Height;
+    Digits->Base.Back = Back;
+    Digits->Base.Draw = Widget_DrawDigits;
+}
+
+/******************************************************************************
+function: Set the number of a big digit widget
+parameter:
+    Digits : The widget
+    Value  : The number, right aligned. Dashes if it is negative or too
+             big for the digits.
+info:
+    Only the digits whose value changed are damaged and redrawn.
+******************************************************************************/
+void Widget_SetDigits(WIDGET_DIGITS *Digits, int Value)
+{
+    char New[WIDGET_DIGITS_MAX+1];
+    int Pos = Digits->Count;
+
+    memset(New, ' ', Digits->Count);
+    if(Value < 0) {
+        memset(New, '-', Digits->Count);
+    } else {
+        do {
+            New[--Pos] = '0' + Value % 10;
+            Value /= 10;
+        } while(Value > 0 && Pos > 0);
+        if(Value > 0)
+            memset(New, '-', Digits->Count);
+    }
+
+    for(Pos = 0; Pos < Digits->Count; Pos++) {
+        if(New[Pos] != Digits->Text[Pos]) {
+            UWORD X = Widget_DigitX(Digits, Pos);
+
+            Digits->Text[Pos] = New[Pos];
+            Widget_Damage(&Digits->Base, X, Digits->Base.Ystart, X + Digits->Width, Digits->Base.Yend);
+        }
+    }
+}
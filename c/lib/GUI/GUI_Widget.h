@@ -0,0 +1,161 @@
+/*****************************************************************************
+* | File        :   GUI_Widget.h
+* | Function    :   Retained widgets on top of GUI_Paint
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2021-10-12
+* | Info        :
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef __GUI_WIDGET_H
+#define __GUI_WIDGET_H
+
+#include "GUI_Paint.h"
+
+/**
+ * A widget keeps what it shows and can draw its box from that at any
+ * time, into a frame buffer or into a band of one. Setting a widget
+ * invalidates it only if what it shows changes, Widget_Commit() then
+ * hands the invalid boxes over to be brought out to the display. A
+ * widget that changes a little at a time damages only that part of its
+ * box, see Widget_Damage().
+**/
+typedef struct _WIDGET {
+    UWORD Xstart;           // Bounding box, the ends excluded
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+    UWORD Back;             // Background, also when hidden
+    UBYTE Shown;
+    UBYTE Invalid;
+    PAINT_AREA Damage;      // The part to redraw when not all of it is invalid
+    void (*Draw)(const struct _WIDGET *Widget, const PAINT_AREA *Area);    // Fills the box, at least Area of it
+    struct _WIDGET *Next;
+} WIDGET;
+
+/**
+ * Brings a box out to the display, see Widget_Commit()
+**/
+typedef void (*WIDGET_AREA)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+/**
+ * Text alignment in the box
+**/
+typedef enum {
+    WIDGET_LEFT = 0,
+    WIDGET_CENTER,
+    WIDGET_RIGHT,
+} WIDGET_ALIGN;
+
+#define WIDGET_TEXT_MAX     24
+
+/**
+ * A line of text
+**/
+typedef struct {
+    WIDGET Base;
+    sFONT *Font;
+    UWORD Fore;
+    UBYTE Align;
+    char Text[WIDGET_TEXT_MAX+1];
+} WIDGET_TEXT;
+
+/**
+ * A status icon, a character on a colored square when on
+**/
+typedef struct {
+    WIDGET Base;
+    sFONT *Font;
+    UWORD Fore;
+    UWORD On;               // Square color when on
+    char Ch;
+    UBYTE State;
+} WIDGET_ICON;
+
+#define WIDGET_TREND_MAX    240     // Columns
+#define WIDGET_TREND_GAP    3       // Empty columns ahead of the newest
+
+/**
+ * A trend graph, a column of pixels for every Period samples. It does
+ * not scroll, the newest column sweeps across the box and overwrites
+ * the oldest, with a gap ahead of it. So a sample only redraws a few
+ * columns, never the whole graph.
+**/
+typedef struct {
+    WIDGET Base;
+    UWORD Fore;
+    UWORD Mark;             // Lines at Low and High
+    UBYTE Low;              // The values at the bottom and at the top
+    UBYTE High;
+    UBYTE Period;           // Samples per column
+    UBYTE Count;            // Samples in the newest column so far
+    UWORD Head;             // The newest column
+    UBYTE Min[WIDGET_TREND_MAX];    // Sample range of each column, empty if Min > Max
+    UBYTE Max[WIDGET_TREND_MAX];
+} WIDGET_TREND;
+
+#define WIDGET_DIGITS_MAX   4
+
+/**
+ * A number in big seven segment digits, with a unit in a font after
+ * them. The segments are filled boxes, only the digits that change are
+ * redrawn.
+**/
+typedef struct {
+    WIDGET Base;
+    UWORD Fore;
+    UBYTE Count;            // Digits
+    UBYTE Width;            // Size of a digit
+    UBYTE Height;
+    UBYTE Thick;            // Segment thickness
+    UBYTE Gap;              // Space after each digit
+    sFONT *Font;            // Of the unit
+    const char *Unit;
+    char Text[WIDGET_DIGITS_MAX+1];     // Right aligned, '-' for none
+} WIDGET_DIGITS;
+
+//Widget list
+void Widget_Add(WIDGET *Widget);
+void Widget_Invalidate(WIDGET *Widget);
+void Widget_Damage(WIDGET *Widget, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Widget_Show(WIDGET *Widget, UBYTE Shown);
+void Widget_Reset(void);
+UWORD Widget_Commit(WIDGET_AREA Area);
+void Widget_DrawArea(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+//Widgets
+void Widget_NewText(WIDGET_TEXT *Text, UWORD Xstart, UWORD Ystart, UWORD Chars,
+                    sFONT *Font, UWORD Fore, UWORD Back, WIDGET_ALIGN Align);
+void Widget_SetText(WIDGET_TEXT *Text, const char *String);
+void Widget_NewIcon(WIDGET_ICON *Icon, UWORD Xstart, UWORD Ystart, char Ch,
+                    sFONT *Font, UWORD Fore, UWORD On, UWORD Back);
+void Widget_SetIcon(WIDGET_ICON *Icon, UBYTE State);
+void Widget_NewTrend(WIDGET_TREND *Trend, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height,
+                     UWORD Fore, UWORD Mark, UWORD Back, UBYTE Period);
+void Widget_SetTrend(WIDGET_TREND *Trend, UBYTE Low, UBYTE High);
+void Widget_AddTrend(WIDGET_TREND *Trend, int Value);
+void Widget_NewDigits(WIDGET_DIGITS *Digits, UWORD Xstart, UWORD Ystart, UBYTE Count,
+                      UBYTE Width, UBYTE Height, const char *Unit, sFONT *Font, UWORD Fore, UWORD Back);
+void Widget_SetDigits(WIDGET_DIGITS *Digits, int Value);
+UWORD Widget_DigitsWidth(UBYTE Count, UBYTE Width, const char *Unit, sFONT *Font);
+
+#endif
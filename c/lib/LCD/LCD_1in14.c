@@ -31,9 +31,22 @@
 
 #include <stdlib.h>		//itoa()
 #include <stdio.h>
+#include <string.h>
 
 LCD_1IN14_ATTRIBUTES LCD_1IN14;
 
+static void (*LCD_1IN14_Done)(void);
+static UWORD ScrollTop = LCD_1IN14_GATE_OFFSET;
+static UWORD ScrollHeight;
+static UWORD LineBuf[2][LCD_1IN14_HEIGHT];          // Rows streamed by LCD_1IN14_DisplayRows()
+static UBYTE LineNext;
+static UWORD Palette[LCD_1IN14_PALETTE_MAX];        // Panel byte order
+static LCD_1IN14_STATS Stats;
+static uint64_t FlushStart;
+
+static void LCD_1IN14_StatStart(UDOUBLE Bytes);
+static void LCD_1IN14_StatDone(void);
+
 
 /******************************************************************************
 function :	Hardware reset
@@ -56,6 +69,7 @@ parameter:
 ******************************************************************************/
 static void LCD_1IN14_SendCommand(UBYTE Reg)
 {
+    DEV_SPI_DMA_Wait();    // CS and DC belong to a DMA transfer until it is done
     DEV_Digital_Write(EPD_DC_PIN, 0);
     DEV_Digital_Write(EPD_CS_PIN, 0);
     DEV_SPI_WriteByte(Reg);
@@ -69,6 +83,7 @@ parameter:
 ******************************************************************************/
 static void LCD_1IN14_SendData_8Bit(UBYTE Data)
 {
+    DEV_SPI_DMA_Wait();
     DEV_Digital_Write(EPD_DC_PIN, 1);
     DEV_Digital_Write(EPD_CS_PIN, 0);
     DEV_SPI_WriteByte(Data);
@@ -82,6 +97,7 @@ parameter:
 ******************************************************************************/
 static void LCD_1IN14_SendData_16Bit(UWORD Data)
 {
+    DEV_SPI_DMA_Wait();
     DEV_Digital_Write(EPD_DC_PIN, 1);
     DEV_Digital_Write(EPD_CS_PIN, 0);
     DEV_SPI_WriteByte((Data >> 8) & 0xFF);
@@ -239,29 +255,51 @@ void LCD_1IN14_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
     // printf("%d %d\r\n",x,y);
 }
 
+/********************************************************************************
+function:	Define the hardware scroll area (VSCRDEF)
+parameter:
+		Start   :   First line of the scroll area
+		End     :   End of the scroll area (exclusive)
+info:
+    The ST7789 scrolls along its gate lines only. With the VERTICAL scan
+    direction that is the Y axis of the picture, with HORIZONTAL the rows
+    and columns are exchanged and the area is a range of X coordinates.
+    Lines outside the area stay fixed.
+********************************************************************************/
+void LCD_1IN14_SetScrollArea(UWORD Start, UWORD End)
+{
+    ScrollTop = LCD_1IN14_GATE_OFFSET + Start;
+    ScrollHeight = End - Start;
+
+    LCD_1IN14_SendCommand(0x33);
+    LCD_1IN14_SendData_16Bit(ScrollTop);
+    LCD_1IN14_SendData_16Bit(ScrollHeight);
+    LCD_1IN14_SendData_16Bit(LCD_1IN14_GATE_LINES - ScrollTop - ScrollHeight);
+}
+
+/********************************************************************************
+function:	Set the scroll start address (VSCSAD)
+parameter:
+		Line    :   Line of the scroll area shown first, counted from the
+                    Start given to LCD_1IN14_SetScrollArea(). 0 is unscrolled.
+********************************************************************************/
+void LCD_1IN14_SetScrollStart(UWORD Line)
+{
+    if (ScrollHeight > 0) {
+        Line %= ScrollHeight;
+    }
+
+    LCD_1IN14_SendCommand(0x37);
+    LCD_1IN14_SendData_16Bit(ScrollTop + Line);
+}
+
 /******************************************************************************
 function :	Clear screen
 parameter:
 ******************************************************************************/
 void LCD_1IN14_Clear(UWORD Color)
 {
-    UWORD j,i;
-    UWORD Image[LCD_1IN14.WIDTH*LCD_1IN14.HEIGHT];
-    
-    Color = ((Color<<8)&0xff00)|(Color>>8);
-   
-    for (j = 0; j < LCD_1IN14.HEIGHT*LCD_1IN14.WIDTH; j++) {
-        Image[j] = Color;
-    }
-    
-    LCD_1IN14_SetWindows(0, 0, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT);
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    // printf("HEIGHT %d, WIDTH %d\r\n",LCD_1IN14.HEIGHT,LCD_1IN14.WIDTH);
-    for(j = 0; j < LCD_1IN14.HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN14.WIDTH], LCD_1IN14.WIDTH*2);
-    }
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    LCD_1IN14_ClearWindowsAsync(0, 0, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, Color);
 }
 
 /******************************************************************************
@@ -272,12 +310,14 @@ void LCD_1IN14_Display(UWORD *Image)
 {
     UWORD j;
     LCD_1IN14_SetWindows(0, 0, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT);
+    LCD_1IN14_StatStart((UDOUBLE)LCD_1IN14.WIDTH * LCD_1IN14.HEIGHT * 2);
     DEV_Digital_Write(EPD_DC_PIN, 1);
     DEV_Digital_Write(EPD_CS_PIN, 0);
     for (j = 0; j < LCD_1IN14.HEIGHT; j++) {
         DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN14.WIDTH], LCD_1IN14.WIDTH*2);
     }
     DEV_Digital_Write(EPD_CS_PIN, 1);
+    LCD_1IN14_StatDone();
     LCD_1IN14_SendCommand(0x29);
 }
 
@@ -297,13 +337,15 @@ void LCD_1IN14_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend
 
     UWORD j;
     LCD_1IN14_SetWindows(Xstart, Ystart, Xend , Yend);
+    LCD_1IN14_StatStart((UDOUBLE)(Xend-Xstart) * (Yend-Ystart) * 2);
     DEV_Digital_Write(EPD_DC_PIN, 1);
     DEV_Digital_Write(EPD_CS_PIN, 0);
-    for (j = Ystart; j < Yend - 1; j++) {
+    for (j = Ystart; j < Yend; j++) {
         Addr = Xstart + j * LCD_1IN14.WIDTH ;
         DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
     }
     DEV_Digital_Write(EPD_CS_PIN, 1);
+    LCD_1IN14_StatDone();
 }
 
 /******************************************************************************
@@ -319,6 +361,376 @@ void LCD_1IN14_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
     LCD_1IN14_SendData_16Bit(Color);
 }
 
+/******************************************************************************
+function :	Set the function called when an asynchronous transfer is done
+parameter:
+		Done	:	Callback, runs in interrupt context, or NULL
+******************************************************************************/
+void LCD_1IN14_SetCallback(void (*Done)(void))
+{
+    LCD_1IN14_Done = Done;
+}
+
+/******************************************************************************
+function :	Count a transfer, from its start to its last byte
+parameter:
+		Bytes	:	Pixel bytes of the transfer
+******************************************************************************/
+static void LCD_1IN14_StatStart(UDOUBLE Bytes)
+{
+    Stats.Frames++;
+    Stats.Bytes += Bytes;
+    FlushStart = DEV_Time_us();
+}
+
+static void LCD_1IN14_StatDone(void)
+{
+    UDOUBLE Us = DEV_Time_us() - FlushStart;
+
+    Stats.FlushUs += Us;
+    if (Us > Stats.FlushMaxUs) {
+        Stats.FlushMaxUs = Us;
+    }
+}
+
+/******************************************************************************
+function :	Get the transfer counters
+parameter:
+******************************************************************************/
+const LCD_1IN14_STATS *LCD_1IN14_GetStats(void)
+{
+    return &Stats;
+}
+
+void LCD_1IN14_ClearStats(void)
+{
+    memset(&Stats, 0, sizeof(Stats));
+}
+
+/******************************************************************************
+function :	End of an asynchronous transfer, release CS and DC
+parameter:
+******************************************************************************/
+static void LCD_1IN14_Release(void)
+{
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+    DEV_Digital_Write(EPD_DC_PIN, 0);
+    LCD_1IN14_StatDone();
+
+    if (LCD_1IN14_Done != NULL) {
+        LCD_1IN14_Done();
+    }
+}
+
+/******************************************************************************
+function :	Sends the image buffer in RAM to displays by DMA
+parameter:
+		Image	:	Written content, must not be freed until the transfer is done
+info:
+    Returns as soon as the transfer is started. Any following LCD access
+    waits for it, LCD_1IN14_Busy() can be polled meanwhile.
+******************************************************************************/
+void LCD_1IN14_DisplayAsync(UWORD *Image)
+{
+    LCD_1IN14_DisplayWindowsAsync(0, 0, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, Image);
+}
+
+/******************************************************************************
+function :	Sends a window of the image buffer in RAM to displays by DMA
+parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates
+		Yend    :   Y direction end coordinates
+		Image	:	Written content, must not be freed until the transfer is done
+******************************************************************************/
+void LCD_1IN14_DisplayWindowsAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
+{
+    LCD_1IN14_SetWindows(Xstart, Ystart, Xend , Yend);
+    LCD_1IN14_StatStart((UDOUBLE)(Xend-Xstart) * (Yend-Ystart) * 2);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_Write_nByte_DMA((uint8_t *)&Image[Xstart + Ystart * LCD_1IN14.WIDTH], (Xend-Xstart)*2,
+                            LCD_1IN14.WIDTH*2, Yend-Ystart, LCD_1IN14_Release);
+}
+
+/******************************************************************************
+function :	Sends a window of a band held in its own buffer to displays by DMA
+parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates, the first row of the band
+		Xend    :   X direction end coordinates
+		Yend    :   Y direction end coordinates
+		Band	:	Yend-Ystart rows of LCD_1IN14.WIDTH pixels, must not be
+		            reused until the transfer is done
+info:
+    For screens rebuilt strip by strip, see Paint_SelectBand().
+******************************************************************************/
+void LCD_1IN14_DisplayBandAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Band)
+{
+    LCD_1IN14_SetWindows(Xstart, Ystart, Xend, Yend);
+    LCD_1IN14_StatStart((UDOUBLE)(Xend-Xstart) * (Yend-Ystart) * 2);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_Write_nByte_DMA((uint8_t *)&Band[Xstart], (Xend-Xstart)*2,
+                            LCD_1IN14.WIDTH*2, Yend-Ystart, LCD_1IN14_Release);
+}
+
+/******************************************************************************
+function :	Fill a window with one color by DMA
+parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates
+		Yend    :   Y direction end coordinates
+		Color	:	Color
+info:
+    No buffer, the DMA repeats one word. Returns as soon as the transfer
+    is started, like LCD_1IN14_DisplayWindowsAsync().
+******************************************************************************/
+void LCD_1IN14_ClearWindowsAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    if (Xstart >= Xend || Ystart >= Yend) {
+        return;
+    }
+
+    LCD_1IN14_SetWindows(Xstart, Ystart, Xend , Yend);
+    LCD_1IN14_StatStart((UDOUBLE)(Xend-Xstart) * (Yend-Ystart) * 2);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_Fill_DMA(Color, (UDOUBLE)(Xend-Xstart) * (Yend-Ystart), LCD_1IN14_Release);
+}
+
+/******************************************************************************
+function :	Streams a window to displays, row by row through two line buffers
+parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates
+		Yend    :   Y direction end coordinates
+		Fill	:	Produces each row, see LCD_1IN14_FILL
+		Arg		:	Passed on to Fill
+info:
+    A row is filled while the previous one goes out by DMA, no picture
+    of the window is needed in RAM. Returns when the last row is started.
+******************************************************************************/
+void LCD_1IN14_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, LCD_1IN14_FILL Fill, void *Arg)
+{
+    UWORD j;
+
+    if (Xstart >= Xend || Ystart >= Yend) {
+        return;
+    }
+
+    LCD_1IN14_SetWindows(Xstart, Ystart, Xend , Yend);
+    LCD_1IN14_StatStart((UDOUBLE)(Xend-Xstart) * (Yend-Ystart) * 2);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    for (j = Ystart; j < Yend; j++) {
+        // The other line may still be on its way out, this one is done
+        UWORD *Line = LineBuf[LineNext];
+        LineNext ^= 1;
+
+        Fill(Line, Xstart, Xend, j, Arg);
+        DEV_SPI_Write_nByte_DMA((uint8_t *)Line, (Xend-Xstart)*2, (Xend-Xstart)*2, 1,
+                                j == Yend-1? LCD_1IN14_Release : NULL);
+    }
+}
+
+/******************************************************************************
+function :	Set the colors of 4 bit indexed images
+parameter:
+		Colors	:	RGB565 color of each index
+		Count	:	Number of colors, LCD_1IN14_PALETTE_MAX at most
+******************************************************************************/
+void LCD_1IN14_SetPalette(const UWORD *Colors, UBYTE Count)
+{
+    UBYTE i;
+
+    for (i = 0; i < Count && i < LCD_1IN14_PALETTE_MAX; i++) {
+        Palette[i] = ((Colors[i]<<8)&0xff00)|(Colors[i]>>8);
+    }
+}
+
+/******************************************************************************
+function :	Expand a row of a 4 bit indexed image through the palette
+parameter:
+		Arg		:	The image, two pixels a byte, the left one in the high nibble
+******************************************************************************/
+static void LCD_1IN14_ExpandIndexed(UWORD *Line, UWORD Xstart, UWORD Xend, UWORD Y, void *Arg)
+{
+    const UBYTE *Byte = (const UBYTE *)Arg + (UDOUBLE)Y * ((LCD_1IN14.WIDTH + 1) / 2) + Xstart / 2;
+    UWORD X = Xstart;
+
+    if (X % 2) {
+        *Line++ = Palette[*Byte++ & 0x0f];
+        X++;
+    }
+    for (; X + 1 < Xend; X += 2, Byte++) {
+        *Line++ = Palette[*Byte >> 4];
+        *Line++ = Palette[*Byte & 0x0f];
+    }
+    if (X < Xend) {
+        *Line = Palette[*Byte >> 4];
+    }
+}
+
+/******************************************************************************
+function :	Sends a 4 bit indexed image in RAM to displays
+parameter:
+		Image	:	Written content, see LCD_1IN14_ExpandIndexed()
+info:
+    The rows are expanded to RGB565 as they go out, see LCD_1IN14_DisplayRows().
+******************************************************************************/
+void LCD_1IN14_DisplayIndexed(UWORD *Image)
+{
+    LCD_1IN14_DisplayRows(0, 0, LCD_1IN14.WIDTH, LCD_1IN14.HEIGHT, LCD_1IN14_ExpandIndexed, Image);
+}
+
+/******************************************************************************
+function :	Sends a window of a 4 bit indexed image in RAM to displays
+parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates
+		Yend    :   Y direction end coordinates
+		Image	:	Written content, see LCD_1IN14_ExpandIndexed()
+******************************************************************************/
+void LCD_1IN14_DisplayWindowsIndexed(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
+{
+    LCD_1IN14_DisplayRows(Xstart, Ystart, Xend, Yend, LCD_1IN14_ExpandIndexed, Image);
+}
+
+/**
+ * Windows of 4 bit indexed images waiting to be streamed from the DMA
+ * interrupt, see LCD_1IN14_DisplayWindowsIndexedAsync()
+**/
+typedef struct {
+    UWORD Xstart, Ystart, Xend, Yend;
+    const UWORD *Image;
+} LCD_1IN14_WINDOW;
+
+static LCD_1IN14_WINDOW Queue[LCD_1IN14_QUEUE];
+static volatile UBYTE QueueHead;    // Window going out, only the interrupt moves it
+static volatile UBYTE QueueTail;    // Next free entry
+static UWORD StreamRow;             // Row of the head window going out
+
+static void LCD_1IN14_StreamNext(void);
+
+/******************************************************************************
+function :	Start the head window of the queue
+parameter:
+info:
+    Runs with the SPI idle, either from the caller or from the DMA
+    interrupt of the previous window.
+******************************************************************************/
+static void LCD_1IN14_StreamStart(void)
+{
+    const LCD_1IN14_WINDOW *Win = &Queue[QueueHead % LCD_1IN14_QUEUE];
+    UWORD Len = (Win->Xend - Win->Xstart) * 2;
+
+    LCD_1IN14_SetWindows(Win->Xstart, Win->Ystart, Win->Xend, Win->Yend);
+    LCD_1IN14_StatStart((UDOUBLE)Len * (Win->Yend - Win->Ystart));
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+
+    StreamRow = Win->Ystart;
+    LCD_1IN14_ExpandIndexed(LineBuf[0], Win->Xstart, Win->Xend, StreamRow, (void *)Win->Image);
+    DEV_SPI_Write_nByte_DMA((uint8_t *)LineBuf[0], Len, Len, 1, LCD_1IN14_StreamNext);
+    if (StreamRow + 1 < Win->Yend) {
+        LCD_1IN14_ExpandIndexed(LineBuf[1], Win->Xstart, Win->Xend, StreamRow + 1, (void *)Win->Image);
+    }
+}
+
+/******************************************************************************
+function :	DMA done with a row, send the next one or the next window
+parameter:
+info:
+    The row after next is expanded while the next one goes out.
+******************************************************************************/
+static void LCD_1IN14_StreamNext(void)
+{
+    const LCD_1IN14_WINDOW *Win = &Queue[QueueHead % LCD_1IN14_QUEUE];
+    UWORD Len = (Win->Xend - Win->Xstart) * 2;
+    UWORD *Line;
+
+    if (++StreamRow < Win->Yend) {
+        Line = LineBuf[(StreamRow - Win->Ystart) & 1];
+        DEV_SPI_Write_nByte_DMA((uint8_t *)Line, Len, Len, 1, LCD_1IN14_StreamNext);
+        if (StreamRow + 1 < Win->Yend) {
+            Line = LineBuf[(StreamRow + 1 - Win->Ystart) & 1];
+            LCD_1IN14_ExpandIndexed(Line, Win->Xstart, Win->Xend, StreamRow + 1, (void *)Win->Image);
+        }
+        return;
+    }
+
+    LCD_1IN14_Release();
+    QueueHead++;
+    if (QueueHead != QueueTail) {
+        LCD_1IN14_StreamStart();
+    }
+}
+
+/******************************************************************************
+function :	Sends a window of a 4 bit indexed image in RAM to displays,
+            returns at once
+parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates
+		Yend    :   Y direction end coordinates
+		Image	:	Written content, see LCD_1IN14_ExpandIndexed(), must
+		            stay untouched until LCD_1IN14_Busy() is false
+info:
+    Up to LCD_1IN14_QUEUE windows are queued and streamed one after the
+    other from the DMA interrupt, each row is expanded while the previous
+    one goes out. Only a full queue waits. Call it from the core that
+    runs the DMA interrupt.
+******************************************************************************/
+void LCD_1IN14_DisplayWindowsIndexedAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
+{
+    LCD_1IN14_WINDOW *Win;
+
+    if (Xstart >= Xend || Ystart >= Yend) {
+        return;
+    }
+
+    while ((UBYTE)(QueueTail - QueueHead) == LCD_1IN14_QUEUE) {
+        tight_loop_contents();
+    }
+
+    Win = &Queue[QueueTail % LCD_1IN14_QUEUE];
+    Win->Xstart = Xstart;
+    Win->Ystart = Ystart;
+    Win->Xend = Xend;
+    Win->Yend = Yend;
+    Win->Image = Image;
+    QueueTail++;
+
+    // Once the SPI is idle the interrupt has seen the queue run empty
+    if (!DEV_SPI_DMA_Busy() && QueueHead != QueueTail) {
+        LCD_1IN14_StreamStart();
+    }
+}
+
+/******************************************************************************
+function :	Check for an asynchronous transfer in flight
+parameter:
+******************************************************************************/
+bool LCD_1IN14_Busy(void)
+{
+    return DEV_SPI_DMA_Busy();
+}
+
+/******************************************************************************
+function :	Wait until an asynchronous transfer is done
+parameter:
+******************************************************************************/
+void LCD_1IN14_Wait(void)
+{
+    DEV_SPI_DMA_Wait();
+}
+
 void  Handler_1IN14_LCD(int signo)
 {
     //System Exit
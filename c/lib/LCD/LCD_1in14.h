@@ -43,6 +43,9 @@
 #define HORIZONTAL 0
 #define VERTICAL   1
 
+#define LCD_1IN14_GATE_LINES    320 // Frame memory lines of the ST7789
+#define LCD_1IN14_GATE_OFFSET   40  // First frame memory line used by the panel
+
 #define LCD_1IN14_SetBacklight(Value) ; 
 
 
@@ -53,6 +56,24 @@ typedef struct{
 }LCD_1IN14_ATTRIBUTES;
 extern LCD_1IN14_ATTRIBUTES LCD_1IN14;
 
+/**
+ * Fills Line[0..Xend-Xstart-1] with row Y of a streamed window,
+ * in panel byte order (high byte first)
+**/
+typedef void (*LCD_1IN14_FILL)(UWORD *Line, UWORD Xstart, UWORD Xend, UWORD Y, void *Arg);
+#define LCD_1IN14_PALETTE_MAX   16  // Colors of a 4 bit indexed image
+#define LCD_1IN14_QUEUE         8   // Windows waiting to be streamed, a power of 2
+
+/**
+ * Transfer counters, see LCD_1IN14_GetStats()
+**/
+typedef struct {
+    UDOUBLE Frames;         // Pictures, windows and fills sent
+    uint64_t Bytes;         // Pixel bytes sent
+    uint64_t FlushUs;       // Time from the start of each to its last byte
+    UDOUBLE FlushMaxUs;
+} LCD_1IN14_STATS;
+
 /********************************************************************************
 function:	
 			Macro definition variable name
@@ -63,5 +84,23 @@ void LCD_1IN14_Display(UWORD *Image);
 void LCD_1IN14_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_1IN14_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
+void LCD_1IN14_SetScrollArea(UWORD Start, UWORD End);
+void LCD_1IN14_SetScrollStart(UWORD Line);
+
+void LCD_1IN14_SetCallback(void (*Done)(void));
+void LCD_1IN14_DisplayAsync(UWORD *Image);
+void LCD_1IN14_DisplayWindowsAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+void LCD_1IN14_DisplayBandAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Band);
+void LCD_1IN14_ClearWindowsAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void LCD_1IN14_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, LCD_1IN14_FILL Fill, void *Arg);
+void LCD_1IN14_SetPalette(const UWORD *Colors, UBYTE Count);
+void LCD_1IN14_DisplayIndexed(UWORD *Image);
+void LCD_1IN14_DisplayWindowsIndexed(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+void LCD_1IN14_DisplayWindowsIndexedAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+const LCD_1IN14_STATS *LCD_1IN14_GetStats(void);
+void LCD_1IN14_ClearStats(void);
+bool LCD_1IN14_Busy(void);
+void LCD_1IN14_Wait(void);
+
 void Handler_1IN14_LCD(int signo);
 #endif
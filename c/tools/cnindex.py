@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# cnindex.py - Westerbeke Marine Generator Starter and Monitor
+#
+# Writes the sorted index of the characters of a GB2312 font table
+# (cINDEX, see lib/Fonts/fonts.h) so that Paint_DrawString_CN() finds a
+# character with a binary search instead of a scan of the table. Run
+# from the build, e.g.
+#
+#   cnindex.py font12CN.c font12CNindex.c
+#
+# A key is the first index byte of an entry shifted up by 8 with the
+# second one below, an ASCII entry has 0 as its second byte. Keys are
+# ascending and equal keys keep their table order, so the search finds
+# the same entry as the scan when a character is in the table twice.
+#
+# Only the Python standard library is used.
+#
+import os
+import re
+import sys
+
+
+def read_table(path):
+    """Return the table name and the index bytes of every entry."""
+    with open(path, encoding='latin-1') as f:
+        text = f.read()
+    # The comments repeat the characters
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+
+    table = re.search(r'CH_CN\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*)\}\s*;', text, re.S)
+    if table is None:
+        sys.exit('%s: no CH_CN table found' % path)
+
+    entries = []
+    for literal in re.findall(r'\{\s*\{\s*"((?:[^"\\]|\\.)*)"\s*\}', table.group(2)):
+        chars = re.sub(r'\\(.)', r'\1', literal).encode('latin-1')
+        if not 1 <= len(chars) <= 2:
+            sys.exit('%s: bad index "%s"' % (path, literal))
+        entries.append((chars + b'\0')[:2])
+    if not entries:
+        sys.exit('%s: the table is empty' % path)
+    return table.group(1), entries
+
+
+def c_array(data, per_line, fmt):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append('    ' + ', '.join(fmt % v for v in data[i:i+per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: cnindex.py font.c index.c')
+    src, dst = sys.argv[1:]
+
+    table, entries = read_table(src)
+    name = re.sub(r'_Table$', '', table)
+    keys = sorted(((e[0] << 8) | e[1], n) for n, e in enumerate(entries))
+
+    with open(dst, 'w') as f:
+        f.write('/* Generated by cnindex.py from %s, do not edit */\n' % os.path.basename(src))
+        f.write('/* %d entries of %s sorted by character */\n' % (len(entries), table))
+        f.write('#include "fonts.h"\n\n')
+        f.write('static const uint16_t %s_Keys[] = {\n%s\n};\n\n'
+                % (name, c_array([k for k, _ in keys], 8, '0x%04x')))
+        f.write('static const uint16_t %s_Entries[] = {\n%s\n};\n\n'
+                % (name, c_array([n for _, n in keys], 8, '%d')))
+        f.write('const cINDEX %s_Index = { %s_Keys, %s_Entries, %d };\n' % (name, name, name, len(keys)))
+
+
+if __name__ == '__main__':
+    main()
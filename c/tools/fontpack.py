@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+#
+# fontpack.py - Westerbeke Marine Generator Starter and Monitor
+#
+# Compiles one of the bitmap fonts in lib/Fonts into a packed font
+# (pFONT, see lib/Fonts/fonts.h) with just the glyphs a target uses.
+# Run from the build, e.g.
+#
+#   fontpack.py font16.c font16pack.c
+#   fontpack.py --chars "0123456789Hz:" --name Font16Digits font16.c digits.c
+#
+# The output defines an sFONT of the same size whose Packed member
+# points at the packed glyphs, it replaces the bitmap font at link time.
+# Without --chars every glyph of the source is kept.
+#
+# Every glyph keeps the rows from its first to its last one with ink,
+# the blank rows above and below are left out. A kept row is a count
+# byte followed by that many runs of foreground pixels, one byte each:
+#   (first column << 4) | (pixels - 1)
+# so glyphs can be at most 16 pixels wide. Each glyph also has its own
+# advance, the cell width as the fonts in lib/Fonts are monospaced.
+#
+# Only the Python standard library is used.
+#
+import os
+import re
+import sys
+
+FIRST_CHAR = 0x20   # The bitmap fonts start at ' '
+
+
+def read_font(path):
+    """Return name, width, height and the table bytes of a font source."""
+    with open(path, encoding='latin-1') as f:
+        text = f.read()
+    # The pixel art in the comments holds '#' and hex looking words
+    text = re.sub(r'//[^\n]*', '', text)
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+
+    table = re.search(r'uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;', text, re.S)
+    font = re.search(r'sFONT\s+(\w+)\s*=\s*\{\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*(?:,\s*NULL\s*)?,?\s*\}', text)
+    if table is None or font is None or font.group(2) != table.group(1):
+        sys.exit('%s: no sFONT with its table found' % path)
+
+    data = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]{2})', table.group(2))]
+    return font.group(1), int(font.group(3)), int(font.group(4)), data
+
+
+def glyph_rows(data, index, width, height):
+    """The rows of a glyph as lists of booleans."""
+    row_bytes = (width + 7) // 8
+    start = index * height * row_bytes
+    rows = []
+    for y in range(height):
+        bits = 0
+        for b in data[start + y * row_bytes:start + (y + 1) * row_bytes]:
+            bits = (bits << 8) | b
+        rows.append([bool(bits & (1 << (row_bytes * 8 - 1 - x))) for x in range(width)])
+    return rows
+
+
+def encode_row(row):
+    """The runs of foreground pixels of one row."""
+    runs = []
+    x = 0
+    while x < len(row):
+        if not row[x]:
+            x += 1
+            continue
+        start = x
+        while x < len(row) and row[x]:
+            x += 1
+        runs.append((start << 4) | (x - start - 1))
+    return bytes([len(runs)] + runs)
+
+
+def c_array(data, per_line, fmt):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append('    ' + ', '.join(fmt % v for v in data[i:i+per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    args = sys.argv[1:]
+    chars = None
+    name = None
+    while args and args[0].startswith('--'):
+        opt = args.pop(0)
+        if opt == '--chars' and args:
+            chars = args.pop(0)
+        elif opt == '--name' and args:
+            name = args.pop(0)
+        else:
+            args = []
+    if len(args) != 2:
+        sys.exit('usage: fontpack.py [--chars TEXT] [--name NAME] font.c packed.c')
+    src, dst = args
+
+    font, width, height, data = read_font(src)
+    name = name or font
+    if width > 16:
+        sys.exit('%s: %d pixels wide, runs hold at most 16' % (src, width))
+
+    count = len(data) // (height * ((width + 7) // 8))
+    available = [chr(FIRST_CHAR + i) for i in range(count)]
+    if chars is None:
+        keep = set(available)
+    else:
+        keep = set(chars) & set(available)
+        if not keep:
+            sys.exit('%s: none of the characters are in the font' % src)
+    first = ord(min(keep))
+    last = ord(max(keep))
+
+    runs = bytearray()
+    glyphs = []
+    for code in range(first, last + 1):
+        rows = glyph_rows(data, code - FIRST_CHAR, width, height) if chr(code) in keep else []
+        inked = [y for y, row in enumerate(rows) if any(row)]
+        if not inked:
+            glyphs.append((0, 0, 0, width))
+            continue
+        top, bottom = inked[0], inked[-1] + 1
+        glyphs.append((len(runs), top, bottom - top, width))
+        for row in rows[top:bottom]:
+            runs += encode_row(row)
+
+    if len(runs) > 0xffff:
+        sys.exit('%s: %d bytes of runs do not fit 16 bit offsets' % (src, len(runs)))
+
+    bitmap = (last - first + 1) * height * ((width + 7) // 8)
+    with open(dst, 'w') as f:
+        f.write('/* Generated by fontpack.py from %s, do not edit */\n' % os.path.basename(src))
+        f.write('/* %d glyphs \'%c\'..\'%c\', %d bytes of runs and %d of glyphs, %d as a bitmap */\n'
+                % (len(keep), first, last, len(runs), len(glyphs) * 6, bitmap))
+        f.write('#include <stddef.h>\n#include "fonts.h"\n\n')
+        f.write('static const uint8_t %s_Runs[] = {\n%s\n};\n\n' % (name, c_array(runs, 16, '0x%02x')))
+        f.write('static const pGLYPH %s_Glyphs[] = {\n' % name)
+        for code, (offset, top, rows, advance) in zip(range(first, last + 1), glyphs):
+            f.write('    { %5d, %2d, %2d, %2d },   // %s\n'
+                    % (offset, top, rows, advance, repr(chr(code)) if chr(code) in keep else 'not kept'))
+        f.write('};\n\n')
+        f.write('static const pFONT %s_Packed = { %s_Glyphs, %s_Runs, %d, %d };\n\n'
+                % (name, name, name, first, last))
+        f.write('sFONT %s = {\n  NULL,\n  %d, /* Width */\n  %d, /* Height */\n  &%s_Packed,\n};\n'
+                % (name, width, height, name))
+
+
+if __name__ == '__main__':
+    main()
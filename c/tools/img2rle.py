@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+#
+# img2rle.py - Westerbeke Marine Generator Starter and Monitor
+#
+# Converts a PNG image into a C header holding a run length coded RGB565
+# image (PAINT_RLE, see lib/GUI/GUI_Paint.h). Run from the build, e.g.
+#
+#   img2rle.py wb50bcd.png wb50bcd.h
+#
+# With --raw the pixels are written as they are, for Paint_BlitRGB565(),
+# which suits small icons that are drawn often.
+#
+# Every row is coded on its own so a row can be decoded straight into a
+# line buffer or a strip. A row is a sequence of packets:
+#   n < 0x80    n+1 literal pixels follow
+#   n >= 0x80   the one pixel that follows repeats n-0x80+2 times
+# Pixels are two bytes, high byte first, as the panel takes them.
+#
+# Only the Python standard library is used.
+#
+import os
+import struct
+import sys
+import zlib
+
+
+def read_png(path):
+    """Return width, height and rows of (r, g, b) tuples of an 8 bit PNG."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    palette = []
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos+8])
+        body = data[pos+8:pos+8+length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = [tuple(body[i:i+3]) for i in range(0, len(body), 3)]
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if depth != 8 or channels is None or interlace != 0:
+        sys.exit('%s: only 8 bit, non interlaced PNG images are supported' % path)
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        prev = line
+
+        pixels = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if ctype == 3:
+                pixels.append(palette[px[0]])
+            elif ctype in (0, 4):
+                pixels.append((px[0], px[0], px[0]))
+            else:
+                pixels.append(tuple(px[:3]))
+        rows.append(pixels)
+    return width, height, rows
+
+
+def rgb565(rgb):
+    r, g, b = rgb
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode_row(row):
+    """Run length code one row of RGB565 pixels."""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(struct.pack('>H', p))
+
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and row[i + run] == row[i] and run < 129:
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(0x80 + run - 2)
+            out += struct.pack('>H', row[i])
+            i += run
+        else:
+            literal.append(row[i])
+            i += 1
+    flush()
+    return out
+
+
+def c_array(data, per_line, fmt):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append('    ' + ', '.join(fmt % v for v in data[i:i+per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def write_raw(dst, src, name, width, height, rows):
+    data = bytearray()
+    for row in rows:
+        for p in row:
+            data += struct.pack('>H', rgb565(p))
+
+    guard = '_%s_H_' % name.upper()
+    with open(dst, 'w') as f:
+        f.write('/* Generated by img2rle.py from %s, do not edit */\n' % os.path.basename(src))
+        f.write('/* %dx%d RGB565, high byte first, see Paint_BlitRGB565() */\n' % (width, height))
+        f.write('#ifndef %s\n#define %s\n\n#include "GUI_Paint.h"\n\n' % (guard, guard))
+        f.write('#define %s_WIDTH %d\n#define %s_HEIGHT %d\n\n' % (name.upper(), width, name.upper(), height))
+        f.write('static const UBYTE %s[] = {\n%s\n};\n\n' % (name, c_array(data, 16, '0x%02x')))
+        f.write('#endif\n')
+
+
+def main():
+    args = sys.argv[1:]
+    raw = '--raw' in args
+    if raw:
+        args.remove('--raw')
+    if len(args) != 2:
+        sys.exit('usage: img2rle.py [--raw] image.png header.h')
+    src, dst = args
+    name = os.path.splitext(os.path.basename(dst))[0]
+    width, height, rows = read_png(src)
+
+    if raw:
+        write_raw(dst, src, name, width, height, rows)
+        return
+
+    data = bytearray()
+    offsets = []
+    for row in rows:
+        offsets.append(len(data))
+        data += encode_row([rgb565(p) for p in row])
+
+    guard = '_%s_H_' % name.upper()
+    with open(dst, 'w') as f:
+        f.write('/* Generated by img2rle.py from %s, do not edit */\n' % os.path.basename(src))
+        f.write('/* %dx%d, %d bytes run length coded, %d raw */\n' % (width, height, len(data), width * height * 2))
+        f.write('#ifndef %s\n#define %s\n\n#include "GUI_Paint.h"\n\n' % (guard, guard))
+        f.write('static const UBYTE %s_data[] = {\n%s\n};\n\n' % (name, c_array(data, 16, '0x%02x')))
+        f.write('static const UDOUBLE %s_rows[] = {\n%s\n};\n\n' % (name, c_array(offsets, 8, '%d')))
+        f.write('static const PAINT_RLE %s = { %d, %d, %s_rows, %s_data };\n\n' % (name, width, height, name, name))
+        f.write('#endif\n')
+
+
+if __name__ == '__main__':
+    main()
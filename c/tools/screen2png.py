@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# screen2png.py - Westerbeke Marine Generator Starter and Monitor
+#
+# Turns the "screen" and "mirror" output of the telnet port into PNG
+# images. Capture the session and decode it, e.g.
+#
+#   telnet 192.168.4.3 | tee session.txt
+#   screen2png.py session.txt screen.png
+#
+# Without an output name every frame is written as screen-NNNN.png, in
+# mirror mode that is one picture for each change of the display. Use -
+# to read standard input.
+#
+# The stream is made of text lines, anything else in it is ignored:
+#   @W <width> <height>        a frame begins
+#   @R <y> <rows> <base64>     whole rows from y, run length coded
+#   @E                         the frame is complete
+# The rows are coded as img2rle.py codes them. Mirror frames only hold
+# the rows that changed, the rest is kept from the frames before.
+#
+# Only the Python standard library is used.
+#
+import base64
+import re
+import struct
+import sys
+import zlib
+
+LINE = re.compile(r'@([WRE])(?: (\d+) (\d+)(?: ([A-Za-z0-9+/=]+))?)?')
+
+
+def decode_rows(data, width, rows):
+    """Return rows of RGB565 pixels from run length coded data."""
+    out = []
+    pos = 0
+    for _ in range(rows):
+        row = []
+        while len(row) < width:
+            n = data[pos]
+            pos += 1
+            if n < 0x80:
+                for _ in range(n + 1):
+                    row.append(struct.unpack('>H', data[pos:pos+2])[0])
+                    pos += 2
+            else:
+                row += [struct.unpack('>H', data[pos:pos+2])[0]] * (n - 0x80 + 2)
+                pos += 2
+        out.append(row[:width])
+    return out
+
+
+def write_png(path, rows):
+    """Write rows of RGB565 pixels as an 8 bit RGB PNG."""
+    def chunk(kind, body):
+        return struct.pack('>I', len(body)) + kind + body + \
+            struct.pack('>I', zlib.crc32(kind + body) & 0xffffffff)
+
+    raw = bytearray()
+    for row in rows:
+        raw.append(0)
+        for p in row:
+            raw += bytes((((p >> 11) & 0x1f) * 255 // 31,
+                          ((p >> 5) & 0x3f) * 255 // 63,
+                          (p & 0x1f) * 255 // 31))
+
+    with open(path, 'wb') as f:
+        f.write(b'\x89PNG\r\n\x1a\n')
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', len(rows[0]), len(rows), 8, 2, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b'IEND', b''))
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) not in (1, 2):
+        sys.exit('usage: screen2png.py session.txt|- [screen.png]')
+    src = sys.stdin if args[0] == '-' else open(args[0], errors='replace')
+    dst = args[1] if len(args) == 2 else None
+
+    width = height = 0
+    canvas = None
+    frames = 0
+    for text in src:
+        for m in LINE.finditer(text):
+            kind, a, b, payload = m.groups()
+            if kind == 'W' and a is not None:
+                width, height = int(a), int(b)
+                canvas = [[0xffff] * width for _ in range(height)]
+            elif kind == 'R' and canvas is not None and payload is not None:
+                y = int(a)
+                try:
+                    rows = decode_rows(base64.b64decode(payload), width, int(b))
+                except (IndexError, ValueError, struct.error):
+                    print('bad rows at %d, dropped' % y, file=sys.stderr)
+                    continue
+                canvas[y:y+len(rows)] = rows
+                del canvas[height:]
+            elif kind == 'E' and canvas is not None:
+                path = dst if dst is not None else 'screen-%04d.png' % frames
+                write_png(path, canvas)
+                frames += 1
+
+    if frames == 0:
+        sys.exit('no frames found')
+    print('%d frame%s' % (frames, '' if frames == 1 else 's'))
+
+
+if __name__ == '__main__':
+    main()